@@ -20,6 +20,6 @@
   *********************************************/
 void Acceleration::set(const Angle& a, double magnitude)
 {
-   ddx = magnitude * sin(a.getRadians());
-   ddy = magnitude * cos(a.getRadians());
+   ddx = magnitude * a.getDx();
+   ddy = magnitude * a.getDy();
 }
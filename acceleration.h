@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include "vec2.h"
+
 class TestAcceleration;
 class TestVelocity;
 class TestPosition;
@@ -32,10 +34,12 @@ public:
    // constructors
    Acceleration() : ddx(0.0), ddy(0.0) { }
    Acceleration(double ddx, double ddy) : ddx(ddx), ddy(ddy) { }
+   explicit Acceleration(const Vec2d& a) : ddx(a.getX()), ddy(a.getY()) { }
 
    // getters
    double getDDX()   const { return ddx; }
    double getDDY()   const { return ddy; }
+   Vec2d  getVector() const { return Vec2d(ddx, ddy); }
 
    // setters                        
    void setDDX(double ddx) { this->ddx = ddx; }
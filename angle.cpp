@@ -8,19 +8,25 @@
  ************************************************************************/
 
 #include "angle.h"
-#include <math.h>  // for floor()
+#include <math.h>  // for fmod()
 #include <cassert>
 using namespace std;
 
 
 /************************************
   * ANGLE : NORMALIZE
+  * Into [0, 2PI) in one step however many laps
+  * away it starts. fmod() is exact, so a value
+  * already in range comes back unchanged
   ************************************/
 double Angle::normalize(double radians) const
 {
    double twoPi = 2 * M_PI;
 
-   return (radians)-floor((radians) / (twoPi)) * (twoPi);
+   double r = fmod(radians, twoPi);
+   if (r < 0.0)
+      r += twoPi;
+   return r < twoPi ? r : 0.0;   // -tiny + 2PI can round up to 2PI
 }
 
 /************************************
@@ -37,6 +43,7 @@ void Angle::setRadians(double radians)
    {
       this->radians = radians;
    }
+   updateCache();
 }
 
 /**********************************************
@@ -61,6 +68,7 @@ Angle& Angle::add(double delta)
    {
       radians = normalize(radians);
    }
+   updateCache();
 
    return *this;
 }
@@ -34,9 +34,12 @@ public:
    friend TestProjectile;
 
    // Constructors
-   Angle() : radians(0.0) {}
-   Angle(const Angle& rhs) : radians(rhs.radians) {}
-   Angle(double degrees) : radians((2 * M_PI)* (degrees / 360)) {}
+   Angle() : radians(0.0), sine(0.0), cosine(1.0) {}
+   Angle(const Angle& rhs) : radians(rhs.radians), sine(rhs.sine), cosine(rhs.cosine) {}
+   Angle(double degrees) : radians((2 * M_PI)* (degrees / 360))
+   {
+      updateCache();
+   }
 
    // Getters
    double getDegrees() const { return (radians / (2 * M_PI)) * 360; }
@@ -52,8 +55,9 @@ public:
    //    | /
    // dy = cos a
    // dx = sin a
-   double getDx()   const { return sin(radians); }
-   double getDy()   const { return cos(radians); }
+   // Computed once for each new angle, however many times they are asked for
+   double getDx()   const { return sine;   }
+   double getDy()   const { return cosine; }
    bool   isRight() const { return radians > 0.0 && radians <= M_PI_2; }
    bool   isLeft()  const { return radians >= (M_PI + M_PI_2) && radians < 2 * M_PI; }
 
@@ -61,11 +65,11 @@ public:
    // Setters
    void setDegrees(double degrees);
    void setRadians(double radians);
-   void setUp() { this->radians = 0.0; }
-   void setDown() { this->radians = M_PI; }
-   void setRight() { this->radians = M_PI_2; }
-   void setLeft() { this->radians = M_PI + M_PI_2; }
-   void reverse() { this->radians += M_PI; }
+   void setUp()    { this->radians = 0.0;            updateCache(); }
+   void setDown()  { this->radians = M_PI;           updateCache(); }
+   void setRight() { this->radians = M_PI_2;         updateCache(); }
+   void setLeft()  { this->radians = M_PI + M_PI_2;  updateCache(); }
+   void reverse()  { this->radians += M_PI;          updateCache(); }
    Angle& add(double delta);
 
    // set based on the components
@@ -77,14 +81,28 @@ public:
    //     | a /
    //     |  /
    //     | /
-   void setDxDy(double dx, double dy) { this->radians = normalize(atan(dx / dy)); }
+   void setDxDy(double dx, double dy)
+   {
+      this->radians = normalize(atan(dx / dy));
+      updateCache();
+   }
    Angle operator+(double degrees) const { return Angle(); }
 
 private:
 
    double normalize(double radians) const;
 
+   // every setter calls this, so reading an Angle never writes to it
+   // and any number of threads can share one
+   void updateCache()
+   {
+      sine = sin(radians);
+      cosine = cos(radians);
+   }
+
    double radians;   // 360 degrees equals 2 PI radians
+   double sine;      // of radians
+   double cosine;
 };
 
 #include <iostream>
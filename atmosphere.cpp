@@ -0,0 +1,168 @@
+/***********************************************************************
+ * Source File:
+ *    ATMOSPHERE
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Measured weather on top of the standard atmosphere
+ ************************************************************************/
+
+#include "atmosphere.h"
+#include <fstream>     // for ifstream
+#include <sstream>     // for istringstream
+#include <string>      // for getline()
+#include <cmath>       // for sqrt()
+#include <cassert>     // for ASSERT
+using namespace std;
+
+/*********************************************
+ * ATMOSPHERE PROFILE : LOAD
+ *********************************************/
+bool AtmosphereProfile::load(const char* fileName)
+{
+   ifstream fin(fileName);
+   if (!fin.is_open())
+   {
+      layers.clear();
+      return false;
+   }
+   return read(fin);
+}
+
+/*********************************************
+ * ATMOSPHERE PROFILE : READ
+ *********************************************/
+bool AtmosphereProfile::read(istream& in)
+{
+   layers.clear();
+
+   string line;
+   while (getline(in, line))
+   {
+      size_t comment = line.find('#');
+      if (comment != string::npos)
+         line.erase(comment);
+
+      istringstream sin(line);
+      AtmosphereLayer layer;
+      if (!(sin >> layer.altitude))
+      {
+         // nothing but white space is fine, anything else is not
+         sin.clear();
+         string rest;
+         if (sin >> rest)
+            return layers.clear(), false;
+         continue;
+      }
+
+      string rest;
+      if (!(sin >> layer.windX >> layer.temperatureOffset >> layer.densityScale) ||
+          (sin >> rest) || layer.densityScale < 0.0 || !addLayer(layer))
+      {
+         layers.clear();
+         return false;
+      }
+   }
+
+   return true;
+}
+
+/*********************************************
+ * ATMOSPHERE PROFILE : ADD LAYER
+ *********************************************/
+bool AtmosphereProfile::addLayer(const AtmosphereLayer& layer)
+{
+   if (!layers.empty() && layer.altitude <= layers.back().altitude)
+      return false;
+   layers.push_back(layer);
+   return true;
+}
+
+/*********************************************
+ * ATMOSPHERE PROFILE : FIND SEGMENT
+ * Which pair of layers, i and i+1, is the altitude between? Try the
+ * hint and its neighbors before searching the whole profile.
+ *********************************************/
+int AtmosphereProfile::findSegment(double altitude, int hint) const
+{
+   int numSegments = (int)layers.size() - 1;
+   assert(numSegments >= 1);
+   if (hint < 0 || hint >= numSegments)
+      hint = 0;
+
+   // the same segment as last time, or the one next to it
+   for (int segment = hint - 1; segment <= hint + 1; segment++)
+      if (segment >= 0 && segment < numSegments &&
+          layers[segment].altitude <= altitude && altitude <= layers[segment + 1].altitude)
+         return segment;
+
+   // somewhere else: binary search
+   int low = 0;
+   int high = numSegments - 1;
+   while (low < high)
+   {
+      int middle = (low + high + 1) / 2;
+      if (layers[middle].altitude <= altitude)
+         low = middle;
+      else
+         high = middle - 1;
+   }
+   return low;
+}
+
+/*********************************************
+ * ATMOSPHERE PROFILE : SAMPLE
+ *********************************************/
+AtmosphereSample AtmosphereProfile::sample(double altitude, LookupCursor& cursor) const
+{
+   if (layers.empty())
+      return AtmosphereSample();
+   if (layers.size() == 1 || altitude <= layers.front().altitude)
+      return layers.front();
+   if (altitude >= layers.back().altitude)
+      return layers.back();
+
+   cursor.segment = findSegment(altitude, cursor.segment);
+   const AtmosphereLayer& below = layers[cursor.segment];
+   const AtmosphereLayer& above = layers[cursor.segment + 1];
+   double fraction = (altitude - below.altitude) / (above.altitude - below.altitude);
+
+   AtmosphereSample air;
+   air.windX = below.windX + fraction * (above.windX - below.windX);
+   air.temperatureOffset = below.temperatureOffset +
+      fraction * (above.temperatureOffset - below.temperatureOffset);
+   air.densityScale = below.densityScale + fraction * (above.densityScale - below.densityScale);
+   return air;
+}
+
+/*********************************************
+ * ATMOSPHERE PROFILE : SPEED SOUND
+ * The speed of sound goes with the square root of temperature:
+ *    c^2 = gamma R T
+ * so warming the air by dT gives
+ *    c' = sqrt(c^2 + gamma R dT)
+ *********************************************/
+double AtmosphereProfile::speedSound(double speedSoundStandard, const AtmosphereSample& air)
+{
+   if (air.temperatureOffset == 0.0)
+      return speedSoundStandard;
+   double squared = speedSoundStandard * speedSoundStandard +
+      GAS_CONSTANT_AIR * air.temperatureOffset;
+   return squared > 0.0 ? sqrt(squared) : 0.0;
+}
+
+/*********************************************
+ * ATMOSPHERE PROFILE : DENSITY
+ * At the same pressure, density goes with one over temperature:
+ *    density' = density T / (T + dT) scale
+ * where T comes from the standard speed of sound
+ *********************************************/
+double AtmosphereProfile::density(double densityStandard, double speedSoundStandard,
+                                  const AtmosphereSample& air)
+{
+   double density = densityStandard * air.densityScale;
+   if (air.temperatureOffset == 0.0)
+      return density;
+   double temperature = speedSoundStandard * speedSoundStandard / GAS_CONSTANT_AIR;
+   return density * temperature / (temperature + air.temperatureOffset);
+}
@@ -0,0 +1,83 @@
+/***********************************************************************
+ * Header File:
+ *    ATMOSPHERE
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Measured weather on top of the standard atmosphere in physics.cpp:
+ *    wind, temperature and density, layer by layer up from the ground.
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <iostream>
+#include "physics.h"   // for LookupCursor
+
+class TestAtmosphere;
+
+#define GAS_CONSTANT_AIR 401.874   // gamma R for air: c^2 = 401.874 T
+
+/*********************************************
+ * ATMOSPHERE SAMPLE
+ * The weather at one altitude
+ *********************************************/
+struct AtmosphereSample
+{
+   AtmosphereSample() : windX(0.0), temperatureOffset(0.0), densityScale(1.0) {}
+
+   double windX;              // m/s, positive blows to the right
+   double temperatureOffset;  // K above the standard atmosphere
+   double densityScale;       // 1.0 is the standard atmosphere
+};
+
+/*********************************************
+ * ATMOSPHERE LAYER
+ * A sample measured at a given altitude
+ *********************************************/
+struct AtmosphereLayer : public AtmosphereSample
+{
+   AtmosphereLayer() : altitude(0.0) {}
+   double altitude;           // m
+};
+
+/*********************************************
+ * ATMOSPHERE PROFILE
+ * The weather is interpolated between layers and held above the top
+ * and below the bottom. With no layers, it is the calm standard day.
+ *
+ * A shell spends many steps in the same layer, so each lookup takes
+ * a cursor and checks the segment it found last time first.
+ *********************************************/
+class AtmosphereProfile
+{
+   friend ::TestAtmosphere;
+
+public:
+   // read a profile, one layer per line, lowest first:
+   //    altitude windX temperatureOffset densityScale
+   // Blank lines and anything after # are ignored.
+   // Returns false, leaving the profile empty, on anything else
+   bool load(const char* fileName);
+   bool read(std::istream& in);
+
+   // add a layer above all the others. Returns false if it is not above
+   bool addLayer(const AtmosphereLayer& layer);
+
+   int getNumLayers() const { return (int)layers.size(); }
+   bool isCalm() const { return layers.empty(); }
+
+   // the weather at an altitude. The cursor remembers which pair of
+   // layers the last lookup fell between
+   AtmosphereSample sample(double altitude, LookupCursor& cursor) const;
+
+   // the standard atmosphere adjusted for a sample
+   static double speedSound(double speedSoundStandard, const AtmosphereSample& air);
+   static double density(double densityStandard, double speedSoundStandard,
+                         const AtmosphereSample& air);
+
+private:
+   int findSegment(double altitude, int hint) const;
+
+   std::vector<AtmosphereLayer> layers;
+};
@@ -0,0 +1,384 @@
+/***********************************************************************
+ * Source File:
+ *    BATCH
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Fly a scenario's shots over its ground and stream the results.
+ *
+ *    The binary file is little-endian no matter what machine wrote it:
+ *       "M777BTCH" u32 version  u64 numShots
+ *       then per shot:
+ *          u64 index       f64 elevation   f64 muzzleVelocity
+ *          f64 impactX     f64 impactY     f64 impactTime
+ *          f64 maxAltitude i32 numSteps
+ ************************************************************************/
+
+#include "batch.h"
+#include "projectile.h"
+#include "angle.h"
+#include "parallel.h"  // for parallelFor()
+#include "littleEndian.h"
+#include <fstream>     // for the DEM file
+#include <sstream>     // for istringstream
+#include <cstring>     // for memcmp()
+#include <cstdio>      // for snprintf()
+#include <cstdlib>     // for srand()
+#include <cmath>       // for floor()
+#include <algorithm>   // for max()
+#include <cassert>
+using namespace std;
+
+const char     BATCH_MAGIC[8] = { 'M', '7', '7', '7', 'B', 'T', 'C', 'H' };
+const uint32_t BATCH_VERSION  = 1;
+
+/*********************************************
+ * SCENARIO : GET NUM SHOTS
+ *********************************************/
+long long Scenario::getNumShots() const
+{
+   long long num = 0;
+   for (const ShotRange& range : shots)
+      num += range.count;
+   return num;
+}
+
+/*********************************************
+ * SHOT RANGE : GET SHOT
+ * A range with no muzzle velocity of its own uses the scenario's
+ *********************************************/
+ShotSpec ShotRange::getShot(const ShotSpec& spec, long long i) const
+{
+   assert(i >= 0 && i < count);
+   ShotSpec shot = spec;
+   shot.elevation = elevation + step * (double)i;
+   if (muzzleVelocity > 0.0)
+      shot.muzzleVelocity = muzzleVelocity;
+   return shot;
+}
+
+/*********************************************
+ * SCENARIO : GET SHOT
+ *********************************************/
+ShotSpec Scenario::getShot(long long i) const
+{
+   assert(i >= 0);
+   for (const ShotRange& range : shots)
+   {
+      if (i < range.count)
+         return range.getShot(spec, i);
+      i -= range.count;
+   }
+   assert(false);
+   return spec;
+}
+
+/*********************************************
+ * READ SCENARIO
+ * One keyword and its numbers on each line
+ *********************************************/
+bool readScenario(istream& in, Scenario& scenario, string& error)
+{
+   string line;
+   for (int numLine = 1; getline(in, line); numLine++)
+   {
+      size_t comment = line.find('#');
+      if (comment != string::npos)
+         line.erase(comment);
+
+      istringstream words(line);
+      string keyword;
+      if (!(words >> keyword))
+         continue;
+
+      bool fGood = true;
+      if (keyword == "seed")
+         fGood = (bool)(words >> scenario.seed);
+      else if (keyword == "dem")
+         fGood = (bool)(words >> scenario.demFile);
+      else if (keyword == "view")
+      {
+         double zoom;
+         int width;
+         int height;
+         fGood = (bool)(words >> zoom >> width >> height) &&
+                 zoom > 0.0 && width > 0 && height > 0;
+         if (fGood)
+            scenario.view = View(zoom, width, height);
+      }
+      else if (keyword == "howitzer")
+         fGood = (bool)(words >> scenario.howitzerX);
+      else if (keyword == "velocity")
+         fGood = (bool)(words >> scenario.spec.muzzleVelocity) &&
+                 scenario.spec.muzzleVelocity > 0.0;
+      else if (keyword == "timestep")
+         fGood = (bool)(words >> scenario.spec.timeStep) &&
+                 scenario.spec.timeStep > 0.0;
+      else if (keyword == "drag")
+      {
+         string value;
+         fGood = (bool)(words >> value) && (value == "on" || value == "off");
+         scenario.spec.fDrag = (value == "on");
+      }
+      else if (keyword == "shot")
+      {
+         ShotRange range = { 0.0, 0.0, 1, 0.0 };
+         fGood = (bool)(words >> range.elevation);
+         words >> range.muzzleVelocity;
+         scenario.shots.push_back(range);
+      }
+      else if (keyword == "sweep")
+      {
+         ShotRange range = { 0.0, 0.0, 0, 0.0 };
+         double last;
+         fGood = (bool)(words >> range.elevation >> last >> range.step) &&
+                 range.step > 0.0 && last >= range.elevation;
+         words >> range.muzzleVelocity;
+         if (fGood)
+         {
+            range.count = (long long)floor((last - range.elevation) / range.step + 1e-9) + 1;
+            scenario.shots.push_back(range);
+         }
+      }
+      else
+      {
+         error = "line " + to_string(numLine) + ": unknown setting \"" + keyword + "\"";
+         return false;
+      }
+
+      if (!fGood)
+      {
+         error = "line " + to_string(numLine) + ": bad values for " + keyword;
+         return false;
+      }
+   }
+
+   if (scenario.howitzerX < 0.0 ||
+       scenario.howitzerX >= scenario.view.getUpperRight().getMetersX())
+   {
+      error = "the howitzer is off the ground";
+      return false;
+   }
+   return true;
+}
+
+/*********************************************
+ * SETUP GROUND
+ * A DEM file is every column's elevation in meters, separated by
+ * white space
+ *********************************************/
+bool setupGround(const Scenario& scenario, Ground& ground,
+                 Position& posHowitzer, string& error)
+{
+   posHowitzer = Position(scenario.howitzerX, 0.0);
+   if (scenario.demFile.empty())
+   {
+      srand(scenario.seed);
+      ground.reset(posHowitzer);
+      return true;
+   }
+
+   ifstream fin(scenario.demFile);
+   if (!fin.is_open())
+   {
+      error = "unable to read " + scenario.demFile;
+      return false;
+   }
+   vector<double> elevations;
+   double elevation;
+   while (fin >> elevation)
+      elevations.push_back(max(0.0, elevation));
+   if ((int)elevations.size() != scenario.view.getWidth())
+   {
+      error = scenario.demFile + " has " + to_string(elevations.size()) +
+              " elevations, not " + to_string(scenario.view.getWidth());
+      return false;
+   }
+
+   ground.load(elevations, posHowitzer);
+   return true;
+}
+
+/*********************************************
+ * FLY OVER GROUND
+ * Step the projectile until it is under the ground, then find where
+ * the last step crossed it, the same way computeTrajectory() finds
+ * y = 0
+ *********************************************/
+BatchResult flyOverGround(const ShotSpec& spec, const Position& posHowitzer,
+                          const Ground& ground)
+{
+   BatchResult result;
+   result.elevation = spec.elevation;
+   result.muzzleVelocity = spec.muzzleVelocity;
+
+   Projectile projectile;
+   projectile.setMass(spec.mass);
+   projectile.setRadius(spec.radius);
+   projectile.setDrag(spec.fDrag);
+   projectile.setInterpolation(spec.interpolation);
+   projectile.setDragTable(spec.pDragTable);
+   projectile.setAtmosphere(spec.pAtmosphere);
+   projectile.fire(posHowitzer, 0.0, Angle(spec.elevation), spec.muzzleVelocity);
+
+   Position pos = projectile.getPosition();
+   double height = pos.getMetersY() - ground.getElevationMeters(pos);
+   double t = 0.0;
+   Position posPrevious;
+   double heightPrevious;
+   double tPrevious;
+   result.maxAltitude = pos.getMetersY();
+   do
+   {
+      posPrevious = pos;
+      heightPrevious = height;
+      tPrevious = t;
+
+      projectile.advance(spec.timeStep);
+      pos = projectile.getPosition();
+      height = pos.getMetersY() - ground.getElevationMeters(pos);
+      t = projectile.getCurrentTime();
+      result.maxAltitude = max(result.maxAltitude, pos.getMetersY());
+      result.numSteps++;
+   }
+   while (height >= 0.0 && result.numSteps < MAX_TRAJECTORY_STEPS);
+
+   double fraction = (heightPrevious == height) ? 1.0 :
+      heightPrevious / (heightPrevious - height);
+   result.impactX = posPrevious.getMetersX() +
+      fraction * (pos.getMetersX() - posPrevious.getMetersX());
+   result.impactY = ground.getElevationMeters(Position(result.impactX, 0.0));
+   result.impactTime = tPrevious + fraction * (t - tPrevious);
+   return result;
+}
+
+/*********************************************
+ * ENCODE
+ * One chunk of results in the chosen format
+ *********************************************/
+static void encodeHeader(vector<char>& buffer, BatchFormat format, long long numShots)
+{
+   if (format == BATCH_BINARY)
+   {
+      buffer.insert(buffer.end(), BATCH_MAGIC, BATCH_MAGIC + 8);
+      putU32(buffer, BATCH_VERSION);
+      putU64(buffer, (uint64_t)numShots);
+   }
+   else
+   {
+      const char header[] =
+         "index,elevation,muzzleVelocity,impactX,impactY,impactTime,maxAltitude,numSteps\n";
+      buffer.insert(buffer.end(), header, header + sizeof(header) - 1);
+   }
+}
+
+static void encodeResult(vector<char>& buffer, BatchFormat format, const BatchResult& result)
+{
+   if (format == BATCH_BINARY)
+   {
+      putU64(buffer, (uint64_t)result.index);
+      putF64(buffer, result.elevation);
+      putF64(buffer, result.muzzleVelocity);
+      putF64(buffer, result.impactX);
+      putF64(buffer, result.impactY);
+      putF64(buffer, result.impactTime);
+      putF64(buffer, result.maxAltitude);
+      putU32(buffer, (uint32_t)result.numSteps);
+   }
+   else
+   {
+      char row[256];
+      int length = snprintf(row, sizeof(row), "%lld,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,%d\n",
+                            result.index, result.elevation, result.muzzleVelocity,
+                            result.impactX, result.impactY, result.impactTime,
+                            result.maxAltitude, result.numSteps);
+      buffer.insert(buffer.end(), row, row + length);
+   }
+}
+
+/*********************************************
+ * RUN BATCH
+ * Walk the ranges a chunk at a time. Each chunk is flown on every
+ * core, then encoded into one buffer and written with a single call
+ *********************************************/
+long long runBatch(const Scenario& scenario, const Ground& ground,
+                   const Position& posHowitzer, ostream& out,
+                   BatchFormat format, int numThreads, int chunk)
+{
+   assert(chunk > 0);
+   long long numShots = scenario.getNumShots();
+
+   vector<char> buffer;
+   encodeHeader(buffer, format, numShots);
+   out.write(buffer.data(), buffer.size());
+
+   vector<ShotSpec> specs;
+   vector<BatchResult> results;
+   size_t iRange = 0;
+   long long iInRange = 0;
+   long long numWritten = 0;
+   while (numWritten < numShots && out)
+   {
+      // the next chunk of shots, picking up where the last left off
+      specs.clear();
+      while ((int)specs.size() < chunk && iRange < scenario.shots.size())
+      {
+         const ShotRange& range = scenario.shots[iRange];
+         specs.push_back(range.getShot(scenario.spec, iInRange));
+         if (++iInRange == range.count)
+         {
+            iRange++;
+            iInRange = 0;
+         }
+      }
+
+      results.resize(specs.size());
+      parallelFor((int)specs.size(), numThreads, [&](int i)
+      {
+         results[i] = flyOverGround(specs[i], posHowitzer, ground);
+         results[i].index = numWritten + i;
+      });
+
+      buffer.clear();
+      for (const BatchResult& result : results)
+         encodeResult(buffer, format, result);
+      out.write(buffer.data(), buffer.size());
+      numWritten += (long long)results.size();
+   }
+
+   out.flush();
+   return out ? numWritten : -1;
+}
+
+/*********************************************
+ * READ BATCH HEADER
+ *********************************************/
+bool readBatchHeader(istream& in, long long& numShots)
+{
+   char magic[8];
+   uint32_t version;
+   uint64_t num;
+   if (!in.read(magic, 8) || memcmp(magic, BATCH_MAGIC, 8) != 0 ||
+       !readU32(in, version) || version != BATCH_VERSION || !readU64(in, num))
+      return false;
+   numShots = (long long)num;
+   return true;
+}
+
+/*********************************************
+ * READ BATCH RESULT
+ *********************************************/
+bool readBatchResult(istream& in, BatchResult& result)
+{
+   uint64_t index;
+   uint32_t numSteps;
+   if (!readU64(in, index) ||
+       !readF64(in, result.elevation) || !readF64(in, result.muzzleVelocity) ||
+       !readF64(in, result.impactX) || !readF64(in, result.impactY) ||
+       !readF64(in, result.impactTime) || !readF64(in, result.maxAltitude) ||
+       !readU32(in, numSteps))
+      return false;
+   result.index = (long long)index;
+   result.numSteps = (int)numSteps;
+   return true;
+}
@@ -0,0 +1,122 @@
+/***********************************************************************
+ * Header File:
+ *    BATCH
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Fly a scenario's shots over its ground without any graphics and
+ *    stream where each one landed to a CSV or binary file. The shots
+ *    are flown a chunk at a time on every core, so a run of millions
+ *    never holds more than one chunk of results.
+ *
+ *    A scenario is a text file, one setting per line, # for comments:
+ *       seed     42                 random ground from srand(42)
+ *       dem      valley.txt         or measured ground: one elevation
+ *                                   in meters per column of pixels
+ *       view     40 700 500         m per pixel, width, height
+ *       howitzer 14000              m from the left edge
+ *       velocity 827                m/s for shots that do not say
+ *       timestep 0.5                s per step
+ *       drag     on                 or off
+ *       shot     30 [700]           one elevation [and muzzle velocity]
+ *       sweep    -80 80 0.01 [700]  first, last, step [and velocity]
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include "trajectory.h"   // for ShotSpec
+#include "ground.h"
+#include "view.h"
+
+#define BATCH_CHUNK 4096   // shots flown before their results are written
+
+/*********************************************
+ * BATCH FORMAT
+ *********************************************/
+enum BatchFormat
+{
+   BATCH_CSV,      // a header row then one row per shot
+   BATCH_BINARY    // see batch.cpp
+};
+
+/*********************************************
+ * SHOT RANGE
+ * count shots, each step degrees above the last
+ *********************************************/
+struct ShotRange
+{
+   double elevation;        // degrees, of the first shot
+   double step;             // degrees
+   long long count;
+   double muzzleVelocity;   // m/s
+
+   // the ith shot of the range, with the shell from spec
+   ShotSpec getShot(const ShotSpec& spec, long long i) const;
+};
+
+/*********************************************
+ * SCENARIO
+ *********************************************/
+struct Scenario
+{
+   Scenario() : seed(1), view(DEFAULT_METERS_FROM_PIXELS, 700, 500),
+                howitzerX(14000.0) {}
+
+   unsigned int seed;            // for the random ground
+   std::string demFile;          // measured ground, if not empty
+   View view;                    // how big the ground is
+   double howitzerX;             // m
+   ShotSpec spec;                // the shell, time step and muzzle velocity
+   std::vector<ShotRange> shots;
+
+   // how many shots there are in all
+   long long getNumShots() const;
+
+   // the ith shot, counting across every range
+   ShotSpec getShot(long long i) const;
+};
+
+/*********************************************
+ * BATCH RESULT
+ * Where one shot landed, in meters and seconds
+ *********************************************/
+struct BatchResult
+{
+   BatchResult() : index(0), elevation(0.0), muzzleVelocity(0.0), impactX(0.0),
+                   impactY(0.0), impactTime(0.0), maxAltitude(0.0), numSteps(0) {}
+
+   long long index;          // which shot in the scenario
+   double elevation;         // degrees
+   double muzzleVelocity;    // m/s
+   double impactX;           // m from the left edge
+   double impactY;           // m, the height of the ground where it landed
+   double impactTime;        // s from firing
+   double maxAltitude;       // m, the highest it climbed
+   int    numSteps;          // calls to advance() it took
+};
+
+// read a scenario. On failure, error says which line and why
+bool readScenario(std::istream& in, Scenario& scenario, std::string& error);
+
+// make the scenario's ground, random or measured, and put the howitzer
+// on it. The ground must have been built with the scenario's view
+bool setupGround(const Scenario& scenario, Ground& ground,
+                 Position& posHowitzer, std::string& error);
+
+// fly one shot from the howitzer until it goes under the ground
+BatchResult flyOverGround(const ShotSpec& spec, const Position& posHowitzer,
+                          const Ground& ground);
+
+// fly every shot in the scenario and write the results to out in order.
+// Returns how many were written
+long long runBatch(const Scenario& scenario, const Ground& ground,
+                   const Position& posHowitzer, std::ostream& out,
+                   BatchFormat format, int numThreads = 0,
+                   int chunk = BATCH_CHUNK);
+
+// read back a binary batch file, one result at a time
+bool readBatchHeader(std::istream& in, long long& numShots);
+bool readBatchResult(std::istream& in, BatchResult& result);
@@ -0,0 +1,106 @@
+/***********************************************************************
+ * Source File:
+ *    BATCH MAIN
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Fly every shot in a scenario file without opening a window and
+ *    write where each one landed.
+ *
+ *    batch scenario.txt [--output=file] [--format=csv|binary] [--threads=n]
+ *
+ *    CSV goes to the screen unless there is an output file; binary
+ *    always needs one.
+ ************************************************************************/
+
+#include <fstream>     // for ifstream and ofstream
+#include <chrono>      // for steady_clock
+#include <cstdio>      // for fprintf()
+#include <cstring>     // for strncmp()
+#include <cstdlib>     // for atoi()
+#include "batch.h"
+using namespace std;
+
+#define BATCH_FILE_BUFFER (1 << 20)   // bytes held before each write to disk
+
+/*********************************************
+ * MAIN
+ *********************************************/
+int main(int argc, char** argv)
+{
+   const char* scenarioName = nullptr;
+   const char* outputName = nullptr;
+   BatchFormat format = BATCH_CSV;
+   int numThreads = 0;
+   bool fUsage = false;
+
+   for (int i = 1; i < argc; i++)
+   {
+      if (strncmp(argv[i], "--output=", 9) == 0)
+         outputName = argv[i] + 9;
+      else if (strcmp(argv[i], "--format=csv") == 0)
+         format = BATCH_CSV;
+      else if (strcmp(argv[i], "--format=binary") == 0)
+         format = BATCH_BINARY;
+      else if (strncmp(argv[i], "--threads=", 10) == 0)
+         numThreads = atoi(argv[i] + 10);
+      else if (argv[i][0] != '-' && scenarioName == nullptr)
+         scenarioName = argv[i];
+      else
+         fUsage = true;
+   }
+   if (fUsage || scenarioName == nullptr ||
+       (format == BATCH_BINARY && outputName == nullptr))
+   {
+      fprintf(stderr, "usage: %s scenario [--output=file] [--format=csv|binary] "
+                      "[--threads=n]\n", argv[0]);
+      return 2;
+   }
+
+   // the scenario and its ground
+   Scenario scenario;
+   string error;
+   ifstream fin(scenarioName);
+   if (!fin.is_open())
+      error = string("unable to read ") + scenarioName;
+   else
+      readScenario(fin, scenario, error);
+   Ground ground(scenario.view);
+   Position posHowitzer;
+   if (error.empty())
+      setupGround(scenario, ground, posHowitzer, error);
+   if (!error.empty())
+   {
+      fprintf(stderr, "%s: %s\n", scenarioName, error.c_str());
+      return 2;
+   }
+
+   // where the results go. A big buffer keeps the disk writes few
+   vector<char> fileBuffer(BATCH_FILE_BUFFER);
+   ofstream fout;
+   if (outputName != nullptr)
+   {
+      fout.rdbuf()->pubsetbuf(fileBuffer.data(), fileBuffer.size());
+      fout.open(outputName, format == BATCH_BINARY ? ios::binary : ios::out);
+      if (!fout.is_open())
+      {
+         fprintf(stderr, "Unable to write %s\n", outputName);
+         return 2;
+      }
+   }
+   ostream& out = (outputName != nullptr) ? fout : cout;
+
+   auto begin = chrono::steady_clock::now();
+   long long numWritten = runBatch(scenario, ground, posHowitzer, out, format, numThreads);
+   auto end = chrono::steady_clock::now();
+   if (numWritten < 0)
+   {
+      fprintf(stderr, "Unable to write the results\n");
+      return 1;
+   }
+
+   double seconds = chrono::duration<double>(end - begin).count();
+   fprintf(stderr, "%lld shots in %.3f s, %.0f shots/s\n", numWritten, seconds,
+           seconds > 0.0 ? numWritten / seconds : 0.0);
+   return 0;
+}
@@ -0,0 +1,211 @@
+/***********************************************************************
+ * Source File:
+ *    BATTERY
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Several howitzers on the same ground aiming at one target
+ ************************************************************************/
+
+#include "battery.h"
+#include "parallel.h"  // for parallelFor()
+#include <algorithm>   // for max()
+#include <cassert>
+using namespace std;
+
+/***********************************************************************
+ * BATTERY : GENERATE POSITIONS
+ * Split one side of the screen into a slot for each gun and put each
+ * gun somewhere in its own slot, so no two share a flat spot
+ ************************************************************************/
+void Battery::generatePositions(const View& view, int numGuns, double muzzleVelocity)
+{
+   assert(numGuns > 0);
+   guns.clear();
+
+   bool fLeft = random(0, 2) == 0;
+   double left  = view.getWidth() * (fLeft ? 0.10 : 0.55);
+   double right = view.getWidth() * (fLeft ? 0.45 : 0.90);
+   double widthSlot = (right - left) / numGuns;
+   for (int i = 0; i < numGuns; i++)
+   {
+      double xPixels = random(left + widthSlot * i, left + widthSlot * (i + 1));
+      add(view.fromPixels(xPixels, 0.0), muzzleVelocity);
+   }
+}
+
+/***********************************************************************
+ * BATTERY : PLACE ON
+ * The ground decides how high each gun sits
+ ************************************************************************/
+void Battery::placeOn(Ground& ground)
+{
+   assert(!guns.empty());
+
+   vector<Position> positions;
+   for (const Howitzer& gun : guns)
+      positions.push_back(gun.getPosition());
+
+   ground.reset(positions);
+
+   for (size_t i = 0; i < guns.size(); i++)
+      guns[i].getPosition() = positions[i];
+}
+
+/***********************************************************************
+ * VOLLEY : TIME ON TARGET
+ * Once all the times of flight are known, the slowest shell fires
+ * first and the others wait just long enough to land with it
+ ************************************************************************/
+void Volley::timeOnTarget()
+{
+   numValid = 0;
+   impactTime = 0.0;
+   for (const FireOrder& order : orders)
+      if (order.solution.fValid)
+      {
+         numValid++;
+         impactTime = max(impactTime, order.solution.timeOfFlight);
+      }
+
+   for (FireOrder& order : orders)
+      order.fireDelay = order.solution.fValid ?
+         impactTime - order.solution.timeOfFlight : 0.0;
+}
+
+/***********************************************************************
+ * BATTERY : AIM
+ * Solve every gun on its own thread, then time the volley
+ ************************************************************************/
+Volley Battery::aim(const Position& posTarget, const ShotSpec& spec,
+                    bool fHighAngle, int numThreads)
+{
+   Volley volley;
+   volley.orders.resize(guns.size());
+
+   parallelFor(size(), numThreads, [&](int i)
+   {
+      ShotSpec shot = spec;
+      shot.muzzleVelocity = guns[i].getMuzzleVelocity();
+      double distance = posTarget.getMetersX() - guns[i].getPosition().getMetersX();
+      double height = posTarget.getMetersY() - guns[i].getPosition().getMetersY();
+      volley.orders[i].solution = solveElevation(distance, height, shot, fHighAngle);
+   });
+
+   volley.timeOnTarget();
+   point(volley);
+   return volley;
+}
+
+/***********************************************************************
+ * BATTERY : POINT
+ * Lay every gun that can reach the target at its elevation
+ ************************************************************************/
+void Battery::point(const Volley& volley)
+{
+   assert(volley.orders.size() == guns.size());
+   for (size_t i = 0; i < guns.size(); i++)
+      if (volley.orders[i].solution.fValid)
+         guns[i].setElevation(Angle(volley.orders[i].solution.elevation));
+}
+
+/***********************************************************************
+ * BATTERY : FIRE
+ * Every gun gets an empty pool, the first time only, and a shell built
+ * the way the solver built its own
+ ************************************************************************/
+void Battery::fire(const Volley& volley, const ShotSpec& spec)
+{
+   assert(volley.orders.size() == guns.size());
+   this->volley = volley;
+   this->spec = spec;
+   clock = 0.0;
+
+   if (salvos.size() != guns.size())
+      salvos.assign(guns.size(), Salvo(BATTERY_SALVO_CAPACITY));
+   for (Salvo& salvo : salvos)
+      salvo.reset();
+   fFired.assign(guns.size(), false);
+   impacts.assign(guns.size(), Impact());
+}
+
+/***********************************************************************
+ * BATTERY : ADVANCE
+ * Each gun on its own thread. A shell fires at its fireDelay, not at
+ * the clock, and takes whole steps from there, so it crosses the
+ * ground where and when the solver said it would
+ ************************************************************************/
+int Battery::advance(double seconds, const Ground& ground, int numThreads)
+{
+   clock += seconds;
+   int numLandedBefore = countLanded();
+
+   parallelFor(size(), numThreads, [&](int i)
+   {
+      const FireOrder& order = volley.orders[i];
+      Salvo& salvo = salvos[i];
+      if (!fFired[i] && order.solution.fValid && order.fireDelay <= clock)
+      {
+         Projectile shell;
+         shell.setMass(spec.mass);
+         shell.setRadius(spec.radius);
+         shell.setDrag(spec.fDrag);
+         shell.setInterpolation(spec.interpolation);
+         shell.setDragTable(spec.pDragTable);
+         shell.setAtmosphere(spec.pAtmosphere);
+         salvo.fire(shell, guns[i].getPosition(), order.fireDelay,
+                    Angle(order.solution.elevation), guns[i].getMuzzleVelocity());
+         fFired[i] = true;
+      }
+
+      // a shell under the ground is retired by the step after it lands
+      while (salvo.isFlying() && salvo.getNewest().getCurrentTime() + spec.timeStep <= clock)
+      {
+         salvo.advance(spec.timeStep, ground);
+         if (!salvo.isFlying() || impacts[i].fLanded)
+            continue;
+
+         // where between the last two steps did it cross the ground?
+         const Projectile& shell = salvo.getNewest();
+         Position pos = shell.getPosition();
+         double height = pos.getMetersY() - ground.getElevationMeters(pos);
+         if (height >= 0.0)
+            continue;
+         Position posPrevious = shell.getPosition(0.0);
+         double heightPrevious = posPrevious.getMetersY() -
+                                 ground.getElevationMeters(posPrevious);
+         double fraction = heightPrevious / (heightPrevious - height);
+         impacts[i].fLanded = true;
+         impacts[i].x = posPrevious.getMetersX() +
+                        fraction * (pos.getMetersX() - posPrevious.getMetersX());
+         impacts[i].time = shell.getPreviousTime() +
+                           fraction * (shell.getCurrentTime() - shell.getPreviousTime());
+      }
+   });
+
+   return countLanded() - numLandedBefore;
+}
+
+/***********************************************************************
+ * BATTERY : COUNT LANDED
+ ************************************************************************/
+int Battery::countLanded() const
+{
+   int numLanded = 0;
+   for (const Impact& impact : impacts)
+      if (impact.fLanded)
+         numLanded++;
+   return numLanded;
+}
+
+/***********************************************************************
+ * BATTERY : IS FIRING
+ ************************************************************************/
+bool Battery::isFiring() const
+{
+   for (size_t i = 0; i < salvos.size(); i++)
+      if (salvos[i].isFlying() ||
+          (!fFired[i] && volley.orders[i].solution.fValid))
+         return true;
+   return false;
+}
@@ -0,0 +1,146 @@
+/***********************************************************************
+ * Header File:
+ *    BATTERY
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Several howitzers on the same ground, each with its own spot and
+ *    muzzle velocity, that aim together at one target and fire so
+ *    their shells land on it together.
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include "howitzer.h"
+#include "ground.h"
+#include "solver.h"
+#include "salvo.h"
+
+#define BATTERY_SALVO_CAPACITY 1   // shells one gun has in the air: one volley's
+
+class TestBattery;
+
+/*********************************************
+ * FIRE ORDER
+ * One gun's part in a volley
+ *********************************************/
+struct FireOrder
+{
+   FireOrder() : fireDelay(0.0) {}
+
+   FiringSolution solution;   // elevation and time of flight
+   double fireDelay;          // s after the volley starts to pull the lanyard
+};
+
+/*********************************************
+ * VOLLEY
+ * A time-on-target plan: every gun that can reach the target fires
+ * late enough that all the shells arrive at impactTime together
+ *********************************************/
+struct Volley
+{
+   Volley() : impactTime(0.0), numValid(0) {}
+
+   // set impactTime and every fireDelay from the solutions
+   void timeOnTarget();
+
+   std::vector<FireOrder> orders;   // one for each gun, in battery order
+   double impactTime;               // s after the volley starts
+   int    numValid;                 // guns that can reach the target
+};
+
+/*********************************************
+ * IMPACT
+ * Where and when one gun's shell of a volley came down
+ *********************************************/
+struct Impact
+{
+   Impact() : fLanded(false), x(0.0), time(0.0) {}
+
+   bool   fLanded;
+   double x;      // m, where it crossed the ground
+   double time;   // s after the volley started
+};
+
+/*********************************************
+ * BATTERY
+ * The guns of a battery. Aiming solves every gun's firing solution at
+ * once, one gun per thread, since each is a handful of full
+ * trajectories that share nothing. Flying a volley is the same: each
+ * gun has its own pool of shells and steps it on its own thread.
+ *********************************************/
+class Battery
+{
+public:
+   friend ::TestBattery;
+
+   Battery() : clock(0.0) {}
+
+   // add one more gun
+   void add(const Position& position, double muzzleVelocity = DEFAULT_MUZZLE_VELOCITY)
+   {
+      guns.push_back(Howitzer(position, muzzleVelocity));
+   }
+
+   // pick numGuns spots on one side of the screen, like generatePosition()
+   void generatePositions(const View& view, int numGuns,
+                          double muzzleVelocity = DEFAULT_MUZZLE_VELOCITY);
+
+   // make a new ground with a flat spot under every gun, and set each
+   // gun's height from it
+   void placeOn(Ground& ground);
+
+   // the time-on-target plan for posTarget. Each gun is solved for the
+   // target's height above its own, and its elevation is set to its
+   // solution. The shot comes from spec; its elevation and muzzle
+   // velocity are ignored. numThreads of 0 uses every core
+   Volley aim(const Position& posTarget, const ShotSpec& spec,
+              bool fHighAngle = false, int numThreads = 0);
+
+   // set each gun's elevation from its part of a volley
+   void point(const Volley& volley);
+
+   // start the clock on a volley from aim() with the same spec. Each gun
+   // that can reach the target fires when its fireDelay comes. A volley
+   // still in the air comes down
+   void fire(const Volley& volley, const ShotSpec& spec);
+
+   // move the volley's clock on by seconds. Each gun fires if its turn
+   // has come and steps its shell every spec.timeStep of the clock, so
+   // the shell flies the path the solver found. Returns how many landed
+   int advance(double seconds, const Ground& ground, int numThreads = 0);
+
+   // a shell in the air, or a gun still waiting to fire
+   bool isFiring() const;
+
+   const Impact& getImpact(int i) const { return impacts[i]; }
+   const Salvo&  getSalvo(int i)  const { return salvos[i];  }
+
+   // getters
+   int size() const { return (int)guns.size(); }
+   Howitzer& operator [] (int i)             { return guns[i]; }
+   const Howitzer& operator [] (int i) const { return guns[i]; }
+
+   // draw every gun and every shell in the air
+   void draw(ogstream& gout, double flightTime) const
+   {
+      for (const Howitzer& gun : guns)
+         gun.draw(gout, flightTime);
+      for (const Salvo& salvo : salvos)
+         salvo.draw(gout);
+   }
+
+private:
+   int countLanded() const;
+
+   std::vector<Howitzer> guns;
+
+   // the volley being fired
+   Volley volley;
+   ShotSpec spec;
+   double clock;                  // s since the volley started
+   std::vector<Salvo> salvos;     // one for each gun
+   std::vector<char> fFired;      // one for each gun
+   std::vector<Impact> impacts;   // one for each gun
+};
@@ -0,0 +1,517 @@
+/***********************************************************************
+ * Source File:
+ *    BENCHMARK PHYSICS
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Microbenchmarks for the hot path of the physics layer: the table
+ *    lookups, the vector math, a single projectile step and a whole
+ *    shot from the muzzle to the ground.
+ ************************************************************************/
+
+#include "benchmark.h"
+#include "physics.h"
+#include "velocity.h"
+#include "angle.h"
+#include "projectile.h"
+#include "solver.h"
+#include "dragTable.h"
+#include "atmosphere.h"
+#include "vec2.h"
+#include "salvo.h"
+#include "battery.h"
+#include "scheduler.h"
+#include "ground.h"
+#include "view.h"
+#include <vector>
+#include <cmath>     // for sin() and cos()
+using namespace std;
+
+const int    NUM_INPUTS = 1024;   // a power of two so we can mask the index
+const double TIME_STEP  = 1.0;    // s, the same as the simulator's DEFAULT_TIME_STEP
+
+/*********************************************
+ * INPUTS
+ * A fixed spread of values between min and max, shuffled so the
+ * lookups do not always hit the same table segment.
+ *********************************************/
+struct Inputs
+{
+   Inputs(double min, double max)
+   {
+      unsigned int seed = 12345;
+      for (int i = 0; i < NUM_INPUTS; i++)
+      {
+         seed = seed * 1664525 + 22695477;
+         values[i] = min + (max - min) * (double)(seed >> 8) / (double)(1 << 24);
+      }
+   }
+   double operator [] (long long i) const { return values[i & (NUM_INPUTS - 1)]; }
+   double values[NUM_INPUTS];
+};
+
+/*********************************************
+ * LINEAR INTERPOLATION
+ * A ten entry table, about the size of the ones in physics.cpp
+ *********************************************/
+static void BM_linearInterpolation(BenchmarkState & state)
+{
+   const Mapping mapping[] =
+   {
+      { 0.0, 0.0 }, { 1.0, 2.0 }, { 2.0, 3.0 }, { 3.0, 3.5 }, { 4.0, 3.7 },
+      { 5.0, 3.8 }, { 6.0, 4.5 }, { 7.0, 6.0 }, { 8.0, 7.0 }, { 9.0, 7.2 }
+   };
+   static const Inputs inputs(0.0, 9.0);
+   long long i = 0;
+   while (state.keepRunning())
+      doNotOptimize(linearInterpolation(mapping, sizeof(mapping) / sizeof(mapping[0]), inputs[i++]));
+}
+BENCHMARK(BM_linearInterpolation);
+
+/*********************************************
+ * DENSITY ALONG A FLIGHT
+ * Altitudes that climb to 20km and come back down a few meters at a
+ * time, the way advance() asks for them. With and without a cursor
+ *********************************************/
+static double flightAltitude(long long i)
+{
+   long long phase = i & 0x3fff;
+   return (phase < 0x2000 ? phase : 0x4000 - phase) * (20000.0 / 8192.0);
+}
+
+static void BM_densityAlongFlight(BenchmarkState & state)
+{
+   long long i = 0;
+   while (state.keepRunning())
+      doNotOptimize(densityFromAltitude(flightAltitude(i++)));
+}
+BENCHMARK(BM_densityAlongFlight);
+
+static void BM_densityAlongFlightCursor(BenchmarkState & state)
+{
+   LookupCursor cursor;
+   long long i = 0;
+   while (state.keepRunning())
+      doNotOptimize(densityFromAltitude(flightAltitude(i++), cursor));
+}
+BENCHMARK(BM_densityAlongFlightCursor);
+
+/*********************************************
+ * ATMOSPHERE LOOKUPS
+ *********************************************/
+static void BM_gravityFromAltitude(BenchmarkState & state)
+{
+   static const Inputs inputs(0.0, 25000.0);
+   long long i = 0;
+   while (state.keepRunning())
+      doNotOptimize(gravityFromAltitude(inputs[i++]));
+}
+BENCHMARK(BM_gravityFromAltitude);
+
+static void BM_densityFromAltitude(BenchmarkState & state)
+{
+   static const Inputs inputs(0.0, 80000.0);
+   long long i = 0;
+   while (state.keepRunning())
+      doNotOptimize(densityFromAltitude(inputs[i++]));
+}
+BENCHMARK(BM_densityFromAltitude);
+
+static void BM_speedSoundFromAltitude(BenchmarkState & state)
+{
+   static const Inputs inputs(0.0, 40000.0);
+   long long i = 0;
+   while (state.keepRunning())
+      doNotOptimize(speedSoundFromAltitude(inputs[i++]));
+}
+BENCHMARK(BM_speedSoundFromAltitude);
+
+/*********************************************
+ * DRAG FROM MACH
+ *********************************************/
+static void BM_dragFromMach(BenchmarkState & state)
+{
+   static const Inputs inputs(0.0, 5.0);
+   long long i = 0;
+   while (state.keepRunning())
+      doNotOptimize(dragFromMach(inputs[i++]));
+}
+BENCHMARK(BM_dragFromMach);
+
+static void BM_dragFromMachCubic(BenchmarkState & state)
+{
+   static const Inputs inputs(0.0, 5.0);
+   LookupCursor cursor;
+   long long i = 0;
+   while (state.keepRunning())
+      doNotOptimize(dragFromMach(inputs[i++], cursor, INTERPOLATE_CUBIC));
+}
+BENCHMARK(BM_dragFromMachCubic);
+
+/*********************************************
+ * DRAG DECELERATION
+ * The four lookups advance() makes, against one read of the table
+ *********************************************/
+static void BM_dragExact(BenchmarkState & state)
+{
+   static const Inputs altitudes(0.0, 30000.0);
+   static const Inputs speeds(100.0, 900.0);
+   long long i = 0;
+   while (state.keepRunning())
+   {
+      doNotOptimize(DragTable::exactDeceleration(altitudes[i], speeds[i + 7], 46.7, 0.077545));
+      i++;
+   }
+}
+BENCHMARK(BM_dragExact);
+
+static void BM_dragTable(BenchmarkState & state)
+{
+   static const DragTable table(46.7, 0.077545);
+   static const Inputs altitudes(0.0, 30000.0);
+   static const Inputs speeds(100.0, 900.0);
+   long long i = 0;
+   while (state.keepRunning())
+   {
+      doNotOptimize(table.getDeceleration(altitudes[i], speeds[i + 7]));
+      i++;
+   }
+}
+BENCHMARK(BM_dragTable);
+
+/*********************************************
+ * VELOCITY GET SPEED
+ *********************************************/
+static void BM_velocityGetSpeed(BenchmarkState & state)
+{
+   static const Inputs inputs(-900.0, 900.0);
+   long long i = 0;
+   while (state.keepRunning())
+   {
+      Velocity v(inputs[i], inputs[i + 1]);
+      i++;
+      doNotOptimize(v.getSpeed());
+   }
+}
+BENCHMARK(BM_velocityGetSpeed);
+
+/*********************************************
+ * ANGLE NORMALIZE
+ * Through setRadians(), with values well outside 0..2PI
+ *********************************************/
+static void BM_angleNormalize(BenchmarkState & state)
+{
+   static const Inputs inputs(-20.0, 20.0);
+   Angle angle;
+   long long i = 0;
+   while (state.keepRunning())
+   {
+      angle.setRadians(inputs[i++]);
+      doNotOptimize(angle.getRadians());
+   }
+}
+BENCHMARK(BM_angleNormalize);
+
+/*********************************************
+ * ANGLE COMPONENTS
+ * A new angle, asked for each component twice the way Velocity::set()
+ * and then the drawing code would
+ *********************************************/
+static void BM_angleComponents(BenchmarkState & state)
+{
+   static const Inputs inputs(-180.0, 180.0);
+   long long i = 0;
+   while (state.keepRunning())
+   {
+      Angle angle(inputs[i++]);
+      doNotOptimize(angle.getDx() + angle.getDy() + angle.getDx() + angle.getDy());
+   }
+}
+BENCHMARK(BM_angleComponents);
+
+/*********************************************
+ * PROJECTILE ADVANCE
+ * One time step. Fire again whenever the shell lands.
+ *********************************************/
+static void BM_projectileAdvance(BenchmarkState & state)
+{
+   Projectile projectile;
+   Angle elevation(45.0);
+   projectile.fire(Position(0.0, 0.0), 0.0, elevation, 827.0);
+   while (state.keepRunning())
+   {
+      projectile.advance(TIME_STEP);
+      if (projectile.getAltitude() < 0.0)
+         projectile.fire(Position(0.0, 0.0), 0.0, elevation, 827.0);
+   }
+   doNotOptimize(projectile.getAltitude());
+}
+BENCHMARK(BM_projectileAdvance);
+
+/*********************************************
+ * SHOT TO IMPACT
+ * A whole flight at a range of elevations. The items are the steps
+ *********************************************/
+static void BM_shotToImpact(BenchmarkState & state)
+{
+   static const Inputs inputs(-75.0, 75.0);
+   long long steps = 0;
+   long long i = 0;
+   while (state.keepRunning())
+   {
+      Projectile projectile;
+      projectile.fire(Position(0.0, 0.0), 0.0, Angle(inputs[i++]), 827.0);
+      do
+      {
+         projectile.advance(TIME_STEP);
+         steps++;
+      }
+      while (projectile.getAltitude() >= 0.0);
+      doNotOptimize(projectile.getFlightDistance());
+   }
+   state.setItemsProcessed(steps);
+}
+BENCHMARK(BM_shotToImpact);
+
+/*********************************************
+ * SOLVE ELEVATION
+ * The vacuum guess plus secant refinement. The items are trajectories
+ *********************************************/
+static void BM_solveElevation(BenchmarkState & state)
+{
+   static const Inputs inputs(2000.0, 20000.0);
+   ShotSpec spec(0.0, 827.0);
+   long long evaluations = 0;
+   long long i = 0;
+   while (state.keepRunning())
+   {
+      FiringSolution solution = solveElevation(inputs[i++], 0.0, spec);
+      evaluations += solution.numEvaluations;
+      doNotOptimize(solution.elevation);
+   }
+   state.setItemsProcessed(evaluations);
+}
+BENCHMARK(BM_solveElevation);
+
+/*********************************************
+ * SHOT TO IMPACT WITH THE DRAG TABLE
+ *********************************************/
+static void BM_shotToImpactDragTable(BenchmarkState & state)
+{
+   static const DragTable table(DEFAULT_PROJECTILE_WEIGHT, DEFAULT_PROJECTILE_RADIUS);
+   static const Inputs inputs(-75.0, 75.0);
+   long long steps = 0;
+   long long i = 0;
+   while (state.keepRunning())
+   {
+      Projectile projectile;
+      projectile.setDragTable(&table);
+      projectile.fire(Position(0.0, 0.0), 0.0, Angle(inputs[i++]), 827.0);
+      do
+      {
+         projectile.advance(TIME_STEP);
+         steps++;
+      }
+      while (projectile.getAltitude() >= 0.0);
+      doNotOptimize(projectile.getFlightDistance());
+   }
+   state.setItemsProcessed(steps);
+}
+BENCHMARK(BM_shotToImpactDragTable);
+
+/*********************************************
+ * ATMOSPHERE SAMPLE
+ * Climbing and falling through a twenty layer profile, the way a
+ * shell does, so the cursor is right almost every time
+ *********************************************/
+static void BM_atmosphereSample(BenchmarkState & state)
+{
+   AtmosphereProfile profile;
+   for (int i = 0; i < 20; i++)
+   {
+      AtmosphereLayer layer;
+      layer.altitude = 1000.0 * i;
+      layer.windX = 0.5 * i;
+      profile.addLayer(layer);
+   }
+   LookupCursor cursor;
+   long long i = 0;
+   while (state.keepRunning())
+   {
+      double altitude = (double)(i++ & 0x7fff) * (20000.0 / 32768.0);
+      doNotOptimize(profile.sample(altitude, cursor).windX);
+   }
+}
+BENCHMARK(BM_atmosphereSample);
+
+/*********************************************
+ * SALVO ADVANCE
+ * A pool kept full of shells over the standard 700 x 500 field, every
+ * one checked against the ground and stepped each tick. Landed shells
+ * are fired again. The items are shell steps, so the time per item
+ * should not grow with the size of the salvo
+ *********************************************/
+static void salvoAdvance(BenchmarkState & state, int numShells)
+{
+   static const Inputs inputs(-75.0, 75.0);
+   View view(DEFAULT_METERS_FROM_PIXELS, 700, 500);
+   Ground ground(view);
+   Position posHowitzer(14000.0, 0.0);
+   ground.reset(posHowitzer);
+
+   Salvo salvo(numShells);
+   long long steps = 0;
+   long long i = 0;
+   while (state.keepRunning())
+   {
+      while (salvo.fire(posHowitzer, 0.0, Angle(inputs[i++]), 827.0))
+         ;
+      steps += salvo.getNumFlying();
+      salvo.advance(TIME_STEP, ground);
+   }
+   doNotOptimize(salvo.getNumFlying());
+   state.setItemsProcessed(steps);
+}
+
+static void BM_salvoAdvance16(BenchmarkState & state)   { salvoAdvance(state, 16);   }
+BENCHMARK(BM_salvoAdvance16);
+
+static void BM_salvoAdvance256(BenchmarkState & state)  { salvoAdvance(state, 256);  }
+BENCHMARK(BM_salvoAdvance256);
+
+static void BM_salvoAdvance4096(BenchmarkState & state) { salvoAdvance(state, 4096); }
+BENCHMARK(BM_salvoAdvance4096);
+
+/*********************************************
+ * BATTERY AIM
+ * A time-on-target plan for six guns with drag, solved one gun at a
+ * time and then one gun per core. The items are guns
+ *********************************************/
+static void batteryAim(BenchmarkState & state, int numThreads)
+{
+   Battery battery;
+   for (int i = 0; i < 6; i++)
+      battery.add(Position(500.0 * i, 0.0), 800.0 + 5.0 * i);
+   ShotSpec spec;
+   long long i = 0;
+   while (state.keepRunning())
+   {
+      Position posTarget(15000.0 + (double)(i++ % 64) * 100.0, 0.0);
+      doNotOptimize(battery.aim(posTarget, spec, false, numThreads).impactTime);
+   }
+   state.setItemsProcessed(i * battery.size());
+}
+
+static void BM_batteryAim1(BenchmarkState & state)   { batteryAim(state, 1); }
+BENCHMARK(BM_batteryAim1);
+
+static void BM_batteryAimAll(BenchmarkState & state) { batteryAim(state, 0); }
+BENCHMARK(BM_batteryAimAll);
+
+/*********************************************
+ * BATTERY FIRE
+ * The same six guns flying their volley to the end at 30 frames a
+ * second, in 10ms steps, one gun at a time and then one gun per core.
+ * The items are guns
+ *********************************************/
+static void batteryFire(BenchmarkState & state, int numThreads)
+{
+   View view(100.0, 300, 200);
+   Ground ground(view);
+   Position posHowitzer(1000.0, 0.0);
+   ground.load(std::vector<double>(view.getWidth(), 0.0), posHowitzer);
+   Battery battery;
+   for (int i = 0; i < 6; i++)
+      battery.add(Position(500.0 * i, 0.0), 800.0 + 5.0 * i);
+   ShotSpec spec;
+   spec.timeStep = 0.01;
+   Volley volley = battery.aim(Position(15000.0, 0.0), spec, false, numThreads);
+   long long i = 0;
+   while (state.keepRunning())
+   {
+      battery.fire(volley, spec);
+      while (battery.isFiring())
+         battery.advance(1.0 / 30.0, ground, numThreads);
+      doNotOptimize(battery.getImpact(0).time);
+      i++;
+   }
+   state.setItemsProcessed(i * battery.size());
+}
+
+static void BM_batteryFire1(BenchmarkState & state)   { batteryFire(state, 1); }
+BENCHMARK(BM_batteryFire1);
+
+static void BM_batteryFireAll(BenchmarkState & state) { batteryFire(state, 0); }
+BENCHMARK(BM_batteryFireAll);
+
+/*********************************************
+ * SCHEDULE TIME ON TARGET
+ * The same six-gun plan through the scheduler, once with every gun's
+ * firing table cached and once with none. The cached plan is also run
+ * with the target up on a hill and down in a valley, which reads each
+ * row's way down instead of its range. The items are guns
+ *********************************************/
+static void scheduleTimeOnTarget(BenchmarkState & state, bool fCached,
+                                 double height = 0.0)
+{
+   Battery battery;
+   ShotSpec spec;
+   FiringTableCache cache;
+   for (int i = 0; i < 6; i++)
+   {
+      battery.add(Position(500.0 * i, 0.0), 800.0 + 5.0 * i);
+      spec.muzzleVelocity = battery[i].getMuzzleVelocity();
+      if (fCached)
+         cache.get(spec);
+   }
+   long long i = 0;
+   while (state.keepRunning())
+   {
+      Position posTarget(15000.0 + (double)(i++ % 64) * 100.0, height);
+      doNotOptimize(scheduleTimeOnTarget(battery, posTarget, spec, TOT_WINDOW,
+                                         false, &cache).impactTime);
+   }
+   state.setItemsProcessed(i * battery.size());
+}
+
+static void BM_scheduleCached(BenchmarkState & state) { scheduleTimeOnTarget(state, true);  }
+BENCHMARK(BM_scheduleCached);
+
+static void BM_scheduleCachedAbove(BenchmarkState & state) { scheduleTimeOnTarget(state, true, 300.0);  }
+BENCHMARK(BM_scheduleCachedAbove);
+
+static void BM_scheduleCachedBelow(BenchmarkState & state) { scheduleTimeOnTarget(state, true, -300.0); }
+BENCHMARK(BM_scheduleCachedBelow);
+
+static void BM_scheduleSolved(BenchmarkState & state) { scheduleTimeOnTarget(state, false); }
+BENCHMARK(BM_scheduleSolved);
+
+/*********************************************
+ * VECTOR STEP
+ * A salvo of shells stepped together with a simple drag. The items
+ * are shell steps
+ *********************************************/
+static void BM_vectorStep(BenchmarkState & state)
+{
+   const double dt = 0.01;
+   const double k = 0.00005;
+   const Vec2d gravity(0.0, GRAVITY);
+   static const Inputs inputs(-75.0, 75.0);
+
+   std::vector<Vec2d> positions(NUM_INPUTS);
+   std::vector<Vec2d> velocities(NUM_INPUTS);
+   for (int i = 0; i < NUM_INPUTS; i++)
+      velocities[i] = Vec2d(827.0 * sin(inputs[i] * M_PI / 180.0),
+                            827.0 * cos(inputs[i] * M_PI / 180.0));
+
+   while (state.keepRunning())
+      for (int i = 0; i < NUM_INPUTS; i++)
+      {
+         Vec2d a = gravity - velocities[i] * (k * velocities[i].length());
+         positions[i] += velocities[i] * dt + a * 0.5 * dt * dt;
+         velocities[i] += a * dt;
+      }
+   doNotOptimize(positions[0].getX());
+   state.setItemsProcessed(state.getIterations() * NUM_INPUTS);
+}
+BENCHMARK(BM_vectorStep);
@@ -0,0 +1,241 @@
+/***********************************************************************
+ * Source File:
+ *    BENCHMARK
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    The driver for the microbenchmarks. Runs every registered
+ *    benchmark long enough to get a stable number, prints ns/op and
+ *    items/s, and can save the results as a baseline or compare
+ *    against one.
+ *
+ *    benchmark [--filter=text] [--min_time=seconds]
+ *              [--save=file.json] [--compare=file.json] [--threshold=percent]
+ ************************************************************************/
+
+#include <chrono>      // for steady_clock
+#include <vector>      // for the list of benchmarks
+#include <string>      // for names
+#include <map>         // for the baseline
+#include <cstdio>      // for printf() and FILE
+#include <cstdlib>     // for atof()
+#include <cstring>     // for strncmp()
+#include "benchmark.h"
+using namespace std;
+
+volatile double benchmarkSink = 0.0;
+
+/*********************************************
+ * BENCHMARK RESULT
+ *********************************************/
+struct BenchmarkResult
+{
+   string    name;
+   long long iterations;
+   double    nsPerOp;
+   double    itemsPerSecond;
+};
+
+struct BenchmarkEntry
+{
+   const char *      name;
+   BenchmarkFunction function;
+};
+
+/*********************************************
+ * GET BENCHMARKS
+ * Built on first use so registration from other files works no
+ * matter what order the statics are initialized in.
+ *********************************************/
+static vector<BenchmarkEntry> & getBenchmarks()
+{
+   static vector<BenchmarkEntry> benchmarks;
+   return benchmarks;
+}
+
+/*********************************************
+ * BENCHMARK REGISTER
+ *********************************************/
+bool benchmarkRegister(const char * name, BenchmarkFunction function)
+{
+   BenchmarkEntry entry = { name, function };
+   getBenchmarks().push_back(entry);
+   return true;
+}
+
+/*********************************************
+ * RUN ONE
+ * Keep increasing the iterations until a run takes at least minTime.
+ * The time is the loop's alone, unless the benchmark left it early
+ *********************************************/
+static BenchmarkResult runOne(const BenchmarkEntry & entry, double minTime)
+{
+   long long iterations = 1;
+   while (true)
+   {
+      BenchmarkState state(iterations);
+      auto begin = chrono::steady_clock::now();
+      entry.function(state);
+      auto end = chrono::steady_clock::now();
+      double seconds = state.isFinished() ? state.getSeconds() :
+                       chrono::duration<double>(end - begin).count();
+
+      if (seconds >= minTime || iterations >= 1000000000LL)
+      {
+         BenchmarkResult result;
+         result.name = entry.name;
+         result.iterations = iterations;
+         result.nsPerOp = seconds * 1.0e9 / (double)iterations;
+         result.itemsPerSecond = seconds > 0.0 ?
+            (double)state.getItemsProcessed() / seconds : 0.0;
+         return result;
+      }
+
+      // aim a little past minTime, but never grow more than 10x at once
+      double multiplier = seconds > 0.0 ? minTime * 1.4 / seconds : 10.0;
+      if (multiplier > 10.0)
+         multiplier = 10.0;
+      long long next = (long long)((double)iterations * multiplier);
+      iterations = next > iterations ? next : iterations + 1;
+   }
+}
+
+/*********************************************
+ * SAVE BASELINE
+ * One benchmark per line so it can be read back without a JSON library
+ *********************************************/
+static bool saveBaseline(const char * fileName, const vector<BenchmarkResult> & results)
+{
+   FILE * file = fopen(fileName, "w");
+   if (file == nullptr)
+      return false;
+
+   fprintf(file, "{\n  \"benchmarks\": [\n");
+   for (size_t i = 0; i < results.size(); i++)
+      fprintf(file, "    { \"name\": \"%s\", \"iterations\": %lld, "
+                    "\"ns_per_op\": %.4f, \"items_per_second\": %.1f }%s\n",
+              results[i].name.c_str(), results[i].iterations,
+              results[i].nsPerOp, results[i].itemsPerSecond,
+              i + 1 < results.size() ? "," : "");
+   fprintf(file, "  ]\n}\n");
+
+   return fclose(file) == 0;
+}
+
+/*********************************************
+ * LOAD BASELINE
+ * Read back what saveBaseline() wrote: name -> ns/op
+ *********************************************/
+static bool loadBaseline(const char * fileName, map<string, double> & baseline)
+{
+   FILE * file = fopen(fileName, "r");
+   if (file == nullptr)
+      return false;
+
+   char line[512];
+   while (fgets(line, sizeof(line), file))
+   {
+      const char * pName = strstr(line, "\"name\": \"");
+      const char * pTime = strstr(line, "\"ns_per_op\": ");
+      if (pName == nullptr || pTime == nullptr)
+         continue;
+      pName += strlen("\"name\": \"");
+      const char * pEnd = strchr(pName, '"');
+      if (pEnd == nullptr)
+         continue;
+      baseline[string(pName, pEnd)] = atof(pTime + strlen("\"ns_per_op\": "));
+   }
+
+   fclose(file);
+   return true;
+}
+
+/*********************************************
+ * MAIN
+ *********************************************/
+int main(int argc, char ** argv)
+{
+   const char * filter = "";
+   const char * fileNameSave = nullptr;
+   const char * fileNameCompare = nullptr;
+   double minTime = 0.5;
+   double threshold = 10.0;
+
+   for (int i = 1; i < argc; i++)
+   {
+      if (strncmp(argv[i], "--filter=", 9) == 0)
+         filter = argv[i] + 9;
+      else if (strncmp(argv[i], "--min_time=", 11) == 0)
+         minTime = atof(argv[i] + 11);
+      else if (strncmp(argv[i], "--save=", 7) == 0)
+         fileNameSave = argv[i] + 7;
+      else if (strncmp(argv[i], "--compare=", 10) == 0)
+         fileNameCompare = argv[i] + 10;
+      else if (strncmp(argv[i], "--threshold=", 12) == 0)
+         threshold = atof(argv[i] + 12);
+      else
+      {
+         printf("usage: %s [--filter=text] [--min_time=seconds] "
+                "[--save=file.json] [--compare=file.json] [--threshold=percent]\n",
+                argv[0]);
+         return 2;
+      }
+   }
+
+   map<string, double> baseline;
+   if (fileNameCompare != nullptr && !loadBaseline(fileNameCompare, baseline))
+   {
+      printf("Unable to read the baseline %s\n", fileNameCompare);
+      return 2;
+   }
+
+   printf("%-32s %14s %12s %14s", "Benchmark", "Iterations", "ns/op", "items/s");
+   if (fileNameCompare != nullptr)
+      printf(" %10s", "change");
+   printf("\n");
+
+   vector<BenchmarkResult> results;
+   int numRegressions = 0;
+   for (const BenchmarkEntry & entry : getBenchmarks())
+   {
+      if (strstr(entry.name, filter) == nullptr)
+         continue;
+
+      BenchmarkResult result = runOne(entry, minTime);
+      results.push_back(result);
+      printf("%-32s %14lld %12.2f %14.4g", result.name.c_str(),
+             result.iterations, result.nsPerOp, result.itemsPerSecond);
+
+      if (fileNameCompare != nullptr)
+      {
+         auto it = baseline.find(result.name);
+         if (it == baseline.end() || it->second <= 0.0)
+            printf(" %10s", "new");
+         else
+         {
+            double change = (result.nsPerOp - it->second) * 100.0 / it->second;
+            printf(" %+9.1f%%", change);
+            if (change > threshold)
+            {
+               printf("  REGRESSION");
+               numRegressions++;
+            }
+         }
+      }
+      printf("\n");
+   }
+
+   if (fileNameSave != nullptr && !saveBaseline(fileNameSave, results))
+   {
+      printf("Unable to write the baseline %s\n", fileNameSave);
+      return 2;
+   }
+
+   if (numRegressions > 0)
+   {
+      printf("%d benchmark(s) slower than the baseline by more than %.1f%%\n",
+             numRegressions, threshold);
+      return 1;
+   }
+   return 0;
+}
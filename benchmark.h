@@ -0,0 +1,74 @@
+/***********************************************************************
+ * Header File:
+ *    BENCHMARK
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    A tiny microbenchmark harness in the spirit of Google Benchmark.
+ *    Each benchmark is a function that loops while keepRunning() says
+ *    so; the harness picks the number of iterations and reports the
+ *    time per operation and the items processed per second. Only the
+ *    loop is timed, so setup before it is free.
+ ************************************************************************/
+
+#pragma once
+
+#include <chrono>      // for steady_clock
+
+/*********************************************
+ * BENCHMARK STATE
+ * What one run of a benchmark sees: how many times to loop and
+ * how many items were processed along the way. The clock starts on
+ * the first keepRunning() and stops when it says to stop.
+ *********************************************/
+class BenchmarkState
+{
+public:
+   BenchmarkState(long long iterations) :
+      iterations(iterations), remaining(iterations), items(-1) {}
+
+   // loop while this is true
+   bool keepRunning()
+   {
+      if (remaining == iterations)
+         begin = std::chrono::steady_clock::now();
+      if (remaining-- > 0)
+         return true;
+      if (remaining == -1)
+         end = std::chrono::steady_clock::now();
+      return false;
+   }
+
+   // if one operation handles more than one item. Defaults to one per iteration
+   void setItemsProcessed(long long items) { this->items = items; }
+
+   long long getIterations() const { return iterations; }
+   long long getItemsProcessed() const { return items < 0 ? iterations : items; }
+
+   // whether the loop ran to the end, and how long it took
+   bool isFinished() const { return remaining < 0; }
+   double getSeconds() const { return std::chrono::duration<double>(end - begin).count(); }
+
+private:
+   long long iterations;
+   long long remaining;
+   long long items;
+   std::chrono::steady_clock::time_point begin;   // of the first iteration
+   std::chrono::steady_clock::time_point end;     // of the last
+};
+
+typedef void (*BenchmarkFunction)(BenchmarkState & state);
+
+// add a benchmark to the suite. Use BENCHMARK() rather than calling this
+bool benchmarkRegister(const char * name, BenchmarkFunction function);
+
+#define BENCHMARK(function) \
+   static bool benchmarkRegistered_##function = benchmarkRegister(#function, function)
+
+/*********************************************
+ * DO NOT OPTIMIZE
+ * Store a result where the compiler cannot prove nobody looks,
+ * so the work that produced it is not thrown away.
+ *********************************************/
+extern volatile double benchmarkSink;
+inline void doNotOptimize(double value) { benchmarkSink = value; }
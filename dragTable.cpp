@@ -0,0 +1,93 @@
+/***********************************************************************
+ * Source File:
+ *    DRAG TABLE
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    The drag deceleration of one shell, precomputed over a grid of
+ *    altitude and speed
+ ************************************************************************/
+
+#include "dragTable.h"
+#include "physics.h"   // for the atmosphere and ALTITUDE_VACUUM
+#include <cassert>     // for ASSERT
+using namespace std;
+
+/*********************************************
+ * DRAG TABLE : CONSTRUCTOR
+ * Fill the grid from sea level to the top of the atmosphere
+ *********************************************/
+DragTable::DragTable(double mass, double radius,
+                     double altitudeStep, double speedStep,
+                     InterpolationMode interpolation) :
+   mass(mass), radius(radius), interpolation(interpolation),
+   altitudeStep(altitudeStep), speedStep(speedStep),
+   maxAltitude(ALTITUDE_VACUUM), maxSpeed(DRAG_TABLE_MAX_SPEED)
+{
+   assert(mass > 0.0 && radius > 0.0);
+   assert(altitudeStep > 0.0 && speedStep > 0.0);
+
+   numAltitudes = (int)(maxAltitude / altitudeStep + 0.5) + 1;
+   numSpeeds = (int)(maxSpeed / speedStep + 0.5) + 1;
+   maxAltitude = altitudeStep * (numAltitudes - 1);
+   maxSpeed = speedStep * (numSpeeds - 1);
+   k.resize(numAltitudes * numSpeeds);
+
+   LookupCursor cursorDensity;
+   LookupCursor cursorSpeedSound;
+   for (int i = 0; i < numAltitudes; i++)
+   {
+      double altitude = altitudeStep * i;
+      double density = densityFromAltitude(altitude, cursorDensity, interpolation);
+      double speedSound = speedSoundFromAltitude(altitude, cursorSpeedSound, interpolation);
+      LookupCursor cursorDrag;
+      for (int j = 0; j < numSpeeds; j++)
+      {
+         double drag = dragFromMach(speedStep * j / speedSound, cursorDrag, interpolation);
+         k[i * numSpeeds + j] = (float)(0.5 * density * drag * areaFromRadius(radius) / mass);
+      }
+   }
+}
+
+/*********************************************
+ * DRAG TABLE : EXACT DECELERATION
+ * The same four steps Projectile::advance() takes
+ *********************************************/
+double DragTable::exactDeceleration(double altitude, double speed,
+                                    double mass, double radius,
+                                    InterpolationMode interpolation)
+{
+   LookupCursor cursorSpeedSound;
+   LookupCursor cursorDrag;
+   LookupCursor cursorDensity;
+   double drag = dragFromMach(speed / speedSoundFromAltitude(altitude, cursorSpeedSound,
+      interpolation), cursorDrag, interpolation);
+   double density = densityFromAltitude(altitude, cursorDensity, interpolation);
+   return accelerationFromForce(forceFromDrag(density, drag, radius, speed), mass);
+}
+
+/*********************************************
+ * DRAG TABLE : INTERPOLATE
+ * Bilinear between the four grid points around (altitude, speed).
+ * Altitude is clamped just as the atmosphere tables clamp it.
+ *********************************************/
+double DragTable::interpolate(double altitude, double speed) const
+{
+   double row = (altitude <= 0.0 ? 0.0 :
+                 altitude >= maxAltitude ? maxAltitude : altitude) / altitudeStep;
+   double column = (speed <= 0.0 ? 0.0 : speed) / speedStep;
+
+   int i = (int)row;
+   int j = (int)column;
+   if (i > numAltitudes - 2)
+      i = numAltitudes - 2;
+   if (j > numSpeeds - 2)
+      j = numSpeeds - 2;
+   double fRow = row - i;
+   double fColumn = column - j;
+
+   const float * below = &k[i * numSpeeds + j];
+   const float * above = below + numSpeeds;
+   return (1.0 - fRow) * ((1.0 - fColumn) * below[0] + fColumn * below[1]) +
+                 fRow  * ((1.0 - fColumn) * above[0] + fColumn * above[1]);
+}
@@ -0,0 +1,77 @@
+/***********************************************************************
+ * Header File:
+ *    DRAG TABLE
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    The drag deceleration of one shell, precomputed over a grid of
+ *    altitude and speed. One bilinear read replaces the speed of sound,
+ *    drag coefficient and density lookups and the divisions between
+ *    them in Projectile::advance().
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include "physics.h"   // for InterpolationMode
+
+#define DRAG_TABLE_ALTITUDE_STEP 1000.0   // m between rows
+#define DRAG_TABLE_SPEED_STEP    2.0      // m/s between columns
+#define DRAG_TABLE_MAX_SPEED     1500.0   // m/s, faster than this is computed exactly
+
+class TestDragTable;
+
+/*********************************************
+ * DRAG TABLE
+ * What the table holds is not the deceleration itself but the
+ * deceleration divided by speed squared,
+ *    k = 1/2 density drag area / mass
+ * so the v^2 curve is applied exactly and only k is interpolated.
+ * Nearly all the error is where the drag curve bends, since those
+ * bends fall between columns. On the default grid (81 x 751 floats,
+ * about 240KB) the table is within 3% of the exact deceleration
+ * everywhere, and within 0.6% outside Mach 0.85 to 1.1. Over the
+ * golden corpus that moves the impact point by less than 0.05% of
+ * the range. TestDragTable checks the first two bounds.
+ *********************************************/
+class DragTable
+{
+   friend ::TestDragTable;
+
+public:
+   DragTable(double mass, double radius,
+             double altitudeStep = DRAG_TABLE_ALTITUDE_STEP,
+             double speedStep    = DRAG_TABLE_SPEED_STEP,
+             InterpolationMode interpolation = INTERPOLATE_LINEAR);
+
+   // the drag deceleration in m/s^2, always positive
+   double getDeceleration(double altitude, double speed) const
+   {
+      if (speed > maxSpeed)
+         return exactDeceleration(altitude, speed, mass, radius, interpolation);
+      return interpolate(altitude, speed) * speed * speed;
+   }
+
+   // what advance() computes without a table
+   static double exactDeceleration(double altitude, double speed,
+                                   double mass, double radius,
+                                   InterpolationMode interpolation = INTERPOLATE_LINEAR);
+
+   double getMass()   const { return mass;   }
+   double getRadius() const { return radius; }
+   InterpolationMode getInterpolation() const { return interpolation; }
+
+private:
+   double interpolate(double altitude, double speed) const;
+
+   double mass;              // kg
+   double radius;            // m
+   InterpolationMode interpolation;  // how the atmosphere tables are read
+   double altitudeStep;      // m
+   double speedStep;         // m/s
+   double maxAltitude;       // m, the top row
+   double maxSpeed;          // m/s, the last column
+   int    numAltitudes;
+   int    numSpeeds;
+   std::vector<float> k;     // numAltitudes rows of numSpeeds
+};
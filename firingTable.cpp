@@ -0,0 +1,390 @@
+/***********************************************************************
+ * Source File:
+ *    FIRING TABLE
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Where one gun's shell lands, and when, for every elevation
+ ************************************************************************/
+
+#include "firingTable.h"
+#include <cmath>       // for fabs()
+#include <limits>      // for numeric_limits
+#include <cassert>
+using namespace std;
+
+/*********************************************
+ * FLY
+ * One full trajectory to a height
+ *********************************************/
+static Trajectory fly(const ShotSpec& spec, double elevation, double height,
+                      int sampleEvery = 0)
+{
+   ShotSpec shot = spec;
+   shot.elevation = elevation;
+   shot.impactHeight = height;
+   shot.sampleEvery = sampleEvery;
+   return computeTrajectory(shot);
+}
+
+/*********************************************
+ * DESCEND
+ * Every step of one elevation's way down, from the last step on the
+ * way up to FIRING_TABLE_LOWEST
+ *********************************************/
+static vector<TrajectorySample> descend(const ShotSpec& spec, double elevation)
+{
+   Trajectory trajectory = fly(spec, elevation, FIRING_TABLE_LOWEST, 1);
+   vector<TrajectorySample>& samples = trajectory.samples;
+   size_t iTop = 1;
+   while (iTop < samples.size() && samples[iTop].dy > 0.0)
+      iTop++;
+   samples.erase(samples.begin(), samples.begin() + (iTop - 1));
+   return move(samples);
+}
+
+/*********************************************
+ * CROSSING
+ * Where a row's way down passes a height, the same way
+ * computeTrajectory() finds it: between the first step below the
+ * height and the one before. Every step after the first is lower than
+ * the one before it, so the search can be a binary one
+ *********************************************/
+static bool crossing(const vector<TrajectorySample>& descent, double height,
+                     double& range, double& time)
+{
+   if (descent.size() < 2 || descent.back().y >= height)
+      return false;
+
+   int lo = 1;
+   int hi = (int)descent.size() - 1;
+   while (lo < hi)
+   {
+      int middle = (lo + hi) / 2;
+      if (descent[middle].y < height)
+         hi = middle;
+      else
+         lo = middle + 1;
+   }
+
+   const TrajectorySample& previous = descent[lo - 1];
+   const TrajectorySample& current = descent[lo];
+   if (previous.y < height)
+      return false;   // it never got up that high
+
+   double fraction = (previous.y == current.y) ? 1.0 :
+      (previous.y - height) / (previous.y - current.y);
+   range = previous.x + fraction * (current.x - previous.x);
+   time = previous.t + fraction * (current.t - previous.t);
+   return true;
+}
+
+/*********************************************
+ * FIRING TABLE : CONSTRUCTOR
+ * Fly every row, find the peak, then fly the middle of every segment
+ * to see how well the two rows around it stand in for it. With drag,
+ * each row and each middle is flown on down to FIRING_TABLE_LOWEST
+ * and its way down kept for the lookups at other heights
+ *********************************************/
+FiringTable::FiringTable(const ShotSpec& spec, double elevationStep) :
+   spec(spec), elevationStep(elevationStep), iPeak(0)
+{
+   assert(elevationStep > 0.0);
+   int numRows = (int)(90.0 / elevationStep + 0.5) + 1;
+
+   for (int i = 0; i < numRows; i++)
+   {
+      double range;
+      double time;
+      if (spec.fDrag)
+      {
+         descents.push_back(descend(spec, elevationStep * i));
+         crossing(descents.back(), 0.0, range, time);
+      }
+      else
+      {
+         Trajectory trajectory = fly(spec, elevationStep * i, 0.0);
+         range = trajectory.impactX;
+         time = trajectory.impactTime;
+      }
+      ranges.push_back(range);
+      times.push_back(time);
+      if (ranges[i] > ranges[iPeak])
+         iPeak = i;
+   }
+
+   if (spec.fDrag)
+      for (int i = 0; i + 1 < numRows; i++)
+         descentsMiddle.push_back(descend(spec, elevationStep * (i + 0.5)));
+
+   errorTimes.resize(numRows - 1);
+   errorRanges.resize(numRows - 1);
+   for (int i = 0; i + 1 < numRows; i++)
+      measure(i, 0.0, errorTimes[i], errorRanges[i]);
+}
+
+/*********************************************
+ * FIRING TABLE : ROW
+ * Where and when row i comes down through a height. False if it never
+ * climbs that high or the table does not go down that far
+ *********************************************/
+bool FiringTable::row(int i, double height, double& range, double& time) const
+{
+   if (height == 0.0)
+   {
+      range = ranges[i];
+      time = times[i];
+      return true;
+   }
+
+   if (!spec.fDrag)
+   {
+      Trajectory trajectory = fly(spec, elevationStep * i, height);
+      range = trajectory.impactX;
+      time = trajectory.impactTime;
+      return trajectory.fReached;
+   }
+
+   return crossing(descents[i], height, range, time);
+}
+
+/*********************************************
+ * FIRING TABLE : PEAK
+ * The row with the longest range at a height, that range, and the
+ * last row that climbs to the height. The steeper a row, the higher
+ * it goes, so the rows that reach a height are the ones from straight
+ * up to iLast, and a binary search finds it. The peak moves only a
+ * few rows from the one on level ground, so it is found by climbing
+ * from there
+ *********************************************/
+bool FiringTable::peak(double height, int& iPeakHeight, int& iLast,
+                       double& rangePeak) const
+{
+   iPeakHeight = iLast = -1;
+   rangePeak = 0.0;
+   double range;
+   double time;
+   if (height == 0.0)
+   {
+      iPeakHeight = iPeak;
+      iLast = (int)ranges.size() - 1;
+      rangePeak = ranges[iPeak];
+      return true;
+   }
+   if (!row(0, height, range, time))
+      return false;
+
+   // row lo reaches the height and row hi does not
+   int lo = 0;
+   int hi = (int)ranges.size();
+   while (hi - lo > 1)
+   {
+      int middle = (lo + hi) / 2;
+      if (row(middle, height, range, time))
+         lo = middle;
+      else
+         hi = middle;
+   }
+   iLast = lo;
+
+   iPeakHeight = iPeak < iLast ? iPeak : iLast;
+   row(iPeakHeight, height, rangePeak, time);
+   while (iPeakHeight > 0 && row(iPeakHeight - 1, height, range, time) &&
+          range > rangePeak)
+   {
+      iPeakHeight--;
+      rangePeak = range;
+   }
+   while (iPeakHeight < iLast && row(iPeakHeight + 1, height, range, time) &&
+          range > rangePeak)
+   {
+      iPeakHeight++;
+      rangePeak = range;
+   }
+   return true;
+}
+
+/*********************************************
+ * FIRING TABLE : MEASURE
+ * Where the middle of the segment after row i comes down through a
+ * height, and how far the two rows around it are from standing in for
+ * it. With drag the middle's way down was kept when the table was
+ * built, so this is a binary search rather than a trajectory
+ *********************************************/
+void FiringTable::measure(int i, double height, double& errorTime, double& errorRange) const
+{
+   errorTime = errorRange = numeric_limits<double>::infinity();
+   double range0;
+   double time0;
+   double range1;
+   double time1;
+   if (!row(i, height, range0, time0) || !row(i + 1, height, range1, time1))
+      return;
+
+   double elevationMiddle = elevationStep * (i + 0.5);
+   double rangeMiddle;
+   double timeMiddle;
+   if (spec.fDrag)
+   {
+      if (!crossing(descentsMiddle[i], height, rangeMiddle, timeMiddle))
+         return;
+   }
+   else
+   {
+      Trajectory trajectory = fly(spec, elevationMiddle, height);
+      if (!trajectory.fReached)
+         return;
+      rangeMiddle = trajectory.impactX;
+      timeMiddle = trajectory.impactTime;
+   }
+
+   // a middle that falls outside its own segment is past the peak
+   double span = range1 - range0;
+   double fraction = (span == 0.0) ? -1.0 : (rangeMiddle - range0) / span;
+   if (fraction < 0.0 || fraction > 1.0)
+      return;
+
+   // the range the interpolated elevation gives, assuming the
+   // segment's slope
+   double elevation = elevationStep * (i + fraction);
+   double time = time0 + fraction * (time1 - time0);
+   errorTime = fabs(time - timeMiddle);
+   errorRange = fabs(elevation - elevationMiddle) * fabs(span) / elevationStep;
+}
+
+/*********************************************
+ * FIRING TABLE : LOOKUP
+ * Work with the distance as a positive number and mirror the answer
+ * at the end, the same as the solver. Rows from straight up to the
+ * peak go up in range; rows from the peak to the last one that climbs
+ * high enough go down
+ *********************************************/
+FiringSolution FiringTable::lookup(double distance, double height, bool fHighAngle,
+                                   double& errorTime, double& errorRange,
+                                   double& maxRange) const
+{
+   FiringSolution solution;
+   double sign = distance < 0.0 ? -1.0 : 1.0;
+   double target = fabs(distance);
+   errorTime = errorRange = numeric_limits<double>::infinity();
+   int iPeakHeight;
+   int iLast;
+   if (!peak(height, iPeakHeight, iLast, maxRange))
+      return solution;
+
+   // find the segment whose ends are on either side of the target
+   int lo = fHighAngle ? 0 : iPeakHeight;
+   int hi = fHighAngle ? iPeakHeight : iLast;
+   double direction = fHighAngle ? 1.0 : -1.0;
+   double rangeLo;
+   double rangeHi;
+   double time;
+   row(lo, height, rangeLo, time);
+   row(hi, height, rangeHi, time);
+   if (hi == lo ||
+       target * direction < rangeLo * direction ||
+       target * direction > rangeHi * direction)
+      return solution;
+   while (hi - lo > 1)
+   {
+      int middle = (lo + hi) / 2;
+      double rangeMiddle;
+      row(middle, height, rangeMiddle, time);
+      if (rangeMiddle * direction <= target * direction)
+         lo = middle;
+      else
+         hi = middle;
+   }
+
+   double range0;
+   double time0;
+   double range1;
+   double time1;
+   row(lo, height, range0, time0);
+   row(lo + 1, height, range1, time1);
+   double span = range1 - range0;
+   double fraction = (span == 0.0) ? 0.0 : (target - range0) / span;
+   solution.fValid = true;
+   solution.elevation = sign * elevationStep * (lo + fraction);
+   solution.impactX = sign * target;
+   solution.timeOfFlight = time0 + fraction * (time1 - time0);
+   if (height == 0.0)
+   {
+      errorTime = errorTimes[lo];
+      errorRange = errorRanges[lo];
+   }
+   else
+      measure(lo, height, errorTime, errorRange);
+   return solution;
+}
+
+/*********************************************
+ * FIRING TABLE : GET MAX RANGE
+ *********************************************/
+double FiringTable::getMaxRange(double height) const
+{
+   int iPeakHeight;
+   int iLast;
+   double range;
+   peak(height, iPeakHeight, iLast, range);
+   return range;
+}
+
+/*********************************************
+ * FIRING TABLE : MATCHES
+ * Everything computeTrajectory() reads except the elevation and the
+ * impact height
+ *********************************************/
+bool FiringTable::matches(const ShotSpec& rhs) const
+{
+   return spec.muzzleVelocity == rhs.muzzleVelocity &&
+          spec.mass           == rhs.mass           &&
+          spec.radius         == rhs.radius         &&
+          spec.timeStep       == rhs.timeStep       &&
+          spec.fDrag          == rhs.fDrag          &&
+          spec.interpolation  == rhs.interpolation  &&
+          spec.pDragTable     == rhs.pDragTable     &&
+          spec.pAtmosphere    == rhs.pAtmosphere;
+}
+
+/*********************************************
+ * FIRING TABLE CACHE : FIND
+ *********************************************/
+const FiringTable* FiringTableCache::find(const ShotSpec& spec) const
+{
+   lock_guard<mutex> guard(lock);
+   for (const unique_ptr<FiringTable>& pTable : tables)
+      if (pTable->matches(spec))
+         return pTable.get();
+   return nullptr;
+}
+
+/*********************************************
+ * FIRING TABLE CACHE : GET
+ * The table is built outside the lock so other threads can keep
+ * reading. If two threads build the same one, the first to finish wins
+ *********************************************/
+const FiringTable& FiringTableCache::get(const ShotSpec& spec)
+{
+   const FiringTable* pFound = find(spec);
+   if (pFound != nullptr)
+      return *pFound;
+
+   unique_ptr<FiringTable> pTable(new FiringTable(spec));
+
+   lock_guard<mutex> guard(lock);
+   for (const unique_ptr<FiringTable>& pOther : tables)
+      if (pOther->matches(spec))
+         return *pOther;
+   tables.push_back(move(pTable));
+   return *tables.back();
+}
+
+/*********************************************
+ * FIRING TABLE CACHE : SIZE
+ *********************************************/
+int FiringTableCache::size() const
+{
+   lock_guard<mutex> guard(lock);
+   return (int)tables.size();
+}
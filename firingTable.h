@@ -0,0 +1,122 @@
+/***********************************************************************
+ * Header File:
+ *    FIRING TABLE
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Where one gun's shell lands, and when, for every elevation on a
+ *    fine grid. Looking a distance up is a binary search instead of
+ *    the handful of full trajectories the solver flies.
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <memory>      // for unique_ptr
+#include <mutex>       // for the cache
+#include "solver.h"    // for FiringSolution and ShotSpec
+
+#define FIRING_TABLE_STEP   0.25       // degrees between rows
+#define FIRING_TABLE_LOWEST -20000.0   // m, how far below the muzzle the rows go
+
+class TestFiringTable;
+
+/*********************************************
+ * FIRING TABLE
+ * One row per elevation from straight up to horizontal. The range
+ * rises to the longest shot and falls again, so the rows before that
+ * peak are the high angle branch and the rows after it the flat one,
+ * and each is sorted by range. A distance is read by interpolating
+ * linearly between the two rows around it.
+ *
+ * While it is built, every segment is checked against a trajectory
+ * flown at its middle elevation. How far off the interpolated time
+ * and landing point were is kept with the segment, so a caller can
+ * tell whether the table is close enough for what it needs. For the
+ * default shell at 827 m/s, nine segments in ten are within a meter
+ * and 0.06s. The poor ones are the flattest shots, a few kilometers
+ * long, which are in the air for so few time steps that their range
+ * does not change smoothly from one row to the next.
+ *
+ * A target above or below the gun is read from the same rows. Each
+ * row, and the middle of each segment, keeps every step of its way
+ * down, so where it passes any height is a binary search. The ranges
+ * at that height are worked out for the lookup, and the segment it
+ * lands in is checked against its middle at that height.
+ *********************************************/
+class FiringTable
+{
+   friend ::TestFiringTable;
+
+public:
+   FiringTable(const ShotSpec& spec, double elevationStep = FIRING_TABLE_STEP);
+
+   // the elevation that lands a shell distance meters away (negative
+   // is to the left) and height meters above the muzzle (negative is
+   // below). errorTime and errorRange are how far the segment it came
+   // from was from a real trajectory, in s and m. maxRange is the
+   // longest shot there is to that height, found on the way
+   FiringSolution lookup(double distance, double height, bool fHighAngle,
+                         double& errorTime, double& errorRange,
+                         double& maxRange) const;
+   FiringSolution lookup(double distance, double height, bool fHighAngle,
+                         double& errorTime, double& errorRange) const
+   {
+      double maxRange;
+      return lookup(distance, height, fHighAngle, errorTime, errorRange, maxRange);
+   }
+   FiringSolution lookup(double distance, double height, bool fHighAngle = false) const
+   {
+      double errorTime;
+      double errorRange;
+      return lookup(distance, height, fHighAngle, errorTime, errorRange);
+   }
+
+   // was this table built for that shot? The elevation and the impact
+   // height do not matter
+   bool matches(const ShotSpec& spec) const;
+
+   // the longest shot there is to a height above the muzzle
+   double getMaxRange(double height = 0.0) const;
+
+private:
+   bool row(int i, double height, double& range, double& time) const;
+   bool peak(double height, int& iPeakHeight, int& iLast, double& rangePeak) const;
+   void measure(int i, double height, double& errorTime, double& errorRange) const;
+
+   ShotSpec spec;                    // what the rows were flown with
+   double elevationStep;             // degrees
+   int iPeak;                        // the row with the longest range
+   std::vector<double> ranges;       // m, one per row
+   std::vector<double> times;        // s, one per row
+   std::vector<double> errorTimes;   // s, one per segment between rows
+   std::vector<double> errorRanges;  // m, one per segment between rows
+
+   // each row's steps from the top of its flight down to
+   // FIRING_TABLE_LOWEST, and the same for the middle of each segment.
+   // Empty without drag: those are solved in closed form instead
+   std::vector<std::vector<TrajectorySample>> descents;
+   std::vector<std::vector<TrajectorySample>> descentsMiddle;
+};
+
+/*********************************************
+ * FIRING TABLE CACHE
+ * The tables for every gun that has asked for one, kept for the life
+ * of the cache. Safe to share between threads. A table is never
+ * freed or moved once it is built, so the pointers stay good.
+ *********************************************/
+class FiringTableCache
+{
+public:
+   // the table for this shot, or nullptr if none has been built
+   const FiringTable* find(const ShotSpec& spec) const;
+
+   // the table for this shot, building it the first time
+   const FiringTable& get(const ShotSpec& spec);
+
+   int size() const;
+
+private:
+   mutable std::mutex lock;
+   std::vector<std::unique_ptr<FiringTable>> tables;
+};
@@ -0,0 +1,229 @@
+/***********************************************************************
+ * Source File:
+ *    GOLDEN
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    A corpus of reference shots and the code to replay it.
+ *
+ *    The file is little-endian no matter what machine wrote it:
+ *       "M777GOLD" u32 version  u32 numShots
+ *       then per shot:
+ *          f64 elevation  f64 muzzleVelocity  f64 mass  f64 radius
+ *          f64 timeStep   i32 sampleEvery     u32 fDrag
+ *          f64 impactX    f64 impactTime      i32 numSteps
+ *          u32 numSamples then numSamples x (f64 t, x, y, dx, dy)
+ ************************************************************************/
+
+#include "golden.h"
+#include "parallel.h"  // for parallelFor()
+#include "littleEndian.h"
+#include <cstring>     // for memcmp()
+#include <cmath>       // for fabs()
+using namespace std;
+
+const char     GOLDEN_MAGIC[8] = { 'M', '7', '7', '7', 'G', 'O', 'L', 'D' };
+const uint32_t GOLDEN_VERSION  = 2;
+
+/*********************************************
+ * GOLDEN CORPUS SPECS
+ * Both sides of the gun, low and high angles, and two shells
+ *********************************************/
+vector<ShotSpec> goldenCorpusSpecs()
+{
+   const double elevations[] = { -45.0, 10.0, 25.0, 40.0, 55.0, 70.0 };
+   const double velocities[] = { 300.0, 550.0, 827.0 };
+   const double shells[][2]  =
+   {
+      { 46.7, 0.077545 },   // M795
+      { 30.0, 0.070000 }    // a lighter, narrower round
+   };
+
+   vector<ShotSpec> specs;
+   for (const double * shell : shells)
+      for (double velocity : velocities)
+         for (double elevation : elevations)
+         {
+            ShotSpec spec(elevation, velocity);
+            spec.mass = shell[0];
+            spec.radius = shell[1];
+            spec.timeStep = 0.5;
+            spec.sampleEvery = 10;
+            specs.push_back(spec);
+         }
+   return specs;
+}
+
+/*********************************************
+ * GENERATE GOLDEN CORPUS
+ *********************************************/
+vector<GoldenShot> generateGoldenCorpus(const vector<ShotSpec>& specs, int numThreads)
+{
+   vector<GoldenShot> shots(specs.size());
+   parallelFor((int)specs.size(), numThreads, [&](int i)
+   {
+      shots[i].spec = specs[i];
+      shots[i].trajectory = computeTrajectory(specs[i]);
+   });
+   return shots;
+}
+
+/*********************************************
+ * WRITE GOLDEN CORPUS
+ *********************************************/
+bool writeGoldenCorpus(ostream& out, const vector<GoldenShot>& shots)
+{
+   out.write(GOLDEN_MAGIC, sizeof(GOLDEN_MAGIC));
+   writeU32(out, GOLDEN_VERSION);
+   writeU32(out, (uint32_t)shots.size());
+
+   for (const GoldenShot& shot : shots)
+   {
+      writeF64(out, shot.spec.elevation);
+      writeF64(out, shot.spec.muzzleVelocity);
+      writeF64(out, shot.spec.mass);
+      writeF64(out, shot.spec.radius);
+      writeF64(out, shot.spec.timeStep);
+      writeU32(out, (uint32_t)shot.spec.sampleEvery);
+      writeU32(out, shot.spec.fDrag ? 1 : 0);
+
+      writeF64(out, shot.trajectory.impactX);
+      writeF64(out, shot.trajectory.impactTime);
+      writeU32(out, (uint32_t)shot.trajectory.numSteps);
+      writeU32(out, (uint32_t)shot.trajectory.samples.size());
+      for (const TrajectorySample& sample : shot.trajectory.samples)
+      {
+         writeF64(out, sample.t);
+         writeF64(out, sample.x);
+         writeF64(out, sample.y);
+         writeF64(out, sample.dx);
+         writeF64(out, sample.dy);
+      }
+   }
+
+   return (bool)out;
+}
+
+/*********************************************
+ * READ GOLDEN CORPUS
+ *********************************************/
+bool readGoldenCorpus(istream& in, vector<GoldenShot>& shots)
+{
+   shots.clear();
+
+   char magic[sizeof(GOLDEN_MAGIC)];
+   uint32_t version;
+   uint32_t numShots;
+   if (!in.read(magic, sizeof(magic)) ||
+       memcmp(magic, GOLDEN_MAGIC, sizeof(magic)) != 0 ||
+       !readU32(in, version) || version != GOLDEN_VERSION ||
+       !readU32(in, numShots))
+      return false;
+
+   for (uint32_t i = 0; i < numShots; i++)
+   {
+      GoldenShot shot;
+      uint32_t numSamples;
+      uint32_t fDrag;
+      if (!readF64(in, shot.spec.elevation)          ||
+          !readF64(in, shot.spec.muzzleVelocity)     ||
+          !readF64(in, shot.spec.mass)               ||
+          !readF64(in, shot.spec.radius)             ||
+          !readF64(in, shot.spec.timeStep)           ||
+          !readI32(in, shot.spec.sampleEvery)        ||
+          !readU32(in, fDrag)                        ||
+          !readF64(in, shot.trajectory.impactX)      ||
+          !readF64(in, shot.trajectory.impactTime)   ||
+          !readI32(in, shot.trajectory.numSteps)     ||
+          !readU32(in, numSamples) || numSamples > MAX_TRAJECTORY_STEPS + 1)
+         return false;
+
+      shot.spec.fDrag = fDrag != 0;
+      shot.trajectory.samples.resize(numSamples);
+      for (TrajectorySample& sample : shot.trajectory.samples)
+         if (!readF64(in, sample.t)  ||
+             !readF64(in, sample.x)  ||
+             !readF64(in, sample.y)  ||
+             !readF64(in, sample.dx) ||
+             !readF64(in, sample.dy))
+            return false;
+
+      shots.push_back(shot);
+   }
+
+   return true;
+}
+
+/*********************************************
+ * COMPARE VALUE
+ * Keep track of the worst difference, and remember the first value
+ * that is out of tolerance
+ *********************************************/
+static void compareValue(GoldenDiff& diff, const GoldenTolerance& tolerance,
+                         const char* field, int sample,
+                         double expected, double actual)
+{
+   uint64_t ulps = ulpDistance(expected, actual);
+   double absolute = fabs(expected - actual);
+   if (ulps > diff.maxUlps)
+      diff.maxUlps = ulps;
+   if (absolute > diff.maxAbsolute)
+      diff.maxAbsolute = absolute;
+
+   if (diff.fMatch && ulps > tolerance.ulps && !(absolute <= tolerance.absolute))
+   {
+      diff.fMatch = false;
+      diff.field = field;
+      diff.sample = sample;
+      diff.expected = expected;
+      diff.actual = actual;
+   }
+}
+
+/*********************************************
+ * COMPARE TRAJECTORY
+ *********************************************/
+GoldenDiff compareTrajectory(const Trajectory& expected, const Trajectory& actual,
+                             const GoldenTolerance& tolerance)
+{
+   GoldenDiff diff;
+
+   compareValue(diff, tolerance, "impactX",    -1, expected.impactX,    actual.impactX);
+   compareValue(diff, tolerance, "impactTime", -1, expected.impactTime, actual.impactTime);
+
+   // a different number of steps or samples means the shell flew another path
+   GoldenTolerance exact;
+   compareValue(diff, exact, "numSteps",   -1, expected.numSteps, actual.numSteps);
+   compareValue(diff, exact, "numSamples", -1, (double)expected.samples.size(),
+                                               (double)actual.samples.size());
+
+   size_t numSamples = min(expected.samples.size(), actual.samples.size());
+   for (size_t i = 0; i < numSamples; i++)
+   {
+      const TrajectorySample& e = expected.samples[i];
+      const TrajectorySample& a = actual.samples[i];
+      compareValue(diff, tolerance, "t",  (int)i, e.t,  a.t);
+      compareValue(diff, tolerance, "x",  (int)i, e.x,  a.x);
+      compareValue(diff, tolerance, "y",  (int)i, e.y,  a.y);
+      compareValue(diff, tolerance, "dx", (int)i, e.dx, a.dx);
+      compareValue(diff, tolerance, "dy", (int)i, e.dy, a.dy);
+   }
+
+   return diff;
+}
+
+/*********************************************
+ * REPLAY GOLDEN CORPUS
+ *********************************************/
+vector<GoldenDiff> replayGoldenCorpus(const vector<GoldenShot>& shots,
+                                      const GoldenTolerance& tolerance,
+                                      int numThreads)
+{
+   vector<GoldenDiff> diffs(shots.size());
+   parallelFor((int)shots.size(), numThreads, [&](int i)
+   {
+      diffs[i] = compareTrajectory(shots[i].trajectory,
+                                   computeTrajectory(shots[i].spec), tolerance);
+   });
+   return diffs;
+}
@@ -0,0 +1,80 @@
+/***********************************************************************
+ * Header File:
+ *    GOLDEN
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    A corpus of reference shots. Each one remembers the spec it was
+ *    fired with and the trajectory it flew, so any change to the
+ *    integrator or the tables can be replayed against it and every
+ *    difference measured in ULPs.
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include "trajectory.h"
+
+/*********************************************
+ * GOLDEN SHOT
+ *********************************************/
+struct GoldenShot
+{
+   ShotSpec   spec;
+   Trajectory trajectory;
+};
+
+/*********************************************
+ * GOLDEN TOLERANCE
+ * A value matches if it is within ulps of the reference, or within
+ * absolute of it. The step and sample counts must always be equal.
+ *********************************************/
+struct GoldenTolerance
+{
+   GoldenTolerance() : ulps(0), absolute(0.0) {}
+   GoldenTolerance(uint64_t ulps, double absolute) : ulps(ulps), absolute(absolute) {}
+
+   uint64_t ulps;
+   double   absolute;
+};
+
+/*********************************************
+ * GOLDEN DIFF
+ * How one replayed shot compares with its reference. When it does
+ * not match, the first value out of tolerance is described.
+ *********************************************/
+struct GoldenDiff
+{
+   GoldenDiff() : fMatch(true), sample(-1), expected(0.0), actual(0.0),
+                  maxUlps(0), maxAbsolute(0.0) {}
+
+   bool        fMatch;
+   std::string field;       // such as "impactX" or "dy"
+   int         sample;      // which sample, -1 for the impact fields
+   double      expected;
+   double      actual;
+   uint64_t    maxUlps;     // worst over every value compared
+   double      maxAbsolute;
+};
+
+// the reference grid: elevation x muzzle velocity x shell
+std::vector<ShotSpec> goldenCorpusSpecs();
+
+// fly every spec. numThreads of 0 means one per core
+std::vector<GoldenShot> generateGoldenCorpus(const std::vector<ShotSpec>& specs,
+                                             int numThreads = 0);
+
+// the binary corpus format. Returns false on a bad or truncated stream
+bool writeGoldenCorpus(std::ostream& out, const std::vector<GoldenShot>& shots);
+bool readGoldenCorpus(std::istream& in, std::vector<GoldenShot>& shots);
+
+// compare one trajectory with its reference
+GoldenDiff compareTrajectory(const Trajectory& expected, const Trajectory& actual,
+                             const GoldenTolerance& tolerance);
+
+// fly every shot in the corpus again and compare, one diff per shot
+std::vector<GoldenDiff> replayGoldenCorpus(const std::vector<GoldenShot>& shots,
+                                           const GoldenTolerance& tolerance,
+                                           int numThreads = 0);
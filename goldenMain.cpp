@@ -0,0 +1,121 @@
+/***********************************************************************
+ * Source File:
+ *    GOLDEN MAIN
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Check the physics against the reference corpus, or write a new
+ *    corpus after a change we meant to make.
+ *
+ *    golden [--corpus=golden.bin] [--ulps=n] [--tolerance=x] [--threads=n]
+ *    golden --generate [--corpus=golden.bin]
+ ************************************************************************/
+
+#include <fstream>     // for ifstream and ofstream
+#include <chrono>      // for steady_clock
+#include <cstdio>      // for printf()
+#include <cstring>     // for strncmp()
+#include <cstdlib>     // for atof()
+#include "golden.h"
+using namespace std;
+
+/*********************************************
+ * GENERATE
+ *********************************************/
+static int generate(const char* fileName, int numThreads)
+{
+   vector<GoldenShot> shots = generateGoldenCorpus(goldenCorpusSpecs(), numThreads);
+
+   ofstream fout(fileName, ios::binary);
+   if (!fout.is_open() || !writeGoldenCorpus(fout, shots))
+   {
+      printf("Unable to write %s\n", fileName);
+      return 2;
+   }
+
+   printf("Wrote %d shots to %s\n", (int)shots.size(), fileName);
+   return 0;
+}
+
+/*********************************************
+ * CHECK
+ * Replay the corpus and describe every shot that moved
+ *********************************************/
+static int check(const char* fileName, const GoldenTolerance& tolerance, int numThreads)
+{
+   ifstream fin(fileName, ios::binary);
+   vector<GoldenShot> shots;
+   if (!fin.is_open() || !readGoldenCorpus(fin, shots))
+   {
+      printf("Unable to read %s\n", fileName);
+      return 2;
+   }
+
+   auto begin = chrono::steady_clock::now();
+   vector<GoldenDiff> diffs = replayGoldenCorpus(shots, tolerance, numThreads);
+   auto end = chrono::steady_clock::now();
+
+   int numDiffer = 0;
+   uint64_t maxUlps = 0;
+   double maxAbsolute = 0.0;
+   for (size_t i = 0; i < diffs.size(); i++)
+   {
+      const GoldenDiff& diff = diffs[i];
+      maxUlps = max(maxUlps, diff.maxUlps);
+      maxAbsolute = max(maxAbsolute, diff.maxAbsolute);
+      if (diff.fMatch)
+         continue;
+
+      const ShotSpec& spec = shots[i].spec;
+      printf("shot %3d  elevation %6.1f  velocity %6.1f  mass %5.1f  radius %.6f\n",
+             (int)i, spec.elevation, spec.muzzleVelocity, spec.mass, spec.radius);
+      if (diff.sample < 0)
+         printf("\t%s: expected %.17g got %.17g\n",
+                diff.field.c_str(), diff.expected, diff.actual);
+      else
+         printf("\tsample %d %s: expected %.17g got %.17g\n",
+                diff.sample, diff.field.c_str(), diff.expected, diff.actual);
+      printf("\tworst: %llu ulps, %g absolute\n",
+             (unsigned long long)diff.maxUlps, diff.maxAbsolute);
+      numDiffer++;
+   }
+
+   printf("%d of %d shots differ. Worst %llu ulps, %g absolute. %.2f ms\n",
+          numDiffer, (int)shots.size(), (unsigned long long)maxUlps, maxAbsolute,
+          chrono::duration<double, milli>(end - begin).count());
+   return numDiffer == 0 ? 0 : 1;
+}
+
+/*********************************************
+ * MAIN
+ *********************************************/
+int main(int argc, char** argv)
+{
+   const char* fileName = "golden.bin";
+   bool fGenerate = false;
+   GoldenTolerance tolerance;
+   int numThreads = 0;
+
+   for (int i = 1; i < argc; i++)
+   {
+      if (strcmp(argv[i], "--generate") == 0)
+         fGenerate = true;
+      else if (strncmp(argv[i], "--corpus=", 9) == 0)
+         fileName = argv[i] + 9;
+      else if (strncmp(argv[i], "--ulps=", 7) == 0)
+         tolerance.ulps = (uint64_t)atof(argv[i] + 7);
+      else if (strncmp(argv[i], "--tolerance=", 12) == 0)
+         tolerance.absolute = atof(argv[i] + 12);
+      else if (strncmp(argv[i], "--threads=", 10) == 0)
+         numThreads = atoi(argv[i] + 10);
+      else
+      {
+         printf("usage: %s [--generate] [--corpus=file] [--ulps=n] "
+                "[--tolerance=x] [--threads=n]\n", argv[0]);
+         return 2;
+      }
+   }
+
+   return fGenerate ? generate(fileName, numThreads) :
+                      check(fileName, tolerance, numThreads);
+}
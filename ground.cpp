@@ -9,7 +9,9 @@
 
 #include "ground.h"   // for the Ground class definition
 #include "uiDraw.h"   // for random() and drawLine()
+#include "profile.h"  // for PROFILE_SCOPE
 #include <cassert>
+using namespace std;
 
 const int WIDTH_HOWITZER = 14;
 
@@ -23,14 +25,14 @@ const double TEXTURE = 3.0;   // size of the small features such as rocks
  * GROUND :: CONSTRUCTOR
  * Set everything up, but do not initialize it yet.
  ************************************************************************/
-Ground::Ground(const Position & posUpperRight) :
-   posUpperRight(posUpperRight),
+Ground::Ground(const View & view) :
+   view(view),
    iHowitzer(0),
    iTarget(0),
    ground(nullptr)
 {
    // allocate the array
-   ground = new double[(int)posUpperRight.getPixelsX()];
+   ground = new double[view.getWidth()];
 }
 
 /************************************************************************
@@ -39,14 +41,12 @@ Ground::Ground(const Position & posUpperRight) :
  ************************************************************************/
 double Ground::getElevationMeters(const Position& pos) const
 {
-   Position posImpact(pos);
+   double xPixels = view.getPixelsX(pos);
 
-   if (pos.getPixelsX() >= 0.0 && pos.getPixelsX() < (int)posUpperRight.getPixelsX())
-      posImpact.setPixelsY(ground[(int)pos.getPixelsX()]);
+   if (xPixels >= 0.0 && xPixels < view.getWidth())
+      return view.getMeters(ground[(int)xPixels]);
    else
-      posImpact.setPixelsY(0.0);
-
-   return posImpact.getMetersY();
+      return view.getMeters(0.0);
 }
 
 /************************************************************************
@@ -55,11 +55,8 @@ double Ground::getElevationMeters(const Position& pos) const
  ************************************************************************/
 Position Ground::getTarget() const
 {
-   assert(iTarget >= 0 && iTarget < posUpperRight.getPixelsX());
-   Position posTarget;
-   posTarget.setPixelsX(iTarget);
-   posTarget.setPixelsY(ground[iTarget]);
-   return posTarget;
+   assert(iTarget >= 0 && iTarget < view.getWidth());
+   return view.fromPixels(iTarget, ground[iTarget]);
 }
 
 
@@ -71,13 +68,34 @@ Position Ground::getTarget() const
  * and not const-by-reference for this purpose.
  ************************************************************************/
  void Ground :: reset(Position & posHowitzer)
+ {
+   vector<Position> posHowitzers(1, posHowitzer);
+   reset(posHowitzers);
+   posHowitzer = posHowitzers[0];
+ }
+
+/************************************************************************
+ * GROUND :: RESET
+ * Create a new ground with room for every gun in the battery. Each one
+ * sits on its own flat spot and gets its Y position from it.
+ ************************************************************************/
+ void Ground :: reset(vector<Position> & posHowitzers)
  {
    // remember the integer width for later. It will come in handy
-   int width = (int)posUpperRight.getPixelsX();
+   int width = view.getWidth();
    assert(width > 0);
+   assert(!posHowitzers.empty());
+
+   // where every gun is, in pixels
+   vector<int> iHowitzers;
+   for (const Position & pos : posHowitzers)
+   {
+      iHowitzers.push_back((int)(view.getPixelsX(pos)));
+      assert(iHowitzers.back() >= 0 && iHowitzers.back() < width);
+   }
 
    // determine the location of the target
-   iHowitzer = (int)(posHowitzer.getPixelsX());
+   iHowitzer = iHowitzers[0];
    if (iHowitzer > width / 2)
       iTarget = random((int)(width * 0.05), (int)(width * 0.45));
    else
@@ -87,24 +105,27 @@ Position Ground::getTarget() const
 
    // determine the maximum and minimum altitude
    Position posMinimum(0.0, MIN_ALTITUDE);
-   Position posMaximum(posUpperRight.getMetersX(), MAX_ALTITUDE);
+   Position posMaximum(view.getUpperRight().getMetersX(), MAX_ALTITUDE);
 
    // give each location on the ground an elevation
-   ground[0] = posMinimum.getPixelsY(); // the initial elevation is low
+   ground[0] = view.getPixelsY(posMinimum); // the initial elevation is low
    double dy = MAX_SLOPE / 2.0;  // the initial slope is heavily biased to up
    for (int i = 1; i < width; i++)
    {
-      // put the howitzer on flat ground
-      if (i > iHowitzer - WIDTH_HOWITZER / 2 &&
-         i < iHowitzer + WIDTH_HOWITZER / 2)
+      // put every howitzer on flat ground
+      bool fFlat = false;
+      for (int iGun : iHowitzers)
+         fFlat = fFlat || (i > iGun - WIDTH_HOWITZER / 2 &&
+                           i < iGun + WIDTH_HOWITZER / 2);
+      if (fFlat)
       {
          ground[i] = ground[i - 1];
       }
       else
       { 
          // what percentage of the elevation were we at?
-         double percent = (ground[i - 1] - posMinimum.getPixelsY()) /
-                          (posMaximum.getPixelsY() - posMinimum.getPixelsY());
+         double percent = (ground[i - 1] - view.getPixelsY(posMinimum)) /
+                          (view.getPixelsY(posMaximum) - view.getPixelsY(posMinimum));
 
          // set the slope of the ground
          dy += (1.0 - percent) * random(0.0, LUMPINESS) +
@@ -118,12 +139,36 @@ Position Ground::getTarget() const
          ground[i] = ground[i - 1] + dy + random(-TEXTURE, TEXTURE);
          if (ground[i] < 0.0)
             ground[i] = 0.0;
-         assert(ground[i] >= 0.0 && ground[i] <= posUpperRight.getPixelsY());
+         assert(ground[i] >= 0.0 && ground[i] <= view.getHeight());
       }
    }
 
-   // set the howitzer's elevation
-   posHowitzer.setPixelsY(ground[iHowitzer]);
+   // set each howitzer's elevation
+   for (size_t i = 0; i < posHowitzers.size(); i++)
+      posHowitzers[i].setMetersY(view.getMeters(ground[iHowitzers[i]]));
+}
+
+/************************************************************************
+ * GROUND :: LOAD
+ * Take the ground as it is, howitzer and all. Only the target is
+ * chosen, half way across the far side so the same ground always has
+ * the same target
+ ************************************************************************/
+void Ground :: load(const vector<double> & elevations, Position & posHowitzer)
+{
+   int width = view.getWidth();
+   assert((int)elevations.size() == width);
+
+   for (int i = 0; i < width; i++)
+   {
+      ground[i] = view.getPixelsY(Position(0.0, elevations[i]));
+      assert(ground[i] >= 0.0);
+   }
+
+   iHowitzer = (int)(view.getPixelsX(posHowitzer));
+   assert(iHowitzer >= 0 && iHowitzer < width);
+   iTarget = (iHowitzer > width / 2) ? width / 4 : width * 3 / 4;
+   posHowitzer.setMetersY(view.getMeters(ground[iHowitzer]));
 }
 
 /*****************************************************************
@@ -132,24 +177,23 @@ Position Ground::getTarget() const
  ****************************************************************/
 void Ground::draw(ogstream & gout) const
 {
+   PROFILE_SCOPE(PROFILE_GROUND_DRAW);
+
    // put the meter markers along the side
-   for (Position pos(0.0, 1000.0); pos.getPixelsY() < posUpperRight.getPixelsY(); pos.addMetersY(1000.0))
+   for (Position pos(0.0, 1000.0); view.getPixelsY(pos) < view.getHeight(); pos.addMetersY(1000.0))
    {
       Position posLeft(pos);
       Position posRight(pos);
-      posRight.setPixelsX(posUpperRight.getPixelsX());
+      posRight.setMetersX(view.getMeters(view.getWidth()));
       gout.drawLine(posLeft, posRight, 0.85, 0.85, 0.85);
    }
 
    // iterate through the entire ground and draw it all
-   int width = (int)posUpperRight.getPixelsX();
+   int width = view.getWidth();
    for (int i = 0; i < width; i++)
    {
-      Position posBottom;
-      Position posTop;
-      posBottom.setPixelsX((double)i);
-      posTop.setPixelsX((double)i + 1.0);
-      posTop.setPixelsY(ground[i]);
+      Position posBottom = view.fromPixels((double)i, 0.0);
+      Position posTop = view.fromPixels((double)i + 1.0, ground[i]);
       gout.drawRectangle(posBottom, posTop, 0.6 /*red*/, 0.4 /*green*/, 0.2 /*blue*/);
    }
 
@@ -158,31 +202,26 @@ void Ground::draw(ogstream & gout) const
    gout.drawTarget(posTarget);
 
    // put the kilometer markers along the bottom
-   for (Position pos(1000.0, 0.0); pos.getPixelsX() < posUpperRight.getPixelsX(); pos.addMetersX(1000.0))
+   for (Position pos(1000.0, 0.0); view.getPixelsX(pos) < view.getWidth(); pos.addMetersX(1000.0))
    {
       Position posBottom(pos);
-      Position posTop(pos);
-      posTop.addPixelsY(10);
+      Position posTop = view.offset(pos, 0.0, 10.0);
       gout.drawLine(posTop, posBottom, 0.6, 0.6, 0.6);
    }
 
    // put the kilometer labels along the bottom
-   for (Position pos(5000.0, 0.0); pos.getPixelsX() < posUpperRight.getPixelsX(); pos.addMetersX(5000.0))
+   for (Position pos(5000.0, 0.0); view.getPixelsX(pos) < view.getWidth(); pos.addMetersX(5000.0))
    {
-      Position posText(pos);
-      posText.addPixelsY(15);
-      posText.addPixelsX(-10);
+      Position posText = view.offset(pos, -10.0, 15.0);
 
       gout = posText;
       gout << (int)(pos.getMetersX() / 1000.0) << "km";
    }
 
    // draw the altitude labels along the side
-   for (Position pos(0.0, 2000.0); pos.getPixelsY() < posUpperRight.getPixelsY(); pos.addMetersY(2000.0))
+   for (Position pos(0.0, 2000.0); view.getPixelsY(pos) < view.getHeight(); pos.addMetersY(2000.0))
    {
-      Position posText(pos);
-      posText.addPixelsX(5);
-      posText.addPixelsY(-2);
+      Position posText = view.offset(pos, 5.0, -2.0);
 
       gout = posText;
       gout << (int)(pos.getMetersY()) << "m";
@@ -9,8 +9,10 @@
 
 #pragma once
 
+#include <vector>
 #include "position.h"   // for Point
 #include "uiDraw.h"
+#include "view.h"       // for the size of the screen
 
 // forward declaration for the Ground unit tests
 class TestGround;
@@ -26,12 +28,20 @@ class Ground
 
 public:
    // the constructor generates the ground
-   Ground(const Position &posUpperRight);
+   Ground(const View & view);
    Ground() : ground(nullptr), iHowitzer(0), iTarget(0) {}
    
    // reset the game
    void reset(Position & posHowitzer);
 
+   // reset the game with a flat spot for every gun in a battery. The
+   // target goes on the far side from the first one
+   void reset(std::vector<Position> & posHowitzers);
+
+   // use measured ground instead of a random one: an elevation in
+   // meters for every column of pixels. The target goes on the far side
+   void load(const std::vector<double> & elevations, Position & posHowitzer);
+
    // draw the ground on the screen
    void draw(ogstream & gout) const;
 
@@ -44,6 +54,6 @@ public:
 private:
    double * ground;               // elevation of the ground, in pixels 
    int iTarget;                   // the location of the target, in pixels
-   int iHowitzer;                 // the location of the howitzer
-   Position posUpperRight;        // size of the screen
+   int iHowitzer;                 // the location of the (first) howitzer
+   View view;                     // zoom and size of the screen
 };
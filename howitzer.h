@@ -15,6 +15,7 @@
 #include "velocity.h"
 #include "physics.h"
 #include "uiDraw.h"
+#include "view.h"
 
 
 #pragma once
@@ -37,6 +38,10 @@ class Howitzer
       // default constructor
       Howitzer() : muzzleVelocity(DEFAULT_MUZZLE_VELOCITY), elevation(0.0) {}
 
+      // one gun of a battery, with its own spot and muzzle velocity
+      Howitzer(const Position& position, double muzzleVelocity) :
+         position(position), muzzleVelocity(muzzleVelocity), elevation(0.0) {}
+
       // draw
       void draw(ogstream& gout, double flightTime) const
       {
@@ -47,14 +52,14 @@ class Howitzer
 
       // where is the howitzer at right now?
       Position & getPosition() { return position; }
+      const Position & getPosition() const { return position; }
 
       // generate a new position for the howitzer
-      void generatePosition(const Position& posUpperRight)
+      void generatePosition(const View& view)
       {
-         double xPixels = random(posUpperRight.getPixelsX() * 0.1,
-            posUpperRight.getPixelsX() * 0.9);
-         position.setPixelsX(xPixels);
-         position.setPixelsY(0);
+         double xPixels = random(view.getWidth() * 0.1,
+            view.getWidth() * 0.9);
+         position = view.fromPixels(xPixels, 0.0);
       }
 
       // get the muzzle velocity
@@ -72,6 +77,9 @@ class Howitzer
       // get the elevation
       const Angle & getElevation() const { return elevation; }
 
+      // aim straight at a firing solution
+      void setElevation(const Angle& elevation) { this->elevation = elevation; }
+
    private:
       Position position;      // initial position of the projectile
       double muzzleVelocity;  // muzzle velocity, defaults to 827.0 m/s
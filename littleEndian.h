@@ -0,0 +1,185 @@
+/***********************************************************************
+ * Header File:
+ *    LITTLE ENDIAN
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    The values every binary file and message in the project is made
+ *    of, low byte first whatever the machine: u32, u64, f64 and
+ *    varints. Each can go at a place in a message, on the end of a
+ *    buffer, or through a stream.
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <iostream>
+#include <cstdint>     // for uint32_t and uint64_t
+#include <cstring>     // for memcpy()
+#include <cstdio>      // for EOF
+
+/*********************************************
+ * PUT / GET at a place in a message
+ *********************************************/
+inline void putU32(unsigned char* bytes, uint32_t value)
+{
+   for (int i = 0; i < 4; i++)
+      bytes[i] = (unsigned char)(value >> (8 * i));
+}
+
+inline void putU64(unsigned char* bytes, uint64_t value)
+{
+   for (int i = 0; i < 8; i++)
+      bytes[i] = (unsigned char)(value >> (8 * i));
+}
+
+inline void putF64(unsigned char* bytes, double value)
+{
+   uint64_t bits;
+   memcpy(&bits, &value, sizeof(bits));
+   putU64(bytes, bits);
+}
+
+inline uint32_t getU32(const unsigned char* bytes)
+{
+   uint32_t value = 0;
+   for (int i = 0; i < 4; i++)
+      value |= (uint32_t)bytes[i] << (8 * i);
+   return value;
+}
+
+inline uint64_t getU64(const unsigned char* bytes)
+{
+   uint64_t value = 0;
+   for (int i = 0; i < 8; i++)
+      value |= (uint64_t)bytes[i] << (8 * i);
+   return value;
+}
+
+inline double getF64(const unsigned char* bytes)
+{
+   uint64_t bits = getU64(bytes);
+   double value;
+   memcpy(&value, &bits, sizeof(bits));
+   return value;
+}
+
+/*********************************************
+ * PUT on the end of a buffer
+ *********************************************/
+inline void putU32(std::vector<char>& buffer, uint32_t value)
+{
+   unsigned char bytes[4];
+   putU32(bytes, value);
+   buffer.insert(buffer.end(), bytes, bytes + 4);
+}
+
+inline void putU64(std::vector<char>& buffer, uint64_t value)
+{
+   unsigned char bytes[8];
+   putU64(bytes, value);
+   buffer.insert(buffer.end(), bytes, bytes + 8);
+}
+
+inline void putF64(std::vector<char>& buffer, double value)
+{
+   unsigned char bytes[8];
+   putF64(bytes, value);
+   buffer.insert(buffer.end(), bytes, bytes + 8);
+}
+
+// seven bits a byte, low bits first, the high bit set on all but the last
+inline void putVarint(std::vector<char>& buffer, uint64_t value)
+{
+   for (; value >= 0x80; value >>= 7)
+      buffer.push_back((char)((value & 0x7f) | 0x80));
+   buffer.push_back((char)value);
+}
+
+/*********************************************
+ * WRITE to a stream
+ *********************************************/
+inline void writeU32(std::ostream& out, uint32_t value)
+{
+   unsigned char bytes[4];
+   putU32(bytes, value);
+   out.write((const char*)bytes, 4);
+}
+
+inline void writeU64(std::ostream& out, uint64_t value)
+{
+   unsigned char bytes[8];
+   putU64(bytes, value);
+   out.write((const char*)bytes, 8);
+}
+
+inline void writeF64(std::ostream& out, double value)
+{
+   unsigned char bytes[8];
+   putF64(bytes, value);
+   out.write((const char*)bytes, 8);
+}
+
+inline void writeVarint(std::ostream& out, uint64_t value)
+{
+   for (; value >= 0x80; value >>= 7)
+      out.put((char)((value & 0x7f) | 0x80));
+   out.put((char)value);
+}
+
+/*********************************************
+ * READ from a stream. False if the stream ends first
+ *********************************************/
+inline bool readU32(std::istream& in, uint32_t& value)
+{
+   unsigned char bytes[4];
+   if (!in.read((char*)bytes, 4))
+      return false;
+   value = getU32(bytes);
+   return true;
+}
+
+inline bool readU64(std::istream& in, uint64_t& value)
+{
+   unsigned char bytes[8];
+   if (!in.read((char*)bytes, 8))
+      return false;
+   value = getU64(bytes);
+   return true;
+}
+
+inline bool readF64(std::istream& in, double& value)
+{
+   unsigned char bytes[8];
+   if (!in.read((char*)bytes, 8))
+      return false;
+   value = getF64(bytes);
+   return true;
+}
+
+inline bool readI32(std::istream& in, int& value)
+{
+   uint32_t bits;
+   if (!readU32(in, bits))
+      return false;
+   value = (int)bits;
+   return true;
+}
+
+// also false if it runs past 64 bits
+inline bool readVarint(std::istream& in, uint64_t& value)
+{
+   value = 0;
+   int byte;
+   int shift = 0;
+   do
+   {
+      byte = in.get();
+      if (byte == EOF || shift > 63)
+         return false;
+      value |= (uint64_t)(byte & 0x7f) << shift;
+      shift += 7;
+   }
+   while (byte & 0x80);
+   return true;
+}
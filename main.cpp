@@ -12,9 +12,16 @@
 #include "uiDraw.h"     // for RANDOM and DRAW*
 #include "simulation.h" // for SIMULATION
 #include "position.h"   // for POSITION
-#include "test.h"       // for the unit tests
+#include "profile.h"    // for PROFILE
+#include "replay.h"     // for INPUT RECORDER
+#include <fstream>      // for ofstream
+#include <cstdlib>      // for getenv()
 using namespace std;
 
+// a session is recorded, so it can be played back with replay, when
+// INPUT_LOG_ENV names a file
+static InputRecorder* pRecorder = nullptr;
+
 
 /*************************************
  * All the interesting work happens here, when
@@ -29,6 +36,10 @@ void callBack(const Interface* pUI, void* p)
    // is the first step of every single callback function in OpenGL. 
    Simulator* pSim = (Simulator*)p;
 
+   // Note the keys and the frame time before anything acts on them
+   if (pRecorder)
+      pRecorder->record(pUI->getInput(), pUI->getFrameDelta());
+
    // Update the simulator state
    pSim->update(pUI);
 
@@ -36,11 +47,10 @@ void callBack(const Interface* pUI, void* p)
    pSim->gameplay(pUI);
    
    // Draw updated game state.
+   pUI->beginDraw();
    pSim->display();
 }
 
-double Position::metersFromPixels = 40.0;
-
 /*********************************
  * Initialize the simulation and set it in motion
  *********************************/
@@ -55,18 +65,28 @@ int WINAPI wWinMain(
 int main(int argc, char** argv)
 #endif // !_WIN32
 {
-   // unit tests
-   testRunner();
+#ifdef PROFILE
+   // where did the time go?
+   profileDumpOnExit("profile.json", "trace.json");
+#endif
   
    // Initialize OpenGL
-   Position posUpperRight;
-   posUpperRight.setZoom(40.0 /* 40 meters equals 1 pixel */);
-   posUpperRight.setPixelsX(700.0);
-   posUpperRight.setPixelsY(500.0);
-   Interface ui("M777 Howitzer Simulation", posUpperRight);
+   View view(40.0 /* 40 meters equals 1 pixel */, 700, 500);
+   Interface ui("M777 Howitzer Simulation", view);
+
+   // Record the seed before the simulation draws on it. The game ends
+   // with exit(), so these must be static for the last run to be written
+   const char* inputName = getenv(INPUT_LOG_ENV);
+   if (inputName != nullptr && *inputName != '\0')
+   {
+      static ofstream foutInput(inputName, ios::binary);
+      static InputRecorder recorder(foutInput, ui.getSeed(), view);
+      if (foutInput.is_open())
+         pRecorder = &recorder;
+   }
 
    // Initialize the simulation.
-   Simulator sim(posUpperRight);
+   Simulator sim(view);
 
 
    // set everything into action
@@ -0,0 +1,59 @@
+/***********************************************************************
+ * Header File:
+ *    PARALLEL
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Spread a loop of independent jobs across the cores
+ ************************************************************************/
+
+#pragma once
+
+#include <thread>      // for thread
+#include <atomic>      // for the next job
+#include <vector>
+
+/*********************************************
+ * PARALLEL THREADS
+ * How many threads parallelFor() will use for count jobs. numThreads
+ * of 0 uses every core, but never more threads than jobs. Asking for
+ * the cores reads a file on some systems, so ask only once
+ *********************************************/
+inline int parallelThreads(int count, int numThreads)
+{
+   static const int numCores = (int)std::thread::hardware_concurrency();
+   if (numThreads <= 0)
+      numThreads = numCores;
+   if (numThreads <= 0)
+      numThreads = 1;
+   if (numThreads > count)
+      numThreads = count;
+   return numThreads;
+}
+
+/*********************************************
+ * PARALLEL FOR
+ * Call job(i) for every i from 0 to count - 1. Every thread takes the
+ * next job until there are none left; the calling thread is one of
+ * them. numThreads of 0 uses every core. The jobs must not share
+ * anything they write.
+ *********************************************/
+template <class Job>
+void parallelFor(int count, int numThreads, Job job)
+{
+   numThreads = parallelThreads(count, numThreads);
+
+   std::atomic<int> next(0);
+   auto worker = [&]()
+   {
+      for (int i = next++; i < count; i = next++)
+         job(i);
+   };
+
+   std::vector<std::thread> threads;
+   for (int i = 1; i < numThreads; i++)
+      threads.push_back(std::thread(worker));
+   worker();
+   for (std::thread& t : threads)
+      t.join();
+}
@@ -8,12 +8,78 @@
  ************************************************************************/
 
 #include "physics.h"  // for the prototypes
+#include <cmath>      // for sqrt()
+using namespace std;
 
  /*********************************************************
+ * IS IN SEGMENT
+ * Does the domain fall in mapping[i] .. mapping[i + 1]? A domain right
+ * on a boundary belongs to the segment below it, as it always has.
+ *********************************************************/
+static inline bool isInSegment(const Mapping mapping[], int i, double domain)
+{
+   // the domain must be in order
+   assert(mapping[i + 0].domain < mapping[i + 1].domain);
+   return (i == 0 ? mapping[i].domain <= domain : mapping[i].domain < domain) &&
+      domain <= mapping[i + 1].domain;
+}
+
+/*********************************************************
  * LINEAR INTERPOLATION
  * From a list of domains and ranges, linear interpolate
  *********************************************************/
 double linearInterpolation(const Mapping mapping[], int numMapping, double domain)
+{
+   LookupCursor cursor;
+   return linearInterpolation(mapping, numMapping, domain, cursor);
+}
+
+/*********************************************************
+ * FIND SEGMENT
+ * Which segment of the table holds the domain? Try the one we were
+ * in last time, then the ones on either side, and only then search
+ * the whole table. The domain must be within the table.
+ *********************************************************/
+static int findSegment(const Mapping mapping[], int numMapping, double domain,
+   LookupCursor& cursor)
+{
+   int numSegments = numMapping - 1;
+   int i = cursor.segment;
+   if (i < 0 || i >= numSegments)
+      i = 0;
+
+   if (!isInSegment(mapping, i, domain))
+   {
+      if (i + 1 < numSegments && isInSegment(mapping, i + 1, domain))
+         i++;
+      else if (i > 0 && isInSegment(mapping, i - 1, domain))
+         i--;
+      else
+      {
+         // the last segment that starts below the domain
+         int low = 0;
+         int high = numSegments - 1;
+         while (low < high)
+         {
+            int middle = (low + high + 1) / 2;
+            if (mapping[middle].domain < domain)
+               low = middle;
+            else
+               high = middle - 1;
+         }
+         i = low;
+      }
+   }
+
+   cursor.segment = i;
+   return i;
+}
+
+/*********************************************************
+ * LINEAR INTERPOLATION with a cursor
+ *********************************************************/
+double linearInterpolation(const Mapping mapping[], int numMapping, double domain,
+   LookupCursor& cursor)
 {
    // off the scale on the small end
    if (domain < mapping[0].domain)
@@ -21,163 +87,261 @@ double linearInterpolation(const Mapping mapping[], int numMapping, double domai
       return mapping[0].range;
    }
 
+   // off the scale on the large end, or not a number at all
+   if (!(domain <= mapping[numMapping - 1].domain))
+   {
+      return mapping[numMapping - 1].range;
+   }
+
    // within the table
-   for (int i = 0; i < numMapping - 1; i++)
+   int i = findSegment(mapping, numMapping, domain, cursor);
+   return linearInterpolation(mapping[i].domain, mapping[i].range,
+      mapping[i + 1].domain, mapping[i + 1].range,
+      domain);
+}
+
+/*********************************************************
+ * MONOTONE CUBIC : CONSTRUCTOR
+ * Start every tangent at the average of the slopes on either side,
+ * or flat at a peak or a valley. Then, segment by segment, scale the
+ * two tangents down wherever they are steep enough to overshoot:
+ *    alpha = m0 / delta    beta = m1 / delta
+ * is monotone whenever alpha^2 + beta^2 <= 9
+ *********************************************************/
+MonotoneCubic::MonotoneCubic(const Mapping mapping[], int numMapping) :
+   mapping(mapping), numMapping(numMapping)
+{
+   assert(numMapping >= 2);
+   int numSegments = numMapping - 1;
+
+   // the slope of each segment
+   vector<double> delta(numSegments);
+   for (int i = 0; i < numSegments; i++)
+   {
+      assert(mapping[i].domain < mapping[i + 1].domain);
+      delta[i] = (mapping[i + 1].range - mapping[i].range) /
+         (mapping[i + 1].domain - mapping[i].domain);
+   }
+
+   // the tangent at each entry
+   vector<double> tangent(numMapping);
+   tangent[0] = delta[0];
+   tangent[numMapping - 1] = delta[numSegments - 1];
+   for (int i = 1; i < numSegments; i++)
+      tangent[i] = (delta[i - 1] * delta[i] <= 0.0) ? 0.0 :
+         0.5 * (delta[i - 1] + delta[i]);
+
+   for (int i = 0; i < numSegments; i++)
    {
-      // the domain must be in order
-      assert(mapping[i + 0].domain < mapping[i + 1].domain);
-      if (mapping[i + 0].domain <= domain && domain <= mapping[i + 1].domain)
-         return linearInterpolation(mapping[i].domain, mapping[i].range,
-            mapping[i + 1].domain, mapping[i + 1].range,
-            domain);
+      if (delta[i] == 0.0)
+      {
+         tangent[i] = 0.0;
+         tangent[i + 1] = 0.0;
+         continue;
+      }
+      double alpha = tangent[i] / delta[i];
+      double beta = tangent[i + 1] / delta[i];
+      double length = alpha * alpha + beta * beta;
+      if (length > 9.0)
+      {
+         double tau = 3.0 / sqrt(length);
+         tangent[i] = tau * alpha * delta[i];
+         tangent[i + 1] = tau * beta * delta[i];
+      }
    }
 
-   // off the scale on the large end
-   return mapping[numMapping - 1].range;
+   // the Hermite cubic of each segment as a polynomial
+   segments.resize(numSegments);
+   for (int i = 0; i < numSegments; i++)
+   {
+      double h = mapping[i + 1].domain - mapping[i].domain;
+      Segment& segment = segments[i];
+      segment.domain = mapping[i].domain;
+      segment.c0 = mapping[i].range;
+      segment.c1 = tangent[i];
+      segment.c2 = (3.0 * delta[i] - 2.0 * tangent[i] - tangent[i + 1]) / h;
+      segment.c3 = (tangent[i] + tangent[i + 1] - 2.0 * delta[i]) / (h * h);
+   }
+}
+
+/*********************************************************
+ * MONOTONE CUBIC : INTERPOLATE
+ *********************************************************/
+double MonotoneCubic::interpolate(double domain, LookupCursor& cursor) const
+{
+   // off the scale on either end
+   if (domain < mapping[0].domain)
+      return mapping[0].range;
+   if (!(domain <= mapping[numMapping - 1].domain))
+      return mapping[numMapping - 1].range;
+
+   const Segment& segment = segments[findSegment(mapping, numMapping, domain, cursor)];
+   double t = domain - segment.domain;
+   return segment.c0 + t * (segment.c1 + t * (segment.c2 + t * segment.c3));
 }
 
 /*********************************************************
  * GRAVITY FROM ALTITUDE
  * Determine gravity coefficient based on the altitude
  *********************************************************/
+static const Mapping gravityMapping[] =
+{// alititude     gravity
+   { 0.0      ,   9.807 },
+   { 1000.0   ,   9.804 },
+   { 2000.0   ,   9.801 },
+   { 3000.0   ,   9.797 },
+   { 4000.0   ,   9.794 },
+   { 5000.0   ,   9.791 },
+   { 6000.0   ,   9.788 },
+   { 7000.0   ,   9.785 },
+   { 8000.0   ,   9.782 },
+   { 9000.0   ,   9.779 },
+   { 10000.0  ,   9.776 },
+   { 15000.0  ,   9.761 },
+   { 20000.0  ,   9.745 },
+   { 25000.0  ,   9.730 },
+   { 30000.0  ,   9.715 },
+   { 40000.0  ,   9.684 },
+   { 50000.0  ,   9.654 },
+   { 60000.0  ,   9.624 },
+   { 70000.0  ,   9.594 },
+   { 80000.0  ,   9.564 }
+};
+const int NUM_GRAVITY_MAPPING = sizeof(gravityMapping) / sizeof(gravityMapping[0]);
+static const MonotoneCubic gravityCubic(gravityMapping, NUM_GRAVITY_MAPPING);
+
 double gravityFromAltitude(double altitude)
 {
-   const Mapping gravityMapping[] =
-   {// alititude     gravity
-      { 0.0      ,   9.807 },
-      { 1000.0   ,   9.804 },
-      { 2000.0   ,   9.801 },
-      { 3000.0   ,   9.797 },
-      { 4000.0   ,   9.794 },
-      { 5000.0   ,   9.791 },
-      { 6000.0   ,   9.788 },
-      { 7000.0   ,   9.785 },
-      { 8000.0   ,   9.782 },
-      { 9000.0   ,   9.779 },
-      { 10000.0  ,   9.776 },
-      { 15000.0  ,   9.761 },
-      { 20000.0  ,   9.745 },
-      { 25000.0  ,   9.730 },
-      { 30000.0  ,   9.715 },
-      { 40000.0  ,   9.684 },
-      { 50000.0  ,   9.654 },
-      { 60000.0  ,   9.624 },
-      { 70000.0  ,   9.594 },
-      { 80000.0  ,   9.564 }
-   };
-
-   double gravity = linearInterpolation(gravityMapping,
-      sizeof(gravityMapping) / sizeof(gravityMapping[0]),
-      altitude);
-
-   return gravity;
+   return linearInterpolation(gravityMapping, NUM_GRAVITY_MAPPING, altitude);
+}
+
+double gravityFromAltitude(double altitude, LookupCursor& cursor, InterpolationMode mode)
+{
+   if (mode == INTERPOLATE_CUBIC)
+      return gravityCubic.interpolate(altitude, cursor);
+   return linearInterpolation(gravityMapping, NUM_GRAVITY_MAPPING, altitude, cursor);
 }
 
 /*********************************************************
  * DENSITY FROM ALTITUDE
  * Determine the density of air based on the altitude
  *********************************************************/
+static const Mapping densityMapping[] =
+{ // altitude    density
+   { 0.0       , 1.2250000 },
+   { 1000.0    , 1.1120000 },
+   { 2000.0    , 1.0070000 },
+   { 3000.0    , 0.9093000 },
+   { 4000.0    , 0.8194000 },
+   { 5000.0    , 0.7364000 },
+   { 6000.0    , 0.6601000 },
+   { 7000.0    , 0.5900000 },
+   { 8000.0    , 0.5258000 },
+   { 9000.0    , 0.4671000 },
+   { 10000.0   , 0.4135000 },
+   { 15000.0   , 0.1948000 },
+   { 20000.0   , 0.0889100 },
+   { 25000.0   , 0.0400800 },
+   { 30000.0   , 0.0184100 },
+   { 40000.0   , 0.0039960 },
+   { 50000.0   , 0.0010270 },
+   { 60000.0   , 0.0003097 },
+   { 70000.0   , 0.0000828 },
+   { 80000.0   , 0.0000185 }
+};
+const int NUM_DENSITY_MAPPING = sizeof(densityMapping) / sizeof(densityMapping[0]);
+static const MonotoneCubic densityCubic(densityMapping, NUM_DENSITY_MAPPING);
+
 double densityFromAltitude(double altitude)
 {
-   const Mapping densityMapping[] =
-   { // altitude    density
-      { 0.0       , 1.2250000 },
-      { 1000.0    , 1.1120000 },
-      { 2000.0    , 1.0070000 },
-      { 3000.0    , 0.9093000 },
-      { 4000.0    , 0.8194000 },
-      { 5000.0    , 0.7364000 },
-      { 6000.0    , 0.6601000 },
-      { 7000.0    , 0.5900000 },
-      { 8000.0    , 0.5258000 },
-      { 9000.0    , 0.4671000 },
-      { 10000.0   , 0.4135000 },
-      { 15000.0   , 0.1948000 },
-      { 20000.0   , 0.0889100 },
-      { 25000.0   , 0.0400800 },
-      { 30000.0   , 0.0184100 },
-      { 40000.0   , 0.0039960 },
-      { 50000.0   , 0.0010270 },
-      { 60000.0   , 0.0003097 },
-      { 70000.0   , 0.0000828 },
-      { 80000.0   , 0.0000185 }
-   };
-
-   double density = linearInterpolation(densityMapping,
-      sizeof(densityMapping) / sizeof(densityMapping[0]),
-      altitude);
-
-   return density;
+   return linearInterpolation(densityMapping, NUM_DENSITY_MAPPING, altitude);
+}
+
+double densityFromAltitude(double altitude, LookupCursor& cursor, InterpolationMode mode)
+{
+   if (mode == INTERPOLATE_CUBIC)
+      return densityCubic.interpolate(altitude, cursor);
+   return linearInterpolation(densityMapping, NUM_DENSITY_MAPPING, altitude, cursor);
 }
 
 /*********************************************************
  * SPEED OF SOUND FROM ALTITUDE
  * determine the speed of sound for a given altitude.
  ********************************************************/
+static const Mapping speedOfSoundMapping[] =
+{ // altitude    speedOfSound
+   { 0.0      ,  340 },
+   { 1000.0   ,  336 },
+   { 2000.0   ,  332 },
+   { 3000.0   ,  328 },
+   { 4000.0   ,  324 },
+   { 5000.0   ,  320 },
+   { 6000.0   ,  316 },
+   { 7000.0   ,  312 },
+   { 8000.0   ,  308 },
+   { 9000.0   ,  303 },
+   { 10000.0  ,  299 },
+   { 15000.0  ,  295 },
+   { 20000.0  ,  295 },
+   { 25000.0  ,  295 },
+   { 30000.0  ,  305 },
+   { 40000.0  ,  324 },
+   { 50000.0  ,  337 },
+   { 60000.0  ,  319 },
+   { 70000.0  ,  289 },
+   { 80000.0  ,  269 }
+};
+const int NUM_SPEED_OF_SOUND_MAPPING = sizeof(speedOfSoundMapping) / sizeof(speedOfSoundMapping[0]);
+static const MonotoneCubic speedOfSoundCubic(speedOfSoundMapping, NUM_SPEED_OF_SOUND_MAPPING);
+
 double speedSoundFromAltitude(double altitude)
 {
-   const Mapping speedOfSoundMapping[] =
-   { // altitude    speedOfSound
-      { 0.0      ,  340 },
-      { 1000.0   ,  336 },
-      { 2000.0   ,  332 },
-      { 3000.0   ,  328 },
-      { 4000.0   ,  324 },
-      { 5000.0   ,  320 },
-      { 6000.0   ,  316 },
-      { 7000.0   ,  312 },
-      { 8000.0   ,  308 },
-      { 9000.0   ,  303 },
-      { 10000.0  ,  299 },
-      { 15000.0  ,  295 },
-      { 20000.0  ,  295 },
-      { 25000.0  ,  295 },
-      { 30000.0  ,  305 },
-      { 40000.0  ,  324 },
-      { 50000.0  ,  337 },
-      { 60000.0  ,  319 },
-      { 70000.0  ,  289 },
-      { 80000.0  ,  269 }
-   };
-
-   double speedOfSound = linearInterpolation(speedOfSoundMapping,
-      sizeof(speedOfSoundMapping) / sizeof(speedOfSoundMapping[0]),
-      altitude);
-
-   return speedOfSound;
+   return linearInterpolation(speedOfSoundMapping, NUM_SPEED_OF_SOUND_MAPPING, altitude);
+}
+
+double speedSoundFromAltitude(double altitude, LookupCursor& cursor, InterpolationMode mode)
+{
+   if (mode == INTERPOLATE_CUBIC)
+      return speedOfSoundCubic.interpolate(altitude, cursor);
+   return linearInterpolation(speedOfSoundMapping, NUM_SPEED_OF_SOUND_MAPPING, altitude, cursor);
 }
 
 /*********************************************************
  * DRAG FROM MACH
  * Determine the drag coefficient for a M795 shell given speed in Mach
  *********************************************************/
+static const Mapping machNumberMapping[] =
+{ // mach     drag
+   { 0.000  , 0.0000 },
+   { 0.300  , 0.1629 },
+   { 0.500  , 0.1659 },
+   { 0.700  , 0.2031 },
+   { 0.890  , 0.2597 },
+   { 0.920  , 0.3010 },
+   { 0.960  , 0.3287 },
+   { 0.980  , 0.4002 },
+   { 1.000  , 0.4258 },
+   { 1.020  , 0.4335 },
+   { 1.060  , 0.4483 },
+   { 1.240  , 0.4064 },
+   { 1.530  , 0.3663 },
+   { 1.990  , 0.2897 },
+   { 2.870  , 0.2297 },
+   { 2.890  , 0.2306 },
+   { 5.000  , 0.2656 }
+};
+const int NUM_MACH_NUMBER_MAPPING = sizeof(machNumberMapping) / sizeof(machNumberMapping[0]);
+static const MonotoneCubic machNumberCubic(machNumberMapping, NUM_MACH_NUMBER_MAPPING);
+
 double dragFromMach(double speedMach)
 {
-   const Mapping machNumberMapping[] =
-   { // mach     drag
-      { 0.000  , 0.0000 },
-      { 0.300  , 0.1629 },
-      { 0.500  , 0.1659 },
-      { 0.700  , 0.2031 },
-      { 0.890  , 0.2597 },
-      { 0.920  , 0.3010 },
-      { 0.960  , 0.3287 },
-      { 0.980  , 0.4002 },
-      { 1.000  , 0.4258 },
-      { 1.020  , 0.4335 },
-      { 1.060  , 0.4483 },
-      { 1.240  , 0.4064 },
-      { 1.530  , 0.3663 },
-      { 1.990  , 0.2897 },
-      { 2.870  , 0.2297 },
-      { 2.890  , 0.2306 },
-      { 5.000  , 0.2656 }
-   };
-
-   double drag = linearInterpolation(machNumberMapping,
-      sizeof(machNumberMapping) / sizeof(machNumberMapping[0]),
-      speedMach);
-
-   return drag;
+   return linearInterpolation(machNumberMapping, NUM_MACH_NUMBER_MAPPING, speedMach);
+}
+
+double dragFromMach(double speedMach, LookupCursor& cursor, InterpolationMode mode)
+{
+   if (mode == INTERPOLATE_CUBIC)
+      return machNumberCubic.interpolate(speedMach, cursor);
+   return linearInterpolation(machNumberMapping, NUM_MACH_NUMBER_MAPPING, speedMach, cursor);
 }
 
@@ -13,6 +13,7 @@
 #include <math.h>
 #include <cassert>  // for ASSERT 
 #include <cmath>    // for abs
+#include <vector>
 
  /*******************************************************
   * AREA FROM RADIUS
@@ -107,10 +108,24 @@ inline double linearInterpolation(double d0, double r0,
 {
    assert(abs(d1 - d0) >= abs(d - d0));
    double range = r0 + (r1 - r0) * (d - d0) / (d1 - d0);
-   assert(abs(r1 - r0) >= abs(range - r0));
+   // allow for rounding when d lands right on d1
+   assert(abs(r1 - r0) * (1.0 + 1e-12) >= abs(range - r0));
    return range;
 }
 
+/*********************************************************
+ * LOOKUP CURSOR
+ * Remembers which segment of a table the last lookup landed in.
+ * A shell climbs and falls through the tables a little at a time,
+ * so the next lookup is almost always in the same segment or the
+ * one next to it. Keep one cursor per table per projectile.
+ *********************************************************/
+struct LookupCursor
+{
+   LookupCursor() : segment(0) {}
+   int segment;   // mapping[segment] .. mapping[segment + 1]
+};
+
 /*********************************************************
  * LINEAR INTERPOLATION
  * From a list of domains and ranges, linear interpolate
@@ -119,26 +134,173 @@ double linearInterpolation(const Mapping mapping[],
    int numMapping,
    double domain);
 
+/*********************************************************
+ * INTERPOLATION MODE
+ * How to read between the entries of a table. Linear is what the
+ * tables have always done. Cubic is smooth: the slope is continuous
+ * across every entry, so there are no kinks for an adaptive step to
+ * trip over, yet it never overshoots the data.
+ *********************************************************/
+enum InterpolationMode
+{
+   INTERPOLATE_LINEAR,
+   INTERPOLATE_CUBIC
+};
+
+/*********************************************************
+ * MONOTONE CUBIC
+ * A Fritsch-Carlson monotone cubic through a table. The tangents are
+ * chosen once, when it is built, so that the curve rises wherever
+ * the data rises and is flat wherever it is flat. Each segment is
+ * then stored as a polynomial in (d - d0):
+ *    r = r0 + t (c1 + t (c2 + t c3))
+ * Outside the table it clamps, just as linear interpolation does.
+ *********************************************************/
+class MonotoneCubic
+{
+public:
+   MonotoneCubic(const Mapping mapping[], int numMapping);
+
+   double interpolate(double domain, LookupCursor& cursor) const;
+
+private:
+   // one segment of the curve
+   struct Segment
+   {
+      double domain;   // d0
+      double c0;       // r0
+      double c1;       // the slope at d0
+      double c2;
+      double c3;
+   };
+
+   const Mapping* mapping;
+   int numMapping;
+   std::vector<Segment> segments;
+};
+
+/*********************************************************
+ * LINEAR INTERPOLATION with a cursor
+ * The same answer, bit for bit, but the cursor's segment and its
+ * neighbors are tried before searching the table
+ *********************************************************/
+double linearInterpolation(const Mapping mapping[],
+   int numMapping,
+   double domain,
+   LookupCursor& cursor);
+
 /*********************************************************
  * GRAVITY FROM ALTITUDE
  * Determine gravity coefficient based on the altitude
  *********************************************************/
 double gravityFromAltitude(double altitude);
+double gravityFromAltitude(double altitude, LookupCursor& cursor,
+   InterpolationMode mode = INTERPOLATE_LINEAR);
 
 /*********************************************************
  * DENSITY FROM ALTITUDE
  * Determine the density of air based on the altitude
  *********************************************************/
 double densityFromAltitude(double altitude);
+double densityFromAltitude(double altitude, LookupCursor& cursor,
+   InterpolationMode mode = INTERPOLATE_LINEAR);
 
 /*********************************************************
  * SPEED OF SOUND FROM ALTITUDE
  ********************************************************/
 double speedSoundFromAltitude(double altitude);
+double speedSoundFromAltitude(double altitude, LookupCursor& cursor,
+   InterpolationMode mode = INTERPOLATE_LINEAR);
 
 /*********************************************************
  * DRAG FROM MACH
  * Determine the drag coefficient as a function of the speed of sound
  *********************************************************/
 double dragFromMach(double speedMach);
+double dragFromMach(double speedMach, LookupCursor& cursor,
+   InterpolationMode mode = INTERPOLATE_LINEAR);
 
+
+/*********************************************************
+ * ALTITUDE VACUUM
+ * Above the top of the tables the air is so thin that drag no longer
+ * matters, so we fly the shell in closed form instead.
+ *********************************************************/
+#define ALTITUDE_VACUUM 80000.0   // m
+
+/*********************************************************
+ * IMPACT TIME FROM VACUUM
+ * How long until a shell at height y moving up at dy falls back to
+ * the ground, with no drag and constant gravity (negative down):
+ *    0 = y + dy t + 1/2 gravity t^2
+ * Thus, taking the root in the future:
+ *    t = (-dy - sqrt(dy^2 - 2 gravity y)) / gravity
+ *********************************************************/
+inline double impactTimeFromVacuum(double y, double dy, double gravity)
+{
+   assert(gravity < 0.0);
+   double discriminant = dy * dy - 2.0 * gravity * y;
+   if (discriminant < 0.0)
+      return 0.0;
+   return (-dy - sqrt(discriminant)) / gravity;
+}
+
+/*********************************************************
+ * ELEVATION FROM VACUUM
+ * The angle from straight up that lands a shell distance meters
+ * away, with no drag. From the vacuum range equation
+ *    distance = speed^2 sin(2 theta) / gravity
+ * where theta is measured from the horizontal. There are two answers:
+ * the flat one and the high one. Returns false if it is out of reach.
+ *********************************************************/
+inline bool elevationFromVacuum(double distance, double speed, double gravity,
+   bool fHighAngle, double& elevation)
+{
+   assert(gravity < 0.0);
+   double sinTwoTheta = -gravity * fabs(distance) / (speed * speed);
+   if (speed <= 0.0 || sinTwoTheta > 1.0)
+      return false;
+
+   double theta = 0.5 * asin(sinTwoTheta);     // from the horizontal
+   if (fHighAngle)
+      theta = M_PI_2 - theta;
+   elevation = (M_PI_2 - theta) * 180.0 / M_PI; // from straight up, in degrees
+   if (distance < 0.0)
+      elevation = -elevation;
+   return true;
+}
+
+/*********************************************************
+ * ELEVATION FROM VACUUM to a height
+ * The same, for a target height meters above the muzzle (negative is
+ * below). With x the distance and u = tan(theta), the path
+ *    height = x u - gravity x^2 (1 + u^2) / (2 speed^2)
+ * is a quadratic in u. The smaller root is the flat shot
+ *********************************************************/
+inline bool elevationFromVacuum(double distance, double height, double speed,
+   double gravity, bool fHighAngle, double& elevation)
+{
+   if (height == 0.0)
+      return elevationFromVacuum(distance, speed, gravity, fHighAngle, elevation);
+
+   assert(gravity < 0.0);
+   double x = fabs(distance);
+   if (speed <= 0.0 || height > speed * speed / (-2.0 * gravity))
+      return false;
+   if (x == 0.0)
+   {
+      elevation = 0.0;
+      return true;
+   }
+
+   double a = -gravity * x * x / (2.0 * speed * speed);
+   double discriminant = x * x - 4.0 * a * (a + height);
+   if (discriminant < 0.0)
+      return false;
+
+   double tanTheta = (x + (fHighAngle ? 1.0 : -1.0) * sqrt(discriminant)) / (2.0 * a);
+   elevation = 90.0 - atan(tanTheta) * 180.0 / M_PI;
+   if (distance < 0.0)
+      elevation = -elevation;
+   return true;
+}
@@ -54,8 +54,7 @@ Position& Position::operator = (const Position& posRHS)
  *************************************************************************/
 void Position::add(const Acceleration& a, const Velocity& v, double t)
 {
-   x += (v.getDX() * t) + (0.5 * a.getDDX() * (t * t));
-   y += (v.getDY() * t) + (0.5 * a.getDDY() * (t * t));
+   setMeters(getMeters() + (v.getVector() * t + a.getVector() * 0.5 * (t * t)));
 }
 
 /******************************************
@@ -12,6 +12,7 @@
 
 #include <iostream> 
 #include <cmath>
+#include "vec2.h"
 
 class TestPosition;
 class Acceleration;
@@ -19,11 +20,12 @@ class Velocity;
 class TestGround;
 class TestHowitzer;
 class TestProjectile;
+class TestRaster;
 
 
 /*********************************************
  * Position
- * A single position on the field in Meters
+ * A single position on the field in Meters. A View turns it into pixels
  *********************************************/
 class Position
 {
@@ -32,31 +34,28 @@ public:
    friend ::TestGround;
    friend ::TestHowitzer;
    friend ::TestProjectile;
+   friend ::TestRaster;
 
 
    // constructors
    Position() : x(0), y(0) { }
    Position(double x, double y);
+   explicit Position(const Vec2d& meters) : x(meters.getX()), y(meters.getY()) {}
    Position(const Position& pt) : x(pt.x), y(pt.y) {}
    Position& operator = (const Position& pt);
 
    // getters
    double getMetersX()       const { return x; }
    double getMetersY()       const { return y; }
-   double getPixelsX()       const { return x / metersFromPixels; }
-   double getPixelsY()       const { return y / metersFromPixels; }
+   Vec2d  getMeters()        const { return Vec2d(x, y); }
 
    // setters
-   void setZoom(double z) { metersFromPixels = z; }
    void setMeters(double xMeters, double yMeters) { x = xMeters, y = yMeters; }
+   void setMeters(const Vec2d& meters) { x = meters.getX(), y = meters.getY(); }
    void setMetersX(double xMeters) { x = xMeters; }
    void setMetersY(double yMeters) { y = yMeters; }
-   void setPixelsX(double xPixels) { x = xPixels * metersFromPixels; }
-   void setPixelsY(double yPixels) { y = yPixels * metersFromPixels; }
    double addMetersX(double x) { return this->x += x; }
    double addMetersY(double y) { return this->y += y; }
-   double addPixelsX(double x) { return this->x += (x * metersFromPixels); }
-   double addPixelsY(double y) { return this->y += (y * metersFromPixels); }
    void add(const Acceleration& a, const Velocity& v, double t);
    void reverse() { }
 
@@ -68,7 +67,6 @@ public:
 private:
    double x;                 // horizontal position
    double y;                 // vertical position
-   static double metersFromPixels;
 };
 
 
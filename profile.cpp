@@ -0,0 +1,391 @@
+/***********************************************************************
+ * Source File:
+ *    PROFILE
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Lightweight scoped timers for the phases of a frame. Each thread
+ *    owns its histograms and trace ring; the only lock is taken once
+ *    per thread, the first time it records anything, and once more
+ *    when the thread exits and hands its recorder back.
+ ************************************************************************/
+
+#include <atomic>      // for atomic
+#include <mutex>       // for mutex
+#include <vector>      // for the list of threads
+#include <algorithm>   // for min()
+#include <cstdio>      // for FILE
+#include <cstdlib>     // for atexit()
+#include <cassert>     // for ASSERT
+#include "profile.h"
+#include "uiDraw.h"    // for ogstream
+
+using namespace std;
+
+const int    PROFILE_BUCKETS   = 128;      // 4 per power of two, up to about 4 s
+const size_t PROFILE_RING_SIZE = 1 << 16;  // trace events kept per thread
+
+static const char * phaseNames[PROFILE_NUM_PHASES] =
+{
+   "update",
+   "gameplay",
+   "display",
+   "advance",
+   "groundDraw",
+   "serverRequest"
+};
+
+/*********************************************
+ * BUCKET FROM NANOSECONDS
+ * Small durations get a bucket each. After that, each power of two is
+ * split into four, so a bucket is never more than 25% wide.
+ *********************************************/
+static int bucketFromNanoseconds(uint64_t ns)
+{
+   if (ns < 8)
+      return (int)ns;
+
+   int log = 0;
+   while ((ns >> log) > 1)
+      log++;
+   int sub = (int)((ns >> (log - 2)) & 3);
+   int bucket = (log - 1) * 4 + sub;
+   return bucket < PROFILE_BUCKETS ? bucket : PROFILE_BUCKETS - 1;
+}
+
+/*********************************************
+ * NANOSECONDS FROM BUCKET
+ * The smallest duration that lands in a bucket
+ *********************************************/
+static uint64_t nanosecondsFromBucket(int bucket)
+{
+   if (bucket < 8)
+      return (uint64_t)bucket;
+   int log = bucket / 4 + 1;
+   int sub = bucket % 4;
+   return (uint64_t)(4 + sub) << (log - 2);
+}
+
+/*********************************************
+ * PROFILE THREAD
+ * Everything one thread has recorded. Only the owning thread writes;
+ * others may read at any time, so every field is atomic. An event can
+ * be overwritten while it is being read; readers check numEvents
+ * afterwards and throw away any that might have been.
+ *********************************************/
+struct ProfileThread
+{
+   struct Event
+   {
+      atomic<int>      phase;
+      atomic<uint64_t> begin;      // ns since the profiler started
+      atomic<uint64_t> duration;   // ns
+   };
+
+   ProfileThread(int id) : id(id), numEvents(0), events(PROFILE_RING_SIZE)
+   {
+      for (int phase = 0; phase < PROFILE_NUM_PHASES; phase++)
+         for (int bucket = 0; bucket < PROFILE_BUCKETS; bucket++)
+            counts[phase][bucket].store(0, memory_order_relaxed);
+   }
+
+   int id;
+   atomic<uint64_t> counts[PROFILE_NUM_PHASES][PROFILE_BUCKETS];
+   atomic<uint64_t> numEvents;
+   vector<Event> events;
+};
+
+static mutex                   threadsLock;
+static vector<ProfileThread *> threads;       // every recorder, in use or not
+static vector<ProfileThread *> threadsFree;   // recorders no thread owns
+static const chrono::steady_clock::time_point timeStart = chrono::steady_clock::now();
+static const char *            fileNameExitJSON  = nullptr;
+static const char *            fileNameExitTrace = nullptr;
+
+/*********************************************
+ * PROFILE THREAD OWNER
+ * Hands the recorder back when its thread exits, so the next new
+ * thread takes it over rather than growing the list. Its data stays,
+ * so there are never more recorders than threads running at once
+ *********************************************/
+struct ProfileThreadOwner
+{
+   ProfileThreadOwner() : pThread(nullptr) {}
+   ~ProfileThreadOwner()
+   {
+      if (pThread != nullptr)
+      {
+         lock_guard<mutex> guard(threadsLock);
+         threadsFree.push_back(pThread);
+      }
+   }
+
+   ProfileThread * pThread;
+};
+
+/*********************************************
+ * GET THREAD
+ * This thread's recorder. The first call takes a free one, or makes
+ * and registers a new one if there are none
+ *********************************************/
+static ProfileThread & getThread()
+{
+   thread_local ProfileThreadOwner owner;
+   if (owner.pThread == nullptr)
+   {
+      lock_guard<mutex> guard(threadsLock);
+      if (!threadsFree.empty())
+      {
+         owner.pThread = threadsFree.back();
+         threadsFree.pop_back();
+      }
+      else
+      {
+         owner.pThread = new ProfileThread((int)threads.size());
+         threads.push_back(owner.pThread);
+      }
+   }
+   return *owner.pThread;
+}
+
+/*********************************************
+ * PROFILE RECORD
+ * Add one sample to this thread's histogram and trace ring
+ *********************************************/
+void profileRecord(ProfilePhase phase,
+                   chrono::steady_clock::time_point begin,
+                   chrono::steady_clock::time_point end)
+{
+   assert(phase >= 0 && phase < PROFILE_NUM_PHASES);
+   ProfileThread & thread = getThread();
+
+   uint64_t duration = (uint64_t)chrono::duration_cast<chrono::nanoseconds>(end - begin).count();
+   atomic<uint64_t> & count = thread.counts[phase][bucketFromNanoseconds(duration)];
+   count.store(count.load(memory_order_relaxed) + 1, memory_order_relaxed);
+
+   // the fence keeps the event from being written before a reader can
+   // see, through numEvents, that it is about to be
+   uint64_t index = thread.numEvents.load(memory_order_relaxed);
+   ProfileThread::Event & event = thread.events[index % PROFILE_RING_SIZE];
+   atomic_thread_fence(memory_order_release);
+   event.phase.store(phase, memory_order_relaxed);
+   event.begin.store((uint64_t)chrono::duration_cast<chrono::nanoseconds>(begin - timeStart).count(),
+                     memory_order_relaxed);
+   event.duration.store(duration, memory_order_relaxed);
+   thread.numEvents.store(index + 1, memory_order_release);
+}
+
+/*********************************************
+ * MERGE
+ * Add up one phase's histogram across every thread
+ *********************************************/
+static void merge(ProfilePhase phase, uint64_t counts[PROFILE_BUCKETS])
+{
+   for (int bucket = 0; bucket < PROFILE_BUCKETS; bucket++)
+      counts[bucket] = 0;
+
+   lock_guard<mutex> guard(threadsLock);
+   for (const ProfileThread * pThread : threads)
+      for (int bucket = 0; bucket < PROFILE_BUCKETS; bucket++)
+         counts[bucket] += pThread->counts[phase][bucket].load(memory_order_relaxed);
+}
+
+/*********************************************
+ * PROFILE COUNT
+ *********************************************/
+uint64_t profileCount(ProfilePhase phase)
+{
+   uint64_t counts[PROFILE_BUCKETS];
+   merge(phase, counts);
+
+   uint64_t total = 0;
+   for (int bucket = 0; bucket < PROFILE_BUCKETS; bucket++)
+      total += counts[bucket];
+   return total;
+}
+
+/*********************************************
+ * PROFILE PERCENTILE
+ * Walk the merged histogram to the requested fraction. The answer is
+ * the middle of the bucket it lands in.
+ *********************************************/
+double profilePercentile(ProfilePhase phase, double fraction)
+{
+   assert(0.0 <= fraction && fraction <= 1.0);
+   uint64_t counts[PROFILE_BUCKETS];
+   merge(phase, counts);
+
+   uint64_t total = 0;
+   for (int bucket = 0; bucket < PROFILE_BUCKETS; bucket++)
+      total += counts[bucket];
+   if (total == 0)
+      return 0.0;
+
+   uint64_t target = (uint64_t)(fraction * (double)(total - 1)) + 1;
+   uint64_t seen = 0;
+   for (int bucket = 0; bucket < PROFILE_BUCKETS; bucket++)
+   {
+      seen += counts[bucket];
+      if (seen >= target)
+         return (double)(nanosecondsFromBucket(bucket) + nanosecondsFromBucket(bucket + 1)) / 2000.0;
+   }
+   return (double)nanosecondsFromBucket(PROFILE_BUCKETS) / 1000.0;
+}
+
+/*********************************************
+ * PROFILE RESET
+ *********************************************/
+void profileReset()
+{
+   lock_guard<mutex> guard(threadsLock);
+   for (ProfileThread * pThread : threads)
+   {
+      for (int phase = 0; phase < PROFILE_NUM_PHASES; phase++)
+         for (int bucket = 0; bucket < PROFILE_BUCKETS; bucket++)
+            pThread->counts[phase][bucket].store(0, memory_order_relaxed);
+      pThread->numEvents.store(0, memory_order_relaxed);
+   }
+}
+
+/*********************************************
+ * PROFILE NUM RECORDERS
+ *********************************************/
+int profileNumRecorders()
+{
+   lock_guard<mutex> guard(threadsLock);
+   return (int)threads.size();
+}
+
+/*********************************************
+ * PROFILE DUMP JSON
+ * One object per phase with its count and percentiles in microseconds
+ *********************************************/
+bool profileDumpJSON(const char * fileName)
+{
+   FILE * file = fopen(fileName, "w");
+   if (file == nullptr)
+      return false;
+
+   fprintf(file, "{\n  \"phases\": [\n");
+   for (int phase = 0; phase < PROFILE_NUM_PHASES; phase++)
+   {
+      ProfilePhase p = (ProfilePhase)phase;
+      fprintf(file, "    { \"name\": \"%s\", \"count\": %llu, "
+                    "\"p50_us\": %.3f, \"p90_us\": %.3f, \"p99_us\": %.3f, \"max_us\": %.3f }%s\n",
+              phaseNames[phase], (unsigned long long)profileCount(p),
+              profilePercentile(p, 0.50), profilePercentile(p, 0.90),
+              profilePercentile(p, 0.99), profilePercentile(p, 1.00),
+              phase + 1 < PROFILE_NUM_PHASES ? "," : "");
+   }
+   fprintf(file, "  ]\n}\n");
+
+   return fclose(file) == 0;
+}
+
+/*********************************************
+ * TRACE EVENT
+ * A copy of an event taken while its thread may still be recording
+ *********************************************/
+struct TraceEvent
+{
+   int      phase;
+   uint64_t begin;      // ns since the profiler started
+   uint64_t duration;   // ns
+};
+
+/*********************************************
+ * COPY EVENTS
+ * The events of one thread's ring that were not overwritten while
+ * we copied them
+ *********************************************/
+static void copyEvents(const ProfileThread & thread, vector<TraceEvent> & copies)
+{
+   copies.clear();
+   uint64_t numEvents = thread.numEvents.load(memory_order_acquire);
+   uint64_t first = numEvents > PROFILE_RING_SIZE ? numEvents - PROFILE_RING_SIZE : 0;
+   for (uint64_t i = first; i < numEvents; i++)
+   {
+      const ProfileThread::Event & event = thread.events[i % PROFILE_RING_SIZE];
+      copies.push_back(TraceEvent { event.phase.load(memory_order_relaxed),
+                                    event.begin.load(memory_order_relaxed),
+                                    event.duration.load(memory_order_relaxed) });
+   }
+
+   // event i may have been overwritten once event i + PROFILE_RING_SIZE
+   // was started
+   atomic_thread_fence(memory_order_acquire);
+   uint64_t numEventsAfter = thread.numEvents.load(memory_order_relaxed);
+   if (numEventsAfter >= first + PROFILE_RING_SIZE)
+   {
+      uint64_t numLost = min((uint64_t)copies.size(), numEventsAfter - first - PROFILE_RING_SIZE + 1);
+      copies.erase(copies.begin(), copies.begin() + numLost);
+   }
+}
+
+/*********************************************
+ * PROFILE DUMP TRACE
+ * Chrome's trace event format: load it in chrome://tracing or Perfetto
+ *********************************************/
+bool profileDumpTrace(const char * fileName)
+{
+   FILE * file = fopen(fileName, "w");
+   if (file == nullptr)
+      return false;
+
+   fprintf(file, "{\"traceEvents\":[\n");
+   bool fFirst = true;
+   vector<TraceEvent> copies;
+   lock_guard<mutex> guard(threadsLock);
+   for (const ProfileThread * pThread : threads)
+   {
+      copyEvents(*pThread, copies);
+      for (const TraceEvent & event : copies)
+      {
+         fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                 fFirst ? "" : ",\n", phaseNames[event.phase], pThread->id,
+                 (double)event.begin / 1000.0, (double)event.duration / 1000.0);
+         fFirst = false;
+      }
+   }
+   fprintf(file, "\n]}\n");
+
+   return fclose(file) == 0;
+}
+
+/*********************************************
+ * DUMP AT EXIT
+ *********************************************/
+static void dumpAtExit()
+{
+   if (fileNameExitJSON != nullptr)
+      profileDumpJSON(fileNameExitJSON);
+   if (fileNameExitTrace != nullptr)
+      profileDumpTrace(fileNameExitTrace);
+}
+
+/*********************************************
+ * PROFILE DUMP ON EXIT
+ *********************************************/
+void profileDumpOnExit(const char * fileNameJSON, const char * fileNameTrace)
+{
+   if (fileNameExitJSON == nullptr && fileNameExitTrace == nullptr)
+      atexit(dumpAtExit);
+   fileNameExitJSON = fileNameJSON;
+   fileNameExitTrace = fileNameTrace;
+}
+
+/*********************************************
+ * PROFILE DRAW
+ * A line per phase that has run: name, p50 and p99 in microseconds
+ *********************************************/
+void profileDraw(ogstream & gout, const Position & pos)
+{
+   gout = pos;
+   gout.setf(ios::fixed);
+   gout.precision(1);
+   for (int phase = 0; phase < PROFILE_NUM_PHASES; phase++)
+      if (profileCount((ProfilePhase)phase) > 0)
+         gout << phaseNames[phase]
+              << "  p50 " << profilePercentile((ProfilePhase)phase, 0.50) << "us"
+              << "  p99 " << profilePercentile((ProfilePhase)phase, 0.99) << "us\n";
+}
@@ -0,0 +1,87 @@
+/***********************************************************************
+ * Header File:
+ *    PROFILE
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Lightweight scoped timers for the phases of a frame. Each thread
+ *    keeps its own histogram and trace buffer so recording never takes
+ *    a lock. Build with PROFILE defined to turn the timers on; otherwise
+ *    PROFILE_SCOPE() compiles to nothing.
+ ************************************************************************/
+
+#pragma once
+
+#include <chrono>      // for steady_clock
+#include <cstdint>     // for uint64_t
+
+class ogstream;
+class Position;
+
+/*********************************************
+ * PROFILE PHASE
+ * The parts of a frame we time
+ *********************************************/
+enum ProfilePhase
+{
+   PROFILE_UPDATE,
+   PROFILE_GAMEPLAY,
+   PROFILE_DISPLAY,
+   PROFILE_ADVANCE,
+   PROFILE_GROUND_DRAW,
+   PROFILE_SERVER_REQUEST,   // from reading a request to writing its answer
+   PROFILE_NUM_PHASES
+};
+
+// record one timed phase on the calling thread
+void profileRecord(ProfilePhase phase,
+                   std::chrono::steady_clock::time_point begin,
+                   std::chrono::steady_clock::time_point end);
+
+// how many times a phase was recorded, across all threads
+uint64_t profileCount(ProfilePhase phase);
+
+// the duration, in microseconds, below which a fraction of the samples fall
+double profilePercentile(ProfilePhase phase, double fraction);
+
+// forget everything recorded so far
+void profileReset();
+
+// how many per-thread recorders there are. A thread's recorder is
+// passed on when it exits, so this is the most threads ever recording
+// at once
+int profileNumRecorders();
+
+// write the histograms as JSON and the recent events in Chrome trace format
+bool profileDumpJSON(const char * fileName);
+bool profileDumpTrace(const char * fileName);
+
+// write both files when the program exits. Either name may be null
+void profileDumpOnExit(const char * fileNameJSON, const char * fileNameTrace);
+
+// show p50 and p99 of each phase that has run on the screen
+void profileDraw(ogstream & gout, const Position & pos);
+
+/*********************************************
+ * PROFILE TIMER
+ * Times from construction to destruction
+ *********************************************/
+class ProfileTimer
+{
+public:
+   ProfileTimer(ProfilePhase phase) :
+      phase(phase), begin(std::chrono::steady_clock::now()) {}
+   ~ProfileTimer() { profileRecord(phase, begin, std::chrono::steady_clock::now()); }
+
+private:
+   ProfilePhase phase;
+   std::chrono::steady_clock::time_point begin;
+};
+
+#ifdef PROFILE
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b)  PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(phase)  ProfileTimer PROFILE_CONCAT(profileTimer, __LINE__)(phase)
+#else
+#define PROFILE_SCOPE(phase)
+#endif
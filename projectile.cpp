@@ -10,6 +10,9 @@
 #include "projectile.h"
 #include "angle.h"
 #include "uiDraw.h"
+#include "profile.h"
+#include <iterator>   // for next()
+#include <cassert>    // for ASSERT
 using namespace std;
 
 /***********************************************************************
@@ -19,7 +22,11 @@ using namespace std;
 void Projectile::fire(const Position& posHowitzer, double simulationTime,
    const Angle& elevation, double muzzleVelocity)
 {
-   reset();
+   // keep the shell we were given, only forget the last flight
+   flightPath.clear();
+   resetCursors();
+   posFired = posHowitzer;
+   timeFired = simulationTime;
 
    PositionVelocityTime pvt;
    pvt.pos = posHowitzer;
@@ -28,12 +35,57 @@ void Projectile::fire(const Position& posHowitzer, double simulationTime,
    flightPath.push_back(pvt);
 }
 
+/***********************************************************************
+ * GET POSITION
+ * Interpolate between the last two steps so the display can move the
+ * shell smoothly no matter how long a physics step is.
+ ************************************************************************/
+Position Projectile::getPosition(double alpha) const
+{
+   if (flightPath.size() < 2)
+      return getPosition();
+
+   auto itCurrent = flightPath.crbegin();
+   auto itPrevious = next(itCurrent);
+   return Position(
+      itPrevious->pos.getMetersX() + alpha * (itCurrent->pos.getMetersX() - itPrevious->pos.getMetersX()),
+      itPrevious->pos.getMetersY() + alpha * (itCurrent->pos.getMetersY() - itPrevious->pos.getMetersY()));
+}
+
+/***********************************************************************
+ * DRAW
+ * Draw the trail, with the newest point interpolated between steps
+ ************************************************************************/
+void Projectile::draw(ogstream& gout, double alpha) const
+{
+   if (flightPath.empty())
+      return;
+
+   double currentTime = getCurrentTime();
+   for (auto it = flightPath.cbegin(); next(it) != flightPath.cend(); ++it)
+      gout.drawProjectile(it->pos, currentTime - it->t);
+   gout.drawProjectile(getPosition(alpha), 0.0);
+}
+
+/***********************************************************************
+ * GET VACUUM IMPACT TIME
+ ************************************************************************/
+double Projectile::getVacuumImpactTime() const
+{
+   if (!isFlying())
+      return 0.0;
+   const PositionVelocityTime& state = flightPath.back();
+   return state.t + impactTimeFromVacuum(state.pos.getMetersY(), state.v.getDY(), GRAVITY);
+}
+
 /***********************************************************************
  * ADVANCE
  * Advances the projectile forward in time.
  ************************************************************************/
 void Projectile::advance(double simulationTime)
 {
+   PROFILE_SCOPE(PROFILE_ADVANCE);
+
    // If there are no projectiles in flight, do nothing
    if (flightPath.empty())
    {
@@ -43,51 +95,65 @@ void Projectile::advance(double simulationTime)
    // Get the last state of the projectile
    PositionVelocityTime lastState = flightPath.back();
 
-   // Constants
-   double speed = lastState.v.getSpeed();
-   const double dragCoefficient = dragFromMach(speed /
-      speedSoundFromAltitude(lastState.pos.getMetersY()));
-   const double airDensity = densityFromAltitude(lastState.pos.getMetersY());
+   // Gravity pulls down, and drag pushes back along the airspeed
+   Vec2d acceleration(0.0, GRAVITY);
 
-   // Calculate the drag force
-   double dragForce = forceFromDrag(airDensity, dragCoefficient,
-      DEFAULT_PROJECTILE_RADIUS, speed);
+   // No air to speak of: gravity alone, with no lookups at all
+   if (!isVacuum())
+   {
+      // The weather where we are. Calm air is the standard atmosphere
+      AtmosphereSample air;
+      if (pAtmosphere != nullptr)
+         air = pAtmosphere->sample(lastState.pos.getMetersY(), cursorAtmosphere);
 
-   // Calculate the acceleration due to drag
-   double accelerationDrag =
-      accelerationFromForce(dragForce, DEFAULT_PROJECTILE_WEIGHT);
+      // Drag acts against our motion through the air, not over the ground
+      Velocity airspeed(lastState.v.getDX() - air.windX, lastState.v.getDY());
 
-   // Calculate the acceleration components due to drag
-   double dragAccelerationX = (speed != 0) ? -accelerationDrag *
-      (lastState.v.getDX() / speed) : 0;
-   double dragAccelerationY = (speed != 0) ? accelerationDrag *
-      (lastState.v.getDY() / speed) : 0;
+      // Constants
+      double speed = airspeed.getSpeed();
+      double accelerationDrag;
+      if (pDragTable != nullptr && air.temperatureOffset == 0.0)
+      {
+         // One read from the table built for this shell
+         assert(pDragTable->getMass() == mass && pDragTable->getRadius() == radius);
+         assert(pDragTable->getInterpolation() == interpolation);
+         accelerationDrag = pDragTable->getDeceleration(lastState.pos.getMetersY(), speed) *
+            air.densityScale;
+      }
+      else
+      {
+         const double speedSound = speedSoundFromAltitude(lastState.pos.getMetersY(),
+            cursorSpeedSound, interpolation);
+         const double dragCoefficient = dragFromMach(speed /
+            AtmosphereProfile::speedSound(speedSound, air), cursorDrag, interpolation);
+         const double airDensity = AtmosphereProfile::density(
+            densityFromAltitude(lastState.pos.getMetersY(), cursorDensity, interpolation),
+            speedSound, air);
 
-   // Calculate the new time
-   double newTime = lastState.t + simulationTime;
+         // Calculate the drag force
+         double dragForce = forceFromDrag(airDensity, dragCoefficient,
+            radius, speed);
 
-   // Calculate the new velocity
+         // Calculate the acceleration due to drag
+         accelerationDrag = accelerationFromForce(dragForce, mass);
+      }
+
+      // Calculate the acceleration components due to drag
+      if (speed != 0)
+         acceleration -= airspeed.getVector() / speed * accelerationDrag;
+   }
+
+   // Calculate the new position and velocity
+   //    s = s0 + v t + 1/2 a t^2
+   //    v = v0 + a t
    PositionVelocityTime newState;
-   newState.t = newTime;
-   double newPositionX = lastState.pos.getMetersX() + lastState.v.getDX() *
-      simulationTime + 0.5 * dragAccelerationX * simulationTime * simulationTime;
-   double newPositionY = lastState.pos.getMetersY() + lastState.v.getDY() *
-      simulationTime + 0.5 * (GRAVITY - dragAccelerationY) * simulationTime * simulationTime;
-   newState.pos.setMetersX(newPositionX);
-   newState.pos.setMetersY(newPositionY);
-
-   // Update vertical position and velocity
-   double newVelocityX = lastState.v.getDX() +
-      dragAccelerationX * simulationTime;
-   double newVelocityY = lastState.v.getDY() +
-      (GRAVITY - dragAccelerationY) * simulationTime;
-   newState.v.setDX(newVelocityX);
-   newState.v.setDY(newVelocityY);
-
-   // Add the new state to the flight path
+   newState.t = lastState.t + simulationTime;
+   newState.pos.setMeters(lastState.pos.getMeters() +
+      lastState.v.getVector() * simulationTime +
+      acceleration * 0.5 * simulationTime * simulationTime);
+   newState.v = Velocity(lastState.v.getVector() + acceleration * simulationTime);
+
+   // Add the new state to the flight path. Once it is full, this
+   // drops the oldest
    flightPath.push_back(newState);
-   while (flightPath.size() > 10)
-   {
-      flightPath.pop_front();
-   }
 }
\ No newline at end of file
@@ -9,15 +9,18 @@
 
 #pragma once
 
-#include <list>
+#include "ringBuffer.h"
 #include "position.h"
 #include "velocity.h"
 #include "physics.h"
 #include "uiDraw.h"
+#include "dragTable.h"
+#include "atmosphere.h"
 
 #define DEFAULT_PROJECTILE_WEIGHT 46.7       // kg
 #define DEFAULT_PROJECTILE_RADIUS 0.077545   // m
 #define GRAVITY -9.8064
+#define FLIGHT_PATH_LENGTH 10                // steps kept for the trail
 
  // forward declaration for the unit test class
 class TestProjectile;
@@ -33,14 +36,23 @@ public:
    friend::TestProjectile;
 
    // create a new projectile with the default settings
-   Projectile() : mass(DEFAULT_PROJECTILE_WEIGHT), radius(DEFAULT_PROJECTILE_RADIUS), flightPath() {}
+   Projectile() : mass(DEFAULT_PROJECTILE_WEIGHT), radius(DEFAULT_PROJECTILE_RADIUS),
+      fDrag(true), interpolation(INTERPOLATE_LINEAR), pDragTable(nullptr),
+      pAtmosphere(nullptr), timeFired(0.0), flightPath() {}
 
    // reset the game
    void reset()
    {
       flightPath.clear();
+      posFired = Position();
+      timeFired = 0.0;
       mass = DEFAULT_PROJECTILE_WEIGHT;
       radius = DEFAULT_PROJECTILE_RADIUS;
+      fDrag = true;
+      interpolation = INTERPOLATE_LINEAR;
+      pDragTable = nullptr;
+      pAtmosphere = nullptr;
+      resetCursors();
    }
 
    // advance the round forward until the next unit of time
@@ -51,36 +63,76 @@ public:
    Position getPosition() const { return isFlying() ? flightPath.back().pos : Position(); }
    double getFlightTime() const
    {
-      return (flightPath.size() >= 2) ? flightPath.back().t - flightPath.front().t : 0.0;
+      return isFlying() ? flightPath.back().t - timeFired : 0.0;
    }
    double getFlightDistance() const
    {
-      return (flightPath.size() >= 2) ?
-         abs(flightPath.front().pos.getMetersX() - flightPath.back().pos.getMetersX()) : 0.0;
+      return isFlying() ? abs(posFired.getMetersX() - flightPath.back().pos.getMetersX()) : 0.0;
    }
    double getSpeed() const { return isFlying() ? flightPath.back().v.getSpeed() : 0.0; }
+   Velocity getVelocity() const { return isFlying() ? flightPath.back().v : Velocity(); }
    double getCurrentTime() const { return isFlying() ? flightPath.back().t : 0.0; }
+   double getPreviousTime() const   // of the step before, if there was one
+   {
+      return (flightPath.size() >= 2) ? std::next(flightPath.crbegin())->t : getCurrentTime();
+   }
 
    // setters
    void setMass(double mass) { this->mass = mass; }
    void setRadius(double radius) { this->radius = radius; }
+   void setDrag(bool fDrag) { this->fDrag = fDrag; }   // false for training
+
+   // read the atmosphere and drag tables smoothly rather than linearly
+   void setInterpolation(InterpolationMode interpolation) { this->interpolation = interpolation; }
+
+   // look drag up in a table built for this shell, and the same
+   // interpolation, instead of computing it. The table must outlive
+   // the flight. nullptr goes back to the exact path
+   void setDragTable(const DragTable* pDragTable) { this->pDragTable = pDragTable; }
+
+   // fly through measured weather rather than the standard day. The
+   // profile must outlive the flight. nullptr goes back to calm air
+   void setAtmosphere(const AtmosphereProfile* pAtmosphere)
+   {
+      this->pAtmosphere = pAtmosphere;
+      cursorAtmosphere = LookupCursor();
+   }
 
    // are we flying?
    bool isFlying() const { return !flightPath.empty(); }
 
-   // draw the projectile
-   void draw(ogstream& gout) const
+   // will drag slow us down this step, or is it the closed form?
+   bool isVacuum() const
    {
-      for (auto it = flightPath.cbegin(); it != flightPath.cend(); ++it)
-         gout.drawProjectile(it->pos, getCurrentTime() - it->t);
+      return !fDrag || (isFlying() && flightPath.back().pos.getMetersY() >= ALTITUDE_VACUUM);
    }
 
+   // when the shell would reach the ground with no more drag, in
+   // simulation time. Exact in a vacuum, a lower bound otherwise
+   double getVacuumImpactTime() const;
+
+   // where the projectile appears a fraction of the way between the
+   // last two physics steps. 0.0 is the previous step, 1.0 is the current
+   Position getPosition(double alpha) const;
+
+   // draw the projectile
+   void draw(ogstream& gout, double alpha = 1.0) const;
+
    // fire the projectile
    void fire(const Position& posHowitzer, double simulationTime,
       const Angle& elevation, double muzzleVelocity);
 
 private:
 
+   // start every table lookup from the bottom again
+   void resetCursors()
+   {
+      cursorSpeedSound = LookupCursor();
+      cursorDensity = LookupCursor();
+      cursorDrag = LookupCursor();
+      cursorAtmosphere = LookupCursor();
+   }
+
    // keep track of one moment in the path of the projectile
    struct PositionVelocityTime
    {
@@ -92,5 +144,22 @@ private:
 
    double mass;           // weight of the M795 projectile. Defaults to 46.7 kg
    double radius;         // radius of M795 projectile. Defaults to 0.077545 m
-   std::list<PositionVelocityTime> flightPath;
+   bool fDrag;            // false flies the projectile in a vacuum
+   InterpolationMode interpolation;  // how the tables are read
+   const DragTable* pDragTable;  // if set, where the drag comes from
+   const AtmosphereProfile* pAtmosphere;  // if set, the wind and weather
+
+   // where in each table the last step looked
+   LookupCursor cursorSpeedSound;
+   LookupCursor cursorDensity;
+   LookupCursor cursorDrag;
+   LookupCursor cursorAtmosphere;
+
+   // where and when it left the muzzle. The trail soon forgets
+   Position posFired;
+   double timeFired;
+
+   // the last few steps, newest at the back. Fixed size, so a shell
+   // can be fired and flown without touching the heap
+   RingBuffer<PositionVelocityTime, FLIGHT_PATH_LENGTH> flightPath;
 };
\ No newline at end of file
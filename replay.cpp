@@ -0,0 +1,185 @@
+/***********************************************************************
+ * Source File:
+ *    REPLAY
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Record the keys of a session and play them back
+ ************************************************************************/
+
+#include "replay.h"
+#include "littleEndian.h"
+#include <cstring>     // for memcmp()
+#include <algorithm>   // for min()
+#include <cmath>       // for llround()
+#include <cassert>
+using namespace std;
+
+const char     INPUT_MAGIC[8] = { 'M', '7', '7', '7', 'I', 'N', 'P', 'T' };
+const uint32_t INPUT_VERSION  = 2;   // 1 had no frame time
+
+/*********************************************
+ * INPUT LOG : GET NUM FRAMES
+ *********************************************/
+long long InputLog::getNumFrames() const
+{
+   long long numFrames = 0;
+   for (const InputRun& run : runs)
+      numFrames += (long long)run.count;
+   return numFrames;
+}
+
+/*********************************************
+ * INPUT RECORDER : CONSTRUCTOR
+ *********************************************/
+InputRecorder::InputRecorder(ostream& out, unsigned int seed, const View& view) :
+   out(out), keys(0), delta(0), count(0), numFrames(0)
+{
+   out.write(INPUT_MAGIC, 8);
+   writeU32(out, INPUT_VERSION);
+   writeU32(out, seed);
+   writeF64(out, view.getZoom());
+   writeU32(out, (uint32_t)view.getWidth());
+   writeU32(out, (uint32_t)view.getHeight());
+   out.flush();
+}
+
+/*********************************************
+ * INPUT RECORDER : RECORD
+ *********************************************/
+void InputRecorder::record(unsigned int keys, double delta)
+{
+   assert(keys < 256);
+   assert(delta >= 0.0);
+   uint64_t micro = (uint64_t)llround(delta * 1.0e6);
+   if (count > 0 && (keys != this->keys || micro != this->delta))
+      writeRun();
+   this->keys = keys;
+   this->delta = micro;
+   count++;
+   numFrames++;
+}
+
+/*********************************************
+ * INPUT RECORDER : FINISH
+ *********************************************/
+void InputRecorder::finish()
+{
+   if (count > 0)
+      writeRun();
+}
+
+/*********************************************
+ * INPUT RECORDER : WRITE RUN
+ * The keys, then the frame time and the count seven bits at a time
+ *********************************************/
+void InputRecorder::writeRun()
+{
+   out.put((char)keys);
+   writeVarint(out, delta);
+   writeVarint(out, count);
+   out.flush();
+   count = 0;
+}
+
+/*********************************************
+ * READ INPUT LOG
+ *********************************************/
+bool readInputLog(istream& in, InputLog& log, string& error)
+{
+   char magic[8];
+   uint32_t version;
+   uint32_t seed;
+   double zoom;
+   uint32_t width;
+   uint32_t height;
+   if (!in.read(magic, 8) || memcmp(magic, INPUT_MAGIC, 8) != 0 || !readU32(in, version))
+   {
+      error = "not an input log";
+      return false;
+   }
+   if (version != 1 && version != INPUT_VERSION)
+   {
+      error = "version " + to_string(version) + " is not supported";
+      return false;
+   }
+   if (!readU32(in, seed) || !readF64(in, zoom) ||
+       !readU32(in, width) || !readU32(in, height) || !(zoom > 0.0))
+   {
+      error = "the header is cut short";
+      return false;
+   }
+   log.seed = seed;
+   log.view = View(zoom, (int)width, (int)height);
+   log.runs.clear();
+
+   // runs until the end of the file
+   int keys;
+   while ((keys = in.get()) != EOF)
+   {
+      InputRun run;
+      run.keys = (unsigned int)keys;
+      run.delta = INPUT_FRAME_DELTA;
+      if ((version > 1 && !readVarint(in, run.delta)) || !readVarint(in, run.count))
+      {
+         error = "the log ends in the middle of a run";
+         return false;
+      }
+      log.runs.push_back(run);
+   }
+   return true;
+}
+
+/*********************************************
+ * SCRIPT INPUT
+ * Swing the gun half a radian to the right, then take turns swinging
+ * it across to the same angle on the other side. Fire after each
+ * swing and watch the shell fly
+ *********************************************/
+InputLog scriptInput(long long numFrames, unsigned int seed, const View& view)
+{
+   InputLog log;
+   log.seed = seed;
+   log.view = view;
+   for (long long frame = 0; frame < numFrames; frame += SCRIPT_CYCLE)
+   {
+      long long cycle = frame / SCRIPT_CYCLE;
+      unsigned int keyAim = (cycle == 0) ? INPUT_RIGHT :
+                            (cycle % 2)  ? INPUT_LEFT  : INPUT_RIGHT;
+      const unsigned int keys[3]   = { keyAim, INPUT_SPACE, 0 };
+      const uint64_t     counts[3] = { (cycle == 0) ? 5u : 10u, 1, SCRIPT_CYCLE };
+
+      // the last cycle stops wherever the frames run out
+      uint64_t left = (uint64_t)min((long long)SCRIPT_CYCLE, numFrames - frame);
+      for (int i = 0; i < 3 && left > 0; i++)
+      {
+         log.runs.push_back(InputRun { keys[i], INPUT_FRAME_DELTA, min(counts[i], left) });
+         left -= log.runs.back().count;
+      }
+   }
+   return log;
+}
+
+/*********************************************
+ * REPLAY INPUT
+ * The same order as the window's draw callback: the keys and the frame
+ * time are there when the client is called, and the keys age once it
+ * returns
+ *********************************************/
+long long replayInput(const InputLog& log,
+                      void (*callBack)(const Interface*, void*), void* p)
+{
+   Interface ui;
+   ui.setInput(0);
+   long long numFrames = 0;
+   for (const InputRun& run : log.runs)
+      for (uint64_t i = 0; i < run.count; i++)
+      {
+         ui.setInput(run.keys);
+         ui.setFrameDelta((double)run.delta / 1.0e6);
+         callBack(&ui, p);
+         ui.keyEvent();
+         numFrames++;
+      }
+   return numFrames;
+}
@@ -0,0 +1,106 @@
+/***********************************************************************
+ * Header File:
+ *    REPLAY
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Record the keys held in every frame of a session and how long the
+ *    frame took, along with the random seed and the view, and play them
+ *    back without a window. The simulator only looks at the keys, the
+ *    frame's time and rand(), so a replay goes through exactly the same
+ *    frames as the session did.
+ *
+ *    An input log is little-endian:
+ *       "M777INPT"  u32 version  u32 seed  f64 zoom  u32 width  u32 height
+ *    then one run per change of keys or of frame time, to the end of
+ *    the file:
+ *       u8 INPUT_ bits   varint microseconds a frame   varint frames
+ *    where a varint is 7 bits a byte, low bits first, and the high bit
+ *    set on every byte but the last. A version 1 log has no frame time,
+ *    and its frames are read as INPUT_FRAME_DELTA.
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <cstdint>      // for uint32_t and uint64_t
+#include "uiInteract.h" // for Interface and INPUT_
+#include "view.h"
+
+#define INPUT_LOG_ENV     "M777_RECORD"   // names the file the game records itself to
+#define SCRIPT_CYCLE      150             // frames between scripted shots
+#define INPUT_FRAME_DELTA 33333           // us, a frame at 30 a second
+
+/*********************************************
+ * INPUT RUN
+ * The same keys held for count frames in a row, each as long
+ *********************************************/
+struct InputRun
+{
+   unsigned int keys;   // INPUT_ bits
+   uint64_t delta;      // us since the frame before, each frame
+   uint64_t count;      // frames
+};
+
+/*********************************************
+ * INPUT LOG
+ * A whole session, read back from a file
+ *********************************************/
+struct InputLog
+{
+   InputLog() : seed(0) {}
+
+   long long getNumFrames() const;
+
+   unsigned int seed;   // what srand() was given
+   View view;           // what the simulator was built with
+   std::vector<InputRun> runs;
+};
+
+/*********************************************
+ * INPUT RECORDER
+ * Write the log as the session goes. A run is written when the keys or
+ * the frame time change, so a crash loses no more than the run it was in
+ *********************************************/
+class InputRecorder
+{
+public:
+   // writes the header right away
+   InputRecorder(std::ostream& out, unsigned int seed, const View& view);
+   ~InputRecorder() { finish(); }
+
+   // one more frame with these INPUT_ bits held, delta s after the last
+   void record(unsigned int keys, double delta);
+
+   // write the run in progress
+   void finish();
+
+   long long getNumFrames() const { return numFrames; }
+
+private:
+   void writeRun();
+
+   std::ostream& out;
+   unsigned int keys;     // of the run in progress
+   uint64_t delta;        // us, of the run in progress
+   uint64_t count;        // frames in the run in progress
+   long long numFrames;
+};
+
+// read a whole log. False, with the reason in error, if it is not one
+bool readInputLog(std::istream& in, InputLog& log, std::string& error);
+
+// a session nobody played: every SCRIPT_CYCLE frames, move the gun a
+// little and fire. For running the game without a keyboard or a
+// recording
+InputLog scriptInput(long long numFrames, unsigned int seed, const View& view);
+
+// play every frame of the log through callBack as fast as it will go,
+// setting the keys and the frame time and aging the keys the way the
+// window does. Seed rand()
+// with log.seed and build the simulator before calling. Returns the
+// number of frames played
+long long replayInput(const InputLog& log,
+                      void (*callBack)(const Interface*, void*), void* p);
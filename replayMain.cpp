@@ -0,0 +1,165 @@
+/***********************************************************************
+ * Source File:
+ *    REPLAY MAIN
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Run the game without a window, as fast as it will go, and say how
+ *    many frames a second that is. The keys come from a recorded
+ *    session or from a script. The game records a session when
+ *    M777_RECORD names the file to record it to.
+ *
+ *    replay session.input [--draw=null|raster|none] [--png=file]
+ *    replay --script=frames [--seed=n] [--draw=null|raster|none] [--png=file]
+ *
+ *    null draws everything but puts it nowhere, raster draws it into
+ *    memory, and none skips drawing. With raster, the last frame's
+ *    checksum is shown, so two runs can be seen to match, and --png
+ *    saves it. Built with PROFILE defined, it also shows where the time
+ *    went and writes profile.json and trace.json.
+ ************************************************************************/
+
+#include <fstream>      // for ifstream
+#include <chrono>       // for steady_clock
+#include <cstdio>       // for printf()
+#include <cstring>      // for strncmp()
+#include <cstdlib>      // for srand() and atoll()
+#include "replay.h"
+#include "simulation.h" // for SIMULATION
+#include "uiRaster.h"   // for drawing into memory
+#include "profile.h"    // for PROFILE
+using namespace std;
+
+#define SCRIPT_SEED 1   // the ground a script plays on unless told otherwise
+
+/*************************************
+ * HEADLESS
+ * Everything the callback needs
+ **************************************/
+struct Headless
+{
+   Simulator* pSim;
+   ogstream* pgout;          // where to draw, or null to not draw
+   ogstreamRaster* pRaster;  // the same, if it is to memory
+};
+
+/*************************************
+ * The game's callback, drawing with whatever we were given
+ **************************************/
+void callBack(const Interface* pUI, void* p)
+{
+   Headless* pHeadless = (Headless*)p;
+   pHeadless->pSim->update(pUI);
+   pHeadless->pSim->gameplay(pUI);
+
+   if (pHeadless->pgout)
+   {
+      pUI->beginDraw();
+      if (pHeadless->pRaster)
+         pHeadless->pRaster->clear();
+      pHeadless->pSim->display(*pHeadless->pgout);
+   }
+}
+
+/*********************************************
+ * MAIN
+ *********************************************/
+int main(int argc, char** argv)
+{
+   const char* logName = nullptr;
+   const char* draw = "null";
+   const char* pngName = nullptr;
+   long long numScripted = 0;
+   unsigned int seed = SCRIPT_SEED;
+   bool fUsage = false;
+
+   for (int i = 1; i < argc; i++)
+   {
+      if (strncmp(argv[i], "--script=", 9) == 0)
+         numScripted = atoll(argv[i] + 9);
+      else if (strncmp(argv[i], "--seed=", 7) == 0)
+         seed = (unsigned int)atoll(argv[i] + 7);
+      else if (strncmp(argv[i], "--draw=", 7) == 0)
+         draw = argv[i] + 7;
+      else if (strncmp(argv[i], "--png=", 6) == 0)
+         pngName = argv[i] + 6;
+      else if (argv[i][0] != '-' && logName == nullptr)
+         logName = argv[i];
+      else
+         fUsage = true;
+   }
+   bool fRaster = strcmp(draw, "raster") == 0;
+   if (fUsage || (logName == nullptr) == (numScripted <= 0) ||
+       (!fRaster && strcmp(draw, "null") != 0 && strcmp(draw, "none") != 0) ||
+       (pngName != nullptr && !fRaster))
+   {
+      fprintf(stderr, "usage: %s session.input [--draw=null|raster|none] [--png=file]\n"
+                      "       %s --script=frames [--seed=n] [--draw=null|raster|none] "
+                      "[--png=file]\n", argv[0], argv[0]);
+      return 2;
+   }
+
+   // the keys, from a file or made up
+   InputLog log;
+   if (logName != nullptr)
+   {
+      string error;
+      ifstream fin(logName, ios::binary);
+      if (!fin.is_open())
+         error = "unable to read it";
+      else
+         readInputLog(fin, log, error);
+      if (!error.empty())
+      {
+         fprintf(stderr, "%s: %s\n", logName, error.c_str());
+         return 2;
+      }
+   }
+   else
+      log = scriptInput(numScripted, seed, View(40.0, 700, 500));
+
+#ifdef PROFILE
+   profileDumpOnExit("profile.json", "trace.json");
+#endif
+
+   // the same random numbers, in the same order, as the session
+   srand(log.seed);
+   Simulator sim(log.view);
+   ogstreamNull goutNull(log.view);
+   ogstreamRaster goutRaster(log.view);
+   Headless headless = { &sim, nullptr, nullptr };
+   if (fRaster)
+      headless.pgout = headless.pRaster = &goutRaster;
+   else if (strcmp(draw, "null") == 0)
+      headless.pgout = &goutNull;
+
+   auto begin = chrono::steady_clock::now();
+   long long numFrames = replayInput(log, callBack, (void*)&headless);
+   auto end = chrono::steady_clock::now();
+
+   double seconds = chrono::duration<double>(end - begin).count();
+   printf("%lld frames (%.1f minutes at 30 fps) in %.3f s, %.0f frames/s\n",
+          numFrames, numFrames / 30.0 / 60.0, seconds,
+          seconds > 0.0 ? numFrames / seconds : 0.0);
+   printf("%d targets hit\n", sim.getNumHits());
+   if (profileCount(PROFILE_UPDATE) > 0)
+      printf("update    p50 %.1fus  p99 %.1fus\n"
+             "gameplay  p50 %.1fus  p99 %.1fus\n"
+             "display   p50 %.1fus  p99 %.1fus\n",
+             profilePercentile(PROFILE_UPDATE, 0.50),
+             profilePercentile(PROFILE_UPDATE, 0.99),
+             profilePercentile(PROFILE_GAMEPLAY, 0.50),
+             profilePercentile(PROFILE_GAMEPLAY, 0.99),
+             profilePercentile(PROFILE_DISPLAY, 0.50),
+             profilePercentile(PROFILE_DISPLAY, 0.99));
+   if (fRaster)
+   {
+      printf("last frame checksum %08x\n", goutRaster.checksum());
+      if (pngName != nullptr && !goutRaster.savePNG(pngName))
+      {
+         fprintf(stderr, "Unable to write %s\n", pngName);
+         return 1;
+      }
+   }
+   return 0;
+}
@@ -0,0 +1,111 @@
+/***********************************************************************
+ * Header File:
+ *    RING BUFFER
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    A fixed number of the most recent items, oldest first. The room
+ *    for all of them is part of the object, so pushing never allocates.
+ ************************************************************************/
+
+#pragma once
+
+#include <iterator>    // for bidirectional_iterator_tag and reverse_iterator
+#include <cstddef>     // for ptrdiff_t
+#include <cassert>
+
+class TestRingBuffer;
+
+/*********************************************
+ * RING BUFFER
+ * Enough of std::list's interface to stand in for one that is never
+ * allowed to grow past N: pushing onto a full buffer drops the oldest.
+ *********************************************/
+template <class T, int N>
+class RingBuffer
+{
+public:
+   friend ::TestRingBuffer;
+
+   /*********************************************
+    * CONST ITERATOR
+    * Walks from the oldest item to the newest
+    *********************************************/
+   class const_iterator
+   {
+   public:
+      typedef std::bidirectional_iterator_tag iterator_category;
+      typedef T                               value_type;
+      typedef std::ptrdiff_t                  difference_type;
+      typedef const T*                        pointer;
+      typedef const T&                        reference;
+
+      const_iterator() : pBuffer(nullptr), i(0) {}
+      const_iterator(const RingBuffer* pBuffer, int i) : pBuffer(pBuffer), i(i) {}
+
+      reference operator *  () const { return pBuffer->at(i); }
+      pointer   operator -> () const { return &pBuffer->at(i); }
+      const_iterator& operator ++ ()    { ++i; return *this; }
+      const_iterator& operator -- ()    { --i; return *this; }
+      const_iterator  operator ++ (int) { const_iterator it(*this); ++i; return it; }
+      const_iterator  operator -- (int) { const_iterator it(*this); --i; return it; }
+      bool operator == (const const_iterator& rhs) const { return i == rhs.i && pBuffer == rhs.pBuffer; }
+      bool operator != (const const_iterator& rhs) const { return !(*this == rhs); }
+
+   private:
+      const RingBuffer* pBuffer;
+      int i;                       // 0 is the oldest
+   };
+   typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+   RingBuffer() : head(0), num(0) {}
+
+   // how full are we?
+   bool empty()           const { return num == 0; }
+   int  size()            const { return num;      }
+   static int capacity()        { return N;        }
+
+   // the oldest and the newest
+   const T& front() const { assert(num > 0); return at(0);       }
+   const T& back()  const { assert(num > 0); return at(num - 1); }
+   T& front()             { assert(num > 0); return data[head];  }
+   T& back()              { assert(num > 0); return data[index(num - 1)]; }
+
+   // add the newest, dropping the oldest if there is no room
+   void push_back(const T& t)
+   {
+      if (num == N)
+      {
+         data[head] = t;
+         head = (head + 1) % N;
+      }
+      else
+         data[index(num++)] = t;
+   }
+
+   // forget the oldest
+   void pop_front()
+   {
+      assert(num > 0);
+      head = (head + 1) % N;
+      num--;
+   }
+
+   void clear() { head = 0; num = 0; }
+
+   // oldest to newest, or newest to oldest
+   const_iterator begin()  const { return const_iterator(this, 0);   }
+   const_iterator end()    const { return const_iterator(this, num); }
+   const_iterator cbegin() const { return begin(); }
+   const_iterator cend()   const { return end();   }
+   const_reverse_iterator crbegin() const { return const_reverse_iterator(end());   }
+   const_reverse_iterator crend()   const { return const_reverse_iterator(begin()); }
+
+private:
+   int index(int i) const { return (head + i) % N; }
+   const T& at(int i) const { return data[index(i)]; }
+
+   T data[N];
+   int head;     // where the oldest item is
+   int num;      // how many items there are
+};
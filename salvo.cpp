@@ -0,0 +1,84 @@
+/***********************************************************************
+ * Source File:
+ *    SALVO
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Every shell in the air at once
+ ************************************************************************/
+
+#include "salvo.h"
+#include "angle.h"
+#include <cassert>
+using namespace std;
+
+/***********************************************************************
+ * SALVO : FIRE
+ * Take the next shell out of the pool. It starts with the default
+ * settings, the same as a shell that was never fired, or with the
+ * settings of the shell given
+ ************************************************************************/
+bool Salvo::fire(const Position& posHowitzer, double simulationTime,
+                 const Angle& elevation, double muzzleVelocity)
+{
+   if (numFlying == getCapacity())
+      return false;
+
+   Projectile& shell = shells[numFlying++];
+   shell.reset();
+   shell.fire(posHowitzer, simulationTime, elevation, muzzleVelocity);
+   return true;
+}
+
+bool Salvo::fire(const Projectile& shell, const Position& posHowitzer,
+                 double simulationTime, const Angle& elevation, double muzzleVelocity)
+{
+   if (numFlying == getCapacity())
+      return false;
+
+   Projectile& shellNext = shells[numFlying++];
+   shellNext = shell;
+   shellNext.fire(posHowitzer, simulationTime, elevation, muzzleVelocity);
+   return true;
+}
+
+/***********************************************************************
+ * SALVO : ADVANCE
+ * Two passes over the pool. The first checks every shell against the
+ * ground and closes up the gaps the landed ones leave, keeping the
+ * rest in firing order. The second steps the survivors, which are
+ * now one unbroken run at the front
+ ************************************************************************/
+int Salvo::advance(double simulationTime, const Ground& ground)
+{
+   // impacts: keep only the shells still above the ground. A shell
+   // just fired sits right on it, at the muzzle, and is on its way up
+   int numKept = 0;
+   for (int i = 0; i < numFlying; i++)
+   {
+      const Position pos = shells[i].getPosition();
+      if (ground.getElevationMeters(pos) <= pos.getMetersY())
+      {
+         if (numKept != i)
+            shells[numKept] = shells[i];   // into the gap a landed shell left
+         numKept++;
+      }
+   }
+   int numLanded = numFlying - numKept;
+   numFlying = numKept;
+
+   // physics: step every shell still in the air
+   for (int i = 0; i < numFlying; i++)
+      shells[i].advance(simulationTime);
+
+   return numLanded;
+}
+
+/***********************************************************************
+ * SALVO : DRAW
+ ************************************************************************/
+void Salvo::draw(ogstream& gout, double alpha) const
+{
+   for (int i = 0; i < numFlying; i++)
+      shells[i].draw(gout, alpha);
+}
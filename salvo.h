@@ -0,0 +1,69 @@
+/***********************************************************************
+ * Header File:
+ *    SALVO
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Every shell in the air at once. The shells live in one block that
+ *    is allocated up front, so firing and landing never allocate.
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <cassert>
+#include "projectile.h"
+#include "ground.h"
+
+#define DEFAULT_SALVO_CAPACITY 4096   // shells in the air at one time
+
+class TestSalvo;
+
+/*********************************************
+ * SALVO
+ * A pool of projectiles. The first getNumFlying() are in the air, in
+ * the order they were fired, so the newest is always the last one.
+ *********************************************/
+class Salvo
+{
+public:
+   friend ::TestSalvo;
+
+   Salvo(int capacity = DEFAULT_SALVO_CAPACITY) : shells(capacity), numFlying(0)
+   {
+      assert(capacity > 0);
+   }
+
+   // send one more shell on its way. False if the whole pool is in the air
+   bool fire(const Position& posHowitzer, double simulationTime,
+             const Angle& elevation, double muzzleVelocity);
+
+   // the same, with a shell of shell's mass, radius, drag and tables
+   bool fire(const Projectile& shell, const Position& posHowitzer,
+             double simulationTime, const Angle& elevation, double muzzleVelocity);
+
+   // retire every shell that is on or under the ground, then step the
+   // rest forward. Returns how many landed
+   int advance(double simulationTime, const Ground& ground);
+
+   // bring every shell down at once
+   void reset() { numFlying = 0; }
+
+   // getters
+   int  getNumFlying() const { return numFlying; }
+   int  getCapacity()  const { return (int)shells.size(); }
+   bool isFlying()     const { return numFlying > 0; }
+   const Projectile& operator [] (int i) const
+   {
+      assert(i >= 0 && i < numFlying);
+      return shells[i];
+   }
+   const Projectile& getNewest() const { return (*this)[numFlying - 1]; }
+
+   // draw every shell in the air
+   void draw(ogstream& gout, double alpha = 1.0) const;
+
+private:
+   std::vector<Projectile> shells;   // never resized after construction
+   int numFlying;                    // shells[0 .. numFlying-1] are in the air
+};
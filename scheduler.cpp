@@ -0,0 +1,74 @@
+/***********************************************************************
+ * Source File:
+ *    SCHEDULER
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Plan a time-on-target volley for a battery
+ ************************************************************************/
+
+#include "scheduler.h"
+#include "parallel.h"  // for parallelFor()
+#include <cmath>       // for fabs()
+#include <cassert>
+using namespace std;
+
+/*********************************************
+ * SCHEDULE TIME ON TARGET
+ * Two passes. The first reads every gun it can from the cache, which
+ * takes microseconds. The second spreads whatever is left over the
+ * cores, since each one is several full trajectories
+ *********************************************/
+Volley scheduleTimeOnTarget(const Battery& battery, const Position& posTarget,
+                            const ShotSpec& spec, double window,
+                            bool fHighAngle, const FiringTableCache* pCache,
+                            int numThreads, ScheduleStats* pStats)
+{
+   assert(window >= 0.0);
+   Volley volley;
+   volley.orders.resize(battery.size());
+   ScheduleStats stats;
+
+   vector<ShotSpec> shots(battery.size(), spec);
+   vector<double> distances(battery.size());
+   vector<double> heights(battery.size());
+   vector<int> iUnsolved;
+   for (int i = 0; i < battery.size(); i++)
+   {
+      shots[i].muzzleVelocity = battery[i].getMuzzleVelocity();
+      distances[i] = posTarget.getMetersX() - battery[i].getPosition().getMetersX();
+      heights[i] = posTarget.getMetersY() - battery[i].getPosition().getMetersY();
+
+      const FiringTable* pTable = pCache == nullptr ? nullptr : pCache->find(shots[i]);
+      if (pTable != nullptr)
+      {
+         double errorTime;
+         double errorRange;
+         double maxRange;
+         FiringSolution solution = pTable->lookup(distances[i], heights[i], fHighAngle,
+                                                  errorTime, errorRange, maxRange);
+         bool fOutOfReach = fabs(distances[i]) > maxRange;
+         if (fOutOfReach ||
+             (solution.fValid && errorTime <= window / 2.0 && errorRange <= SOLVER_TOLERANCE))
+         {
+            volley.orders[i].solution = solution;
+            stats.numFromTable++;
+            continue;
+         }
+      }
+      iUnsolved.push_back(i);
+   }
+
+   parallelFor((int)iUnsolved.size(), numThreads, [&](int job)
+   {
+      int i = iUnsolved[job];
+      volley.orders[i].solution = solveElevation(distances[i], heights[i], shots[i],
+                                                 fHighAngle);
+   });
+   stats.numSolved = (int)iUnsolved.size();
+
+   volley.timeOnTarget();
+   if (pStats != nullptr)
+      *pStats = stats;
+   return volley;
+}
@@ -0,0 +1,42 @@
+/***********************************************************************
+ * Header File:
+ *    SCHEDULER
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Plan a time-on-target volley for a battery: an elevation and a
+ *    fire delay for every gun so all the shells land together. Guns
+ *    with a firing table are read from it; the rest are solved.
+ ************************************************************************/
+
+#pragma once
+
+#include "battery.h"
+#include "firingTable.h"
+
+#define TOT_WINDOW 0.5   // s, how far apart the shells may land
+
+/*********************************************
+ * SCHEDULE STATS
+ * Where each gun's solution came from
+ *********************************************/
+struct ScheduleStats
+{
+   ScheduleStats() : numFromTable(0), numSolved(0) {}
+
+   int numFromTable;   // read from a cached firing table
+   int numSolved;      // flown by the solver
+};
+
+// the time-on-target plan for posTarget. A gun's table is used when
+// its time of flight is good to half the window, so no two shells can
+// land further apart than window, and its range is good to the
+// solver's tolerance; every other gun is solved, one per thread. The
+// shot comes from spec; its elevation and muzzle velocity are ignored.
+// Each gun aims at the target's height above its own. The battery is
+// not moved: Battery::point() lays the guns
+Volley scheduleTimeOnTarget(const Battery& battery, const Position& posTarget,
+                            const ShotSpec& spec, double window = TOT_WINDOW,
+                            bool fHighAngle = false,
+                            const FiringTableCache* pCache = nullptr,
+                            int numThreads = 0, ScheduleStats* pStats = nullptr);
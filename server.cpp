@@ -0,0 +1,169 @@
+/***********************************************************************
+ * Source File:
+ *    SERVER
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Answer firing questions with everything already built
+ ************************************************************************/
+
+#include "server.h"
+#include "parallel.h"  // for parallelFor()
+#include "profile.h"   // for the request latencies
+#include "littleEndian.h"
+#include <cmath>       // for isfinite()
+#include <cassert>
+using namespace std;
+
+/*********************************************
+ * ENCODE / DECODE
+ *********************************************/
+void encodeRequest(const ServerRequest& request, unsigned char* bytes)
+{
+   putU32(bytes + 0, request.type);
+   putU32(bytes + 4, request.id);
+   putF64(bytes + 8, request.a);
+   putF64(bytes + 16, request.b);
+   putU32(bytes + 24, request.flags);
+   putU32(bytes + 28, 0);
+}
+
+void decodeRequest(const unsigned char* bytes, ServerRequest& request)
+{
+   request.type = getU32(bytes + 0);
+   request.id = getU32(bytes + 4);
+   request.a = getF64(bytes + 8);
+   request.b = getF64(bytes + 16);
+   request.flags = getU32(bytes + 24);
+}
+
+void encodeResponse(const ServerResponse& response, unsigned char* bytes)
+{
+   putU32(bytes + 0, response.id);
+   putU32(bytes + 4, response.status);
+   for (int i = 0; i < 4; i++)
+      putF64(bytes + 8 + 8 * i, response.values[i]);
+}
+
+void decodeResponse(const unsigned char* bytes, ServerResponse& response)
+{
+   response.id = getU32(bytes + 0);
+   response.status = getU32(bytes + 4);
+   for (int i = 0; i < 4; i++)
+      response.values[i] = getF64(bytes + 8 + 8 * i);
+}
+
+/*********************************************
+ * FIRING SERVER : CONSTRUCTOR
+ * The ground comes from the scenario, the same as a batch run. With
+ * drag on, every shot reads the drag table instead of the atmosphere
+ *********************************************/
+FiringServer::FiringServer(const Scenario& scenario) :
+   scenario(scenario), ground(scenario.view), spec(scenario.spec)
+{
+   if (!setupGround(scenario, ground, posHowitzer, error))
+      return;
+
+   if (spec.fDrag)
+   {
+      pDragTable.reset(new DragTable(spec.mass, spec.radius,
+                                     DRAG_TABLE_ALTITUDE_STEP, DRAG_TABLE_SPEED_STEP,
+                                     spec.interpolation));
+      spec.pDragTable = pDragTable.get();
+   }
+}
+
+/*********************************************
+ * FIRING SERVER : WARM
+ *********************************************/
+void FiringServer::warm()
+{
+   cache.get(spec);
+}
+
+/*********************************************
+ * FIRING SERVER : ANSWER a group
+ *********************************************/
+void FiringServer::answer(const vector<ServerRequest>& requests,
+                          vector<ServerResponse>& responses, int numThreads)
+{
+   responses.resize(requests.size());
+   parallelFor((int)requests.size(), numThreads, [&](int i)
+   {
+      responses[i] = answer(requests[i]);
+   });
+}
+
+/*********************************************
+ * FIRING SERVER : ANSWER one
+ * A solve reads the firing table if warm() built one for that muzzle
+ * velocity, and runs the solver for any other velocity or where the
+ * table is not good to the solver's tolerance
+ *********************************************/
+ServerResponse FiringServer::answer(const ServerRequest& request)
+{
+   ServerResponse response;
+   response.id = request.id;
+
+   ShotSpec shot = spec;
+   if (request.b != 0.0)
+      shot.muzzleVelocity = request.b;
+   if (!isfinite(request.a) || !isfinite(request.b) || shot.muzzleVelocity <= 0.0)
+   {
+      response.status = SERVER_BAD_REQUEST;
+      return response;
+   }
+
+   switch (request.type)
+   {
+      case SERVER_SOLVE:
+      {
+         bool fHighAngle = (request.flags & SERVER_FLAG_HIGH) != 0;
+         double distance = request.a - posHowitzer.getMetersX();
+         double height = ground.getElevationMeters(Position(request.a, 0.0)) -
+                         posHowitzer.getMetersY();
+         FiringSolution solution;
+         const FiringTable* pTable = cache.find(shot);
+         if (pTable != nullptr)
+         {
+            double errorTime;
+            double errorRange;
+            solution = pTable->lookup(distance, height, fHighAngle,
+                                      errorTime, errorRange);
+            if (errorRange > SOLVER_TOLERANCE)
+               solution.fValid = false;
+         }
+         if (!solution.fValid)
+            solution = solveElevation(distance, height, shot, fHighAngle);
+         if (!solution.fValid)
+         {
+            response.status = SERVER_OUT_OF_REACH;
+            break;
+         }
+         response.values[0] = solution.elevation;
+         response.values[1] = solution.timeOfFlight;
+         response.values[2] = posHowitzer.getMetersX() + solution.impactX;
+         response.values[3] = solution.numEvaluations;
+         break;
+      }
+      case SERVER_SIMULATE:
+      {
+         shot.elevation = request.a;
+         BatchResult result = flyOverGround(shot, posHowitzer, ground);
+         response.values[0] = result.impactX;
+         response.values[1] = result.impactY;
+         response.values[2] = result.impactTime;
+         response.values[3] = result.maxAltitude;
+         break;
+      }
+      case SERVER_STATS:
+         response.values[0] = (double)profileCount(PROFILE_SERVER_REQUEST);
+         response.values[1] = profilePercentile(PROFILE_SERVER_REQUEST, 0.50);
+         response.values[2] = profilePercentile(PROFILE_SERVER_REQUEST, 0.90);
+         response.values[3] = profilePercentile(PROFILE_SERVER_REQUEST, 0.99);
+         break;
+      default:
+         response.status = SERVER_BAD_REQUEST;
+   }
+   return response;
+}
@@ -0,0 +1,132 @@
+/***********************************************************************
+ * Header File:
+ *    SERVER
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Answer firing questions for other programs. The ground, the drag
+ *    table and the firing table are built once and kept warm, so a
+ *    question costs a lookup or a trajectory instead of a start up.
+ *    No question builds a table; other muzzle velocities are solved.
+ *
+ *    Every message is a fixed size and little-endian:
+ *       request  (32 bytes): u32 type  u32 id  f64 a  f64 b  u32 flags  u32 0
+ *       response (40 bytes): u32 id  u32 status  f64 values[4]
+ *
+ *    type              a             b                 values
+ *    SERVER_SOLVE      target x (m)  muzzle velocity   elevation, time of
+ *                                                      flight, impact x,
+ *                                                      trajectories flown
+ *    SERVER_SIMULATE   elevation     muzzle velocity   impact x, impact y,
+ *                                                      impact time, max
+ *                                                      altitude
+ *    SERVER_STATS      -             -                 requests, p50, p90,
+ *                                                      p99 latency in us
+ *
+ *    A muzzle velocity of 0 means the scenario's. Bit 0 of the flags
+ *    asks SERVER_SOLVE for the high angle. SERVER_SOLVE lands the shell
+ *    on the ground at the target x, however high that is.
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <memory>      // for unique_ptr
+#include <cstdint>     // for uint32_t
+#include "batch.h"     // for Scenario and flyOverGround()
+#include "firingTable.h"
+#include "dragTable.h"
+
+#define SERVER_SOCKET        "/tmp/m777.sock"   // where clients connect
+#define SERVER_GROUP         8    // requests answered together
+#define SERVER_REQUEST_SIZE  32   // bytes
+#define SERVER_RESPONSE_SIZE 40   // bytes
+#define SERVER_FLAG_HIGH     1    // solve for the high angle
+
+class TestServer;
+
+/*********************************************
+ * SERVER REQUEST TYPE
+ *********************************************/
+enum ServerRequestType
+{
+   SERVER_SOLVE    = 1,
+   SERVER_SIMULATE = 2,
+   SERVER_STATS    = 3
+};
+
+/*********************************************
+ * SERVER STATUS
+ *********************************************/
+enum ServerStatus
+{
+   SERVER_OK           = 0,
+   SERVER_OUT_OF_REACH = 1,
+   SERVER_BAD_REQUEST  = 2
+};
+
+/*********************************************
+ * SERVER REQUEST / RESPONSE
+ *********************************************/
+struct ServerRequest
+{
+   ServerRequest() : type(0), id(0), a(0.0), b(0.0), flags(0) {}
+
+   uint32_t type;   // a ServerRequestType
+   uint32_t id;     // copied to the response so a client can match them
+   double   a;
+   double   b;
+   uint32_t flags;
+};
+
+struct ServerResponse
+{
+   ServerResponse() : id(0), status(SERVER_OK), values() {}
+
+   uint32_t id;
+   uint32_t status;   // a ServerStatus
+   double   values[4];
+};
+
+// the wire format. bytes must hold SERVER_REQUEST_SIZE or
+// SERVER_RESPONSE_SIZE
+void encodeRequest(const ServerRequest& request, unsigned char* bytes);
+void decodeRequest(const unsigned char* bytes, ServerRequest& request);
+void encodeResponse(const ServerResponse& response, unsigned char* bytes);
+void decodeResponse(const unsigned char* bytes, ServerResponse& response);
+
+/*********************************************
+ * FIRING SERVER
+ * Everything a request needs, built once. Answering does not care
+ * where the requests came from; the socket loop is in serverMain.cpp
+ *********************************************/
+class FiringServer
+{
+   friend ::TestServer;
+
+public:
+   // builds the ground and the drag table. Check isReady()
+   FiringServer(const Scenario& scenario);
+
+   bool isReady() const { return error.empty(); }
+   const std::string& getError() const { return error; }
+
+   // build the firing table for the scenario's muzzle velocity. The
+   // only table a solve reads; without it every solve runs the solver
+   void warm();
+
+   // answer a group of requests, one per thread
+   void answer(const std::vector<ServerRequest>& requests,
+               std::vector<ServerResponse>& responses, int numThreads = 0);
+
+private:
+   ServerResponse answer(const ServerRequest& request);
+
+   Scenario scenario;
+   Ground ground;
+   Position posHowitzer;
+   ShotSpec spec;                // the scenario's, with the drag table
+   std::unique_ptr<DragTable> pDragTable;
+   FiringTableCache cache;
+   std::string error;
+};
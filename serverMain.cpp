@@ -0,0 +1,310 @@
+/***********************************************************************
+ * Source File:
+ *    SERVER MAIN
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Keep a scenario's ground and tables warm and answer firing
+ *    questions over a Unix domain socket until interrupted. The
+ *    messages are described in server.h.
+ *
+ *    server scenario.txt [--socket=/tmp/m777.sock] [--threads=n]
+ *
+ *    Every request that has arrived by the time the server looks is
+ *    answered in groups of SERVER_GROUP, and the answers to each client
+ *    go back in one write. The sockets never block, so a client that
+ *    stops reading keeps its answers waiting instead of holding up the
+ *    others. Only POSIX systems have the sockets.
+ ************************************************************************/
+
+#include <cstdio>      // for printf() and fprintf()
+#include <cstring>     // for strncmp()
+#include <cstdlib>     // for atoi()
+#include <fstream>     // for ifstream
+#include "server.h"
+#include "profile.h"   // for the request latencies
+using namespace std;
+
+#ifdef _WIN32
+
+int main(int argc, char** argv)
+{
+   fprintf(stderr, "%s: the server needs Unix domain sockets\n", argv[0]);
+   return 2;
+}
+
+#else
+
+#include <chrono>      // for steady_clock
+#include <csignal>     // for signal()
+#include <cerrno>      // for EINTR and EAGAIN
+#include <fcntl.h>     // for fcntl()
+#include <poll.h>      // for poll()
+#include <unistd.h>    // for close() and unlink()
+#include <sys/socket.h>
+#include <sys/un.h>    // for sockaddr_un
+
+#define CLIENT_BACKLOG (64 * 1024)   // bytes of answers before a client is not read
+
+/*********************************************
+ * CLIENT
+ * One connection, what it has sent that is not a whole request yet, and
+ * the answers it has not taken yet
+ *********************************************/
+struct Client
+{
+   Client(int fd) : fd(fd) {}
+
+   int fd;
+   vector<unsigned char> in;    // bytes read but not yet a request
+   vector<unsigned char> out;   // answers waiting to be written
+};
+
+/*********************************************
+ * PENDING
+ * A request waiting for its group, and when it arrived
+ *********************************************/
+struct Pending
+{
+   int iClient;
+   ServerRequest request;
+   chrono::steady_clock::time_point arrival;
+};
+
+static volatile sig_atomic_t fStop = 0;
+static void onSignal(int) { fStop = 1; }
+
+/*********************************************
+ * OPEN SOCKET
+ * Listen on path, replacing whatever an old server left there
+ *********************************************/
+static int openSocket(const char* path)
+{
+   sockaddr_un address;
+   memset(&address, 0, sizeof(address));
+   address.sun_family = AF_UNIX;
+   if (strlen(path) >= sizeof(address.sun_path))
+      return -1;
+   strcpy(address.sun_path, path);
+
+   int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+   if (fd < 0)
+      return -1;
+   unlink(path);
+   if (bind(fd, (sockaddr*)&address, sizeof(address)) != 0 || listen(fd, 64) != 0)
+   {
+      close(fd);
+      return -1;
+   }
+   return fd;
+}
+
+/*********************************************
+ * WRITE WAITING
+ * Send as much of a client's answers as the socket will take, and keep
+ * the rest for when poll() says there is room. False if the client is
+ * gone
+ *********************************************/
+static bool writeWaiting(Client& client)
+{
+   size_t sent = 0;
+   while (sent < client.out.size())
+   {
+      ssize_t size = send(client.fd, client.out.data() + sent,
+                          client.out.size() - sent, 0);
+      if (size < 0 && errno == EINTR)
+         continue;
+      if (size < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+         break;
+      if (size <= 0)
+         return false;
+      sent += (size_t)size;
+   }
+   client.out.erase(client.out.begin(), client.out.begin() + sent);
+   return true;
+}
+
+/*********************************************
+ * SERVE
+ * Wait for something to read, read everything there is, answer it,
+ * and go back to waiting
+ *********************************************/
+static void serve(FiringServer& server, int fdListen, int numThreads)
+{
+   vector<Client> clients;
+   vector<Pending> pending;
+   vector<ServerRequest> group;
+   vector<ServerResponse> responses;
+   unsigned char bytes[64 * 1024];
+
+   while (!fStop)
+   {
+      vector<pollfd> fds(1 + clients.size());
+      fds[0].fd = fdListen;
+      fds[0].events = POLLIN;
+      for (size_t i = 0; i < clients.size(); i++)
+      {
+         fds[i + 1].fd = clients[i].fd;
+         fds[i + 1].events = 0;
+         if (clients[i].out.size() < CLIENT_BACKLOG)
+            fds[i + 1].events |= POLLIN;
+         if (!clients[i].out.empty())
+            fds[i + 1].events |= POLLOUT;
+      }
+      if (poll(fds.data(), fds.size(), 1000) <= 0)
+         continue;
+
+      // everything that has arrived
+      for (size_t i = 0; i < clients.size(); i++)
+      {
+         if ((fds[i + 1].revents & (POLLIN | POLLHUP | POLLERR)) == 0)
+            continue;
+         ssize_t received = recv(clients[i].fd, bytes, sizeof(bytes), 0);
+         auto arrival = chrono::steady_clock::now();
+         if (received < 0 && (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK))
+            continue;
+         if (received <= 0)
+         {
+            close(clients[i].fd);
+            clients[i].fd = -1;
+            continue;
+         }
+
+         vector<unsigned char>& in = clients[i].in;
+         in.insert(in.end(), bytes, bytes + received);
+         size_t used = 0;
+         for (; used + SERVER_REQUEST_SIZE <= in.size(); used += SERVER_REQUEST_SIZE)
+         {
+            Pending request;
+            request.iClient = (int)i;
+            decodeRequest(in.data() + used, request.request);
+            request.arrival = arrival;
+            pending.push_back(request);
+         }
+         in.erase(in.begin(), in.begin() + used);
+      }
+
+      // answer them a group at a time
+      for (size_t first = 0; first < pending.size(); first += SERVER_GROUP)
+      {
+         size_t last = min(first + SERVER_GROUP, pending.size());
+         group.clear();
+         for (size_t i = first; i < last; i++)
+            group.push_back(pending[i].request);
+         server.answer(group, responses, numThreads);
+
+         unsigned char message[SERVER_RESPONSE_SIZE];
+         for (size_t i = first; i < last; i++)
+         {
+            encodeResponse(responses[i - first], message);
+            vector<unsigned char>& out = clients[pending[i].iClient].out;
+            out.insert(out.end(), message, message + SERVER_RESPONSE_SIZE);
+         }
+      }
+
+      // one write per client, then the latencies
+      for (Client& client : clients)
+         if (client.fd >= 0 && !client.out.empty() && !writeWaiting(client))
+         {
+            close(client.fd);
+            client.fd = -1;
+         }
+      auto answered = chrono::steady_clock::now();
+      for (const Pending& request : pending)
+         profileRecord(PROFILE_SERVER_REQUEST, request.arrival, answered);
+      pending.clear();
+
+      // the closed ones go, the new ones come
+      for (size_t i = clients.size(); i-- > 0; )
+         if (clients[i].fd < 0)
+            clients.erase(clients.begin() + i);
+      if (fds[0].revents & POLLIN)
+      {
+         int fd = accept(fdListen, nullptr, nullptr);
+         if (fd >= 0 && fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) == 0)
+            clients.push_back(Client(fd));
+         else if (fd >= 0)
+            close(fd);
+      }
+   }
+
+   for (Client& client : clients)
+      close(client.fd);
+}
+
+/*********************************************
+ * MAIN
+ *********************************************/
+int main(int argc, char** argv)
+{
+   const char* scenarioName = nullptr;
+   const char* socketName = SERVER_SOCKET;
+   int numThreads = 1;
+   bool fUsage = false;
+
+   for (int i = 1; i < argc; i++)
+   {
+      if (strncmp(argv[i], "--socket=", 9) == 0)
+         socketName = argv[i] + 9;
+      else if (strncmp(argv[i], "--threads=", 10) == 0)
+         numThreads = atoi(argv[i] + 10);
+      else if (argv[i][0] != '-' && scenarioName == nullptr)
+         scenarioName = argv[i];
+      else
+         fUsage = true;
+   }
+   if (fUsage || scenarioName == nullptr)
+   {
+      fprintf(stderr, "usage: %s scenario [--socket=path] [--threads=n]\n", argv[0]);
+      return 2;
+   }
+
+   // everything a question could need, built before the first one
+   Scenario scenario;
+   string error;
+   ifstream fin(scenarioName);
+   if (!fin.is_open())
+      error = string("unable to read ") + scenarioName;
+   else
+      readScenario(fin, scenario, error);
+   if (!error.empty())
+   {
+      fprintf(stderr, "%s: %s\n", scenarioName, error.c_str());
+      return 2;
+   }
+   auto begin = chrono::steady_clock::now();
+   FiringServer server(scenario);
+   if (!server.isReady())
+   {
+      fprintf(stderr, "%s: %s\n", scenarioName, server.getError().c_str());
+      return 2;
+   }
+   server.warm();
+   auto end = chrono::steady_clock::now();
+
+   int fdListen = openSocket(socketName);
+   if (fdListen < 0)
+   {
+      fprintf(stderr, "Unable to listen on %s\n", socketName);
+      return 2;
+   }
+   printf("Ready in %.1f ms, listening on %s\n",
+          chrono::duration<double, milli>(end - begin).count(), socketName);
+   fflush(stdout);
+
+   signal(SIGINT, onSignal);
+   signal(SIGTERM, onSignal);
+   signal(SIGPIPE, SIG_IGN);   // a client that hangs up is an error from send()
+   serve(server, fdListen, numThreads);
+   close(fdListen);
+   unlink(socketName);
+
+   printf("%llu requests. Latency p50 %.1fus  p90 %.1fus  p99 %.1fus\n",
+          (unsigned long long)profileCount(PROFILE_SERVER_REQUEST),
+          profilePercentile(PROFILE_SERVER_REQUEST, 0.50),
+          profilePercentile(PROFILE_SERVER_REQUEST, 0.90),
+          profilePercentile(PROFILE_SERVER_REQUEST, 0.99));
+   return 0;
+}
+
+#endif // _WIN32
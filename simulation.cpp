@@ -8,6 +8,7 @@
  ************************************************************************/
 
 #include "simulation.h"  // for SIMULATION
+#include "profile.h"     // for PROFILE_SCOPE
 
 /**********************************************************
  * DISPLAY
@@ -15,7 +16,17 @@
 **********************************************************/
 void Simulator::display()
 {
-   ogstream gout;
+   ogstream gout(view);
+   display(gout);
+}
+
+/**********************************************************
+ * DISPLAY
+ * Draw with whatever gout draws with
+**********************************************************/
+void Simulator::display(ogstream& gout)
+{
+   PROFILE_SCOPE(PROFILE_DISPLAY);
 
    // Draw the howitzer
    howitzer.draw(gout, 100.0);
@@ -23,8 +34,8 @@ void Simulator::display()
    // Draw the ground
    ground.draw(gout);
 
-   // Draw the projectile
-   projectile.draw(gout);
+   // Draw the shells part way between the last two physics steps
+   salvo.draw(gout, accumulator / timeStep);
 
    gout = Position(23000, 18000);  // set position of messages
    gout.setf(ios::fixed);          // for double precision
@@ -38,19 +49,33 @@ void Simulator::display()
    }
 
    // Show howitzer angle
-   if (!projectile.isFlying())
+   if (!salvo.isFlying())
    {
       gout << "Angle: " << howitzerAngle << endl;
    }
-   // Show projectile information
+   // Show information about the newest shell
    else
    {
       // Display the altitude, speed, distance, and hang time.
+      const Projectile& projectile = salvo.getNewest();
       gout << "Altitude: "  << projectile.getAltitude()       << endl;
       gout << "Speed: "     << projectile.getSpeed()          << endl;
       gout << "Distance: "  << projectile.getFlightDistance() << endl;
       gout << "Hang Time: " << projectile.getCurrentTime()    << endl;
+      if (salvo.getNumFlying() > 1)
+         gout << "In the Air: " << salvo.getNumFlying() << endl;
    }
+
+   // How close the last winning shot came
+   if (numHits > 0)
+      gout << "Hits: " << numHits << "  last " << lastHit.distance
+           << "m off at " << lastHit.time << "s" << endl;
+
+#ifdef PROFILE
+   // Show where the time is going
+   profileDraw(gout, Position(6000, 19500));
+#endif
+   gout.flush();
 }
 
 /**********************************************************
@@ -59,6 +84,8 @@ void Simulator::display()
  **********************************************************/
 void Simulator::update(const Interface* pUI)
 {
+   PROFILE_SCOPE(PROFILE_UPDATE);
+
    // Move gun to the right
    if (pUI->isRight())
    {
@@ -87,42 +114,69 @@ void Simulator::update(const Interface* pUI)
 /************************************************
  * GAMEPLAY
  * Handle the gameplay rules based on user input,
- * Projectile position and firing.
+ * Projectile position and firing. Physics runs in
+ * fixed steps: a frame may take zero, one, or many
+ * steps depending on how much wall-clock time it took,
+ * so the game runs at the same speed at any frame rate.
  ************************************************/
 void Simulator::gameplay(const Interface* pUI)
 {
-   // Fire the gun
-   if (pUI->isSpace() && !projectile.isFlying())
+   PROFILE_SCOPE(PROFILE_GAMEPLAY);
+
+   // Fire the gun. Shells already in the air keep flying
+   if (pUI->isSpace())
    {
-      projectile.fire(howitzer.getPosition(), 0.5, howitzer.getElevation(), howitzer.getMuzzleVelocity());
-      projectile.advance(1.0);
-      
+      if (!salvo.isFlying())
+         accumulator = 0.0;
+      salvo.fire(howitzer.getPosition(), 0.5, howitzer.getElevation(), howitzer.getMuzzleVelocity());
    }
 
-   // Rules of the game
-   if (projectile.isFlying())
+   if (!salvo.isFlying())
+      return;
+
+   // Run as many physics steps as this frame has time for. A frame
+   // held up by the window being dragged does not count for more
+   accumulator += timeScale * min(pUI->getFrameDelta(), MAX_FRAME_DELTA);
+   for (int steps = 0; accumulator >= timeStep && salvo.isFlying(); steps++)
    {
-      // Check if projectile hit target.
-      if (projectile.getPosition().getPixelsX() >= ground.getTarget().getPixelsX() - 10.0 &&
-         projectile.getPosition().getPixelsX() <= ground.getTarget().getPixelsX() + 10.0 &&
-         projectile.getPosition().getPixelsY() >= ground.getTarget().getPixelsY() - 10.0 &&
-         projectile.getPosition().getPixelsY() <= ground.getTarget().getPixelsY() + 10.0)
-      {
-         howitzer.generatePosition(posUpperRight);
-         ground.reset(howitzer.getPosition());
-         projectile.reset();
-      }
-      // Check if projectile has not hit the ground
-      if (ground.getElevationMeters(projectile.getPosition()) < projectile.getPosition().getMetersY())
+      // Too far behind to catch up. Drop the extra time.
+      if (steps == MAX_STEPS_PER_FRAME)
       {
-         projectile.advance(1.0);
+         accumulator = 0.0;
+         break;
       }
-      else
-      {
-         projectile.reset();
-      } 
+
+      step();
+      accumulator -= timeStep;
    }
 }
 
+/************************************************
+ * STEP
+ * Rules of the game for one physics step
+ ************************************************/
+void Simulator::step()
+{
+   // Shells that hit the ground come down, the rest fly on
+   salvo.advance(timeStep, ground);
 
-
+   // Check if any shell passed through the target on the way. One hit
+   // ends the round
+   Position posTarget = ground.getTarget();
+   for (int i = 0; i < salvo.getNumFlying(); i++)
+   {
+      const Projectile& shell = salvo[i];
+      ClosestApproach approach = closestApproach(shell.getPosition(0.0), shell.getPreviousTime(),
+                                                 shell.getPosition(1.0), shell.getCurrentTime(),
+                                                 posTarget);
+      if (isHit(approach))
+      {
+         numHits++;
+         lastHit = approach;
+         howitzer.generatePosition(view);
+         ground.reset(howitzer.getPosition());
+         salvo.reset();
+         return;
+      }
+   }
+}
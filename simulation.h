@@ -11,8 +11,17 @@
 #include "position.h"
 #include "ground.h"      // for GROUND
 #include "howitzer.h"    // for HOWITZER
-#include "projectile.h"  // for PROJECTILE
+#include "salvo.h"       // for SALVO
+#include "target.h"      // for CLOSEST APPROACH
 #include "uiInteract.h"  // for INTERFACE
+#include "view.h"        // for VIEW
+
+#include <cassert>       // for ASSERT
+
+#define DEFAULT_TIME_STEP        1.0   // s of simulation per physics step
+#define DEFAULT_TIME_SCALE       30.0  // s of simulation per s of wall clock
+#define MAX_FRAME_DELTA          0.25  // s of wall clock one frame may cover
+#define MAX_STEPS_PER_FRAME      1000  // never fall further behind than this
 
 using namespace std;
 
@@ -23,26 +32,59 @@ using namespace std;
 class Simulator
 {
 public:
-   Simulator(const Position & posUpperRight) :
-      ground(posUpperRight)
+   Simulator(const View & view) :
+      ground(view),
+      view(view),
+      timeStep(DEFAULT_TIME_STEP),
+      timeScale(DEFAULT_TIME_SCALE),
+      accumulator(0.0),
+      numHits(0)
    {
-      this->posUpperRight = posUpperRight;      // for reset
-      howitzer.generatePosition(posUpperRight);
+      howitzer.generatePosition(view);
       ground.reset(howitzer.getPosition()); 
    }
 
    // display stuff on the screen
    void display();
 
+   // draw with any backend: the screen, memory, or nowhere at all
+   void display(ogstream& gout);
+
    // update the simulator for each frame
    void update(const Interface* pUI);
 
    // handle gameplay rules
    void gameplay(const Interface* pUI);
 
+   // how many simulated seconds in each physics step
+   void setTimeStep(double timeStep)
+   {
+      assert(timeStep > 0.0);
+      this->timeStep = timeStep;
+   }
+
+   // how many simulated seconds pass with each wall-clock second
+   void setTimeScale(double timeScale)
+   {
+      assert(timeScale >= 0.0);
+      this->timeScale = timeScale;
+   }
+
+   // how many rounds have been won, and how close the last one was
+   int getNumHits() const { return numHits; }
+   const ClosestApproach& getLastHit() const { return lastHit; }
+
 private:
+   // advance every shell one physics step and apply the rules
+   void step();
+
    Ground ground;
    Howitzer howitzer;
-   Projectile projectile;
-   Position posUpperRight;
+   Salvo salvo;           // every shell in the air
+   View view;             // zoom and size of the screen
+   double timeStep;       // simulated seconds per physics step
+   double timeScale;      // simulated seconds per wall-clock second
+   double accumulator;    // simulated seconds not yet stepped
+   int numHits;           // targets hit so far
+   ClosestApproach lastHit;   // how the last one was hit
 };
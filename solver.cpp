@@ -0,0 +1,99 @@
+/***********************************************************************
+ * Source File:
+ *    SOLVER
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Find the elevation that lands a shell on a target
+ ************************************************************************/
+
+#include "solver.h"
+#include "projectile.h"   // for GRAVITY
+#include <cmath>          // for fabs() and atan2()
+using namespace std;
+
+/*********************************************
+ * EVALUATE
+ * Fly one elevation and remember it in the solution. A shell that
+ * never climbs to the target's height is measured to the top of its
+ * flight, so the secant still has something to steer by
+ *********************************************/
+static double evaluate(const ShotSpec& spec, double elevation, FiringSolution& solution,
+                       bool& fReached)
+{
+   ShotSpec shot = spec;
+   shot.elevation = elevation;
+   shot.sampleEvery = 0;
+   Trajectory trajectory = computeTrajectory(shot);
+
+   solution.numEvaluations++;
+   solution.elevation = elevation;
+   solution.impactX = trajectory.impactX;
+   solution.timeOfFlight = trajectory.impactTime;
+   fReached = trajectory.fReached;
+   return trajectory.impactX;
+}
+
+/*********************************************
+ * SOLVE ELEVATION
+ * Work with the distance as a positive number and mirror the answer
+ * at the end. Each branch, flat or high, is kept between straight up,
+ * the longest shot and horizontal so the secant cannot wander onto the
+ * other. On level ground the longest shot is 45 degrees; a target
+ * above the gun tips it up by half the angle to the target
+ *********************************************/
+FiringSolution solveElevation(double distance, double height, const ShotSpec& spec,
+                              bool fHighAngle, double tolerance)
+{
+   FiringSolution solution;
+   double sign = distance < 0.0 ? -1.0 : 1.0;
+   double target = fabs(distance);
+   ShotSpec shot = spec;
+   shot.impactHeight = height;
+   bool fReached;
+
+   // drag only ever shortens a shot, so if a vacuum cannot reach it neither can we
+   double elevation0;
+   if (!elevationFromVacuum(target, height, spec.muzzleVelocity, GRAVITY, fHighAngle, elevation0))
+      return solution;
+
+   double split = 45.0 - 0.5 * atan2(height, target) * 180.0 / M_PI;
+   double lowest  = fHighAngle ?   0.0 : split;
+   double highest = fHighAngle ? split : 90.0;
+   elevation0 = max(lowest, min(highest, elevation0));
+
+   double error0 = evaluate(shot, elevation0, solution, fReached) - target;
+   if (fabs(error0) <= tolerance || !spec.fDrag)
+   {
+      solution.fValid = fReached && fabs(error0) <= tolerance;
+      solution.elevation *= sign;
+      solution.impactX *= sign;
+      return solution;
+   }
+
+   // second guess: aim as far past the target as the first shot fell short
+   double elevation1;
+   if (!elevationFromVacuum(target - error0, height, spec.muzzleVelocity, GRAVITY,
+                            fHighAngle, elevation1))
+      elevation1 = split;
+   elevation1 = max(lowest, min(highest, elevation1));
+   double error1 = evaluate(shot, elevation1, solution, fReached) - target;
+
+   while (fabs(error1) > tolerance && solution.numEvaluations < SOLVER_MAX_ITERATIONS)
+   {
+      if (error1 == error0)
+         break;
+      double elevation = elevation1 - error1 * (elevation1 - elevation0) / (error1 - error0);
+      elevation = max(lowest, min(highest, elevation));
+
+      elevation0 = elevation1;
+      error0 = error1;
+      elevation1 = elevation;
+      error1 = evaluate(shot, elevation1, solution, fReached) - target;
+   }
+
+   solution.fValid = fReached && fabs(error1) <= tolerance;
+   solution.elevation *= sign;
+   solution.impactX *= sign;
+   return solution;
+}
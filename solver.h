@@ -0,0 +1,42 @@
+/***********************************************************************
+ * Header File:
+ *    SOLVER
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Find the elevation that lands a shell on a target. The vacuum
+ *    equations give a first guess for free; the secant method then
+ *    corrects for drag with a handful of full trajectories.
+ ************************************************************************/
+
+#pragma once
+
+#include "trajectory.h"
+
+#define SOLVER_TOLERANCE      1.0   // m, close enough to the target
+#define SOLVER_MAX_ITERATIONS 20    // trajectories to try before giving up
+
+/*********************************************
+ * FIRING SOLUTION
+ *********************************************/
+struct FiringSolution
+{
+   FiringSolution() : fValid(false), elevation(0.0), impactX(0.0),
+                      timeOfFlight(0.0), numEvaluations(0) {}
+
+   bool   fValid;          // false if the target is out of reach
+   double elevation;       // degrees from straight up, positive to the right
+   double impactX;         // m, where the shell actually lands
+   double timeOfFlight;    // s
+   int    numEvaluations;  // full trajectories it took
+};
+
+// the elevation that lands a shell distance meters away (negative is
+// to the left) and height meters above the muzzle (negative is below).
+// The shell must come down on the target, and is never fired below the
+// horizontal. The shell and the time step come from spec; its elevation
+// and impact height are ignored. fHighAngle picks the lob over the flat
+// shot
+FiringSolution solveElevation(double distance, double height, const ShotSpec& spec,
+                              bool fHighAngle = false,
+                              double tolerance = SOLVER_TOLERANCE);
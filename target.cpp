@@ -0,0 +1,44 @@
+/***********************************************************************
+ * Source File:
+ *    TARGET
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Did a shell hit the target?
+ ************************************************************************/
+
+#include "target.h"
+#include <cmath>       // for sqrt()
+#include <algorithm>   // for min() and max()
+using namespace std;
+
+/*********************************************
+ * CLOSEST APPROACH
+ * Project the target onto the step and keep the projection on the
+ * step. A shell that did not move is only ever where it is
+ *********************************************/
+ClosestApproach closestApproach(const Position& posBegin, double timeBegin,
+                                const Position& posEnd, double timeEnd,
+                                const Position& posTarget)
+{
+   double dx = posEnd.getMetersX() - posBegin.getMetersX();
+   double dy = posEnd.getMetersY() - posBegin.getMetersY();
+   double lengthSquared = dx * dx + dy * dy;
+
+   double fraction = 0.0;
+   if (lengthSquared > 0.0)
+   {
+      fraction = ((posTarget.getMetersX() - posBegin.getMetersX()) * dx +
+                  (posTarget.getMetersY() - posBegin.getMetersY()) * dy) / lengthSquared;
+      fraction = min(1.0, max(0.0, fraction));
+   }
+
+   ClosestApproach approach;
+   approach.time = timeBegin + fraction * (timeEnd - timeBegin);
+   approach.pos = Position(posBegin.getMetersX() + fraction * dx,
+                           posBegin.getMetersY() + fraction * dy);
+   double offX = posTarget.getMetersX() - approach.pos.getMetersX();
+   double offY = posTarget.getMetersY() - approach.pos.getMetersY();
+   approach.distance = sqrt(offX * offX + offY * offY);
+   return approach;
+}
@@ -0,0 +1,44 @@
+/***********************************************************************
+ * Header File:
+ *    TARGET
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Did a shell hit the target? A shell can cover kilometers in one
+ *    physics step, so checking where it is after each step can miss a
+ *    target it flew straight through. Instead we look at the whole step,
+ *    a straight line between two positions, and find where along it
+ *    the shell came closest to the target. It is all in meters, so the
+ *    answer does not change with the zoom or the time step.
+ ************************************************************************/
+
+#pragma once
+
+#include "position.h"
+
+#define TARGET_RADIUS 400.0   // m. The 10 pixel box at the default zoom
+
+/*********************************************
+ * CLOSEST APPROACH
+ * Where and when a shell passed nearest the target
+ *********************************************/
+struct ClosestApproach
+{
+   ClosestApproach() : time(0.0), pos(), distance(0.0) {}
+
+   double time;       // s, simulation time
+   Position pos;      // where the shell was
+   double distance;   // m from the target
+};
+
+// the closest a shell came to posTarget while moving in a straight line
+// from posBegin at timeBegin to posEnd at timeEnd
+ClosestApproach closestApproach(const Position& posBegin, double timeBegin,
+                                const Position& posEnd, double timeEnd,
+                                const Position& posTarget);
+
+// close enough to count
+inline bool isHit(const ClosestApproach& approach, double radius = TARGET_RADIUS)
+{
+   return approach.distance <= radius;
+}
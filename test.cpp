@@ -4,7 +4,10 @@
  * Author:
  *    Br. Helfrich
  * Summary:
- *    The test runner for all the unit tests
+ *    The test runner for all the unit tests. This is its own program so
+ *    the simulator does not pay for the tests every time it starts.
+ *
+ *    test [--filter=text] [--threads=n]
  ************************************************************************/
 
 #include "test.h"
@@ -16,39 +19,194 @@
 #include "testGround.h"
 #include "testHowitzer.h"
 #include "testProjectile.h"
+#include "testRaster.h"
+#include "testOgstream.h"
+#include "testProfile.h"
+#include "testTrajectory.h"
+#include "testGolden.h"
+#include "testSolver.h"
+#include "testDragTable.h"
+#include "testAtmosphere.h"
+#include "testVec2.h"
+#include "testView.h"
+#include "testRingBuffer.h"
+#include "testSalvo.h"
+#include "testBattery.h"
+#include "testFiringTable.h"
+#include "testScheduler.h"
+#include "testBatch.h"
+#include "testServer.h"
+#include "testReplay.h"
+#include "testTarget.h"
+#include "testTrajectoryCodec.h"
 
-// This code, and the similar IF_DEF in testRunner(), is to ensure that
-// you can see the text output (called the console window) and OpenGL's
-// graphics at the same time. It is not required on Apple's XCode, only
-// on Window's Visual Studio. If you have problems seeing the output window
-// and your team is exclusively on Visual Studio, you can safely remove
-// these two "#ifdef _WIN32" and the "#endif" below it.
-#ifdef _WIN32
-#include <windows.h>
-#include <iostream>
+#include "parallel.h"  // for parallelFor()
+#include <chrono>      // for steady_clock
+#include <sstream>     // for ostringstream
+#include <cstring>     // for strstr()
+#include <cstdlib>     // for atoi()
 using namespace std;
-#endif
 
+/*****************************************************************
+ * RUN TEST
+ * Run one test class, sending its report to out
+ ****************************************************************/
+template <class T>
+int runTest(ostream& out)
+{
+   T test;
+   test.setOutput(out);
+   test.run();
+   return test.getNumFailed();
+}
+
+/*****************************************************************
+ * TEST CASE
+ * One test class. Those that touch global state, such as rand() or
+ * the profiler, are shared and must not run at the same time.
+ ****************************************************************/
+struct TestCase
+{
+   const char* name;
+   bool fShared;
+   int (*run)(ostream& out);
+};
+
+static const TestCase testCases[] =
+{
+   { "Angle",        false, runTest<TestAngle>        },
+   { "Acceleration", false, runTest<TestAcceleration> },
+   { "Position",     false, runTest<TestPosition>     },
+   { "Physics",      false, runTest<TestPhysics>      },
+   { "Velocity",     false, runTest<TestVelocity>     },
+   { "Ground",       true,  runTest<TestGround>       },
+   { "Howitzer",     true,  runTest<TestHowitzer>     },
+   { "Projectile",   false, runTest<TestProjectile>   },
+   { "Raster",       false, runTest<TestRaster>       },
+   { "Ogstream",     false, runTest<TestOgstream>     },
+   { "Profile",      true,  runTest<TestProfile>      },
+   { "Trajectory",   false, runTest<TestTrajectory>   },
+   { "Golden",       false, runTest<TestGolden>       },
+   { "Solver",       false, runTest<TestSolver>       },
+   { "DragTable",    false, runTest<TestDragTable>    },
+   { "Atmosphere",   false, runTest<TestAtmosphere>   },
+   { "Vec2",         false, runTest<TestVec2>         },
+   { "View",         false, runTest<TestView>         },
+   { "RingBuffer",   false, runTest<TestRingBuffer>   },
+   { "Salvo",        true,  runTest<TestSalvo>        },
+   { "Battery",      true,  runTest<TestBattery>      },
+   { "FiringTable",  false, runTest<TestFiringTable>  },
+   { "Scheduler",    false, runTest<TestScheduler>    },
+   { "Batch",        true,  runTest<TestBatch>        },
+   { "Server",       true,  runTest<TestServer>       },
+   { "Replay",       true,  runTest<TestReplay>       },
+   { "Target",       false, runTest<TestTarget>       },
+   { "TrajectoryCodec", false, runTest<TestTrajectoryCodec> },
+};
+const int NUM_TEST_CASES = sizeof(testCases) / sizeof(testCases[0]);
+
+/*****************************************************************
+ * TEST RESULT
+ ****************************************************************/
+struct TestResult
+{
+   TestResult() : fRun(false), numFailed(0), milliseconds(0.0) {}
+   bool fRun;
+   int numFailed;
+   double milliseconds;
+   string output;
+};
+
+/*****************************************************************
+ * RUN CASE
+ ****************************************************************/
+static void runCase(const TestCase& testCase, TestResult& result)
+{
+   ostringstream out;
+   auto begin = chrono::steady_clock::now();
+   result.numFailed = testCase.run(out);
+   auto end = chrono::steady_clock::now();
+
+   result.fRun = true;
+   result.milliseconds = chrono::duration<double, milli>(end - begin).count();
+   result.output = out.str();
+}
 
 /*****************************************************************
  * TEST RUNNER
- * Runs all the unit tests
+ * Runs all the unit tests. The shared test classes are one job run
+ * in order; every other class is a job of its own. The reports are
+ * printed in the usual order once everything is done.
  ****************************************************************/
-void testRunner()
+int testRunner(const char* filter, int numThreads)
 {
-#ifdef _WIN32
-   AllocConsole();
-   FILE* stream;
-   errno_t err;
-   err = freopen_s(&stream, "CONOUT$", "a", stdout);
-#endif // _WIN32
-
-   TestAngle().run();
-   TestAcceleration().run();
-   TestPosition().run();
-   TestPhysics().run();
-   TestVelocity().run();
-   TestGround().run();  
-   TestHowitzer().run();
-   TestProjectile().run();
+   vector<int> jobsShared;
+   vector<vector<int>> jobs;
+   for (int i = 0; i < NUM_TEST_CASES; i++)
+      if (strstr(testCases[i].name, filter) != nullptr)
+      {
+         if (testCases[i].fShared)
+            jobsShared.push_back(i);
+         else
+            jobs.push_back(vector<int>(1, i));
+      }
+   if (!jobsShared.empty())
+      jobs.insert(jobs.begin(), jobsShared);
+
+   // every thread takes the next job until there are none left
+   TestResult results[NUM_TEST_CASES];
+   numThreads = parallelThreads((int)jobs.size(), numThreads);
+   auto begin = chrono::steady_clock::now();
+   parallelFor((int)jobs.size(), numThreads, [&](int job)
+   {
+      for (int i : jobs[job])
+         runCase(testCases[i], results[i]);
+   });
+   auto end = chrono::steady_clock::now();
+
+   // the reports, then how long each took
+   int numFailed = 0;
+   for (int i = 0; i < NUM_TEST_CASES; i++)
+      if (results[i].fRun)
+      {
+         cout << results[i].output;
+         numFailed += results[i].numFailed ? 1 : 0;
+      }
+
+   cout << "\nTimings:\n";
+   cout.setf(ios::fixed | ios::showpoint);
+   cout.precision(3);
+   for (int i = 0; i < NUM_TEST_CASES; i++)
+      if (results[i].fRun)
+         cout << "\t" << left << setw(15) << testCases[i].name
+              << right << setw(10) << results[i].milliseconds << " ms\n";
+   cout << "\t" << left << setw(15) << "Total"
+        << right << setw(10) << chrono::duration<double, milli>(end - begin).count()
+        << " ms on " << numThreads << " thread(s)\n";
+
+   return numFailed;
+}
+
+/*****************************************************************
+ * MAIN
+ ****************************************************************/
+int main(int argc, char** argv)
+{
+   const char* filter = "";
+   int numThreads = 0;
+
+   for (int i = 1; i < argc; i++)
+   {
+      if (strncmp(argv[i], "--filter=", 9) == 0)
+         filter = argv[i] + 9;
+      else if (strncmp(argv[i], "--threads=", 10) == 0)
+         numThreads = atoi(argv[i] + 10);
+      else
+      {
+         cout << "usage: " << argv[0] << " [--filter=text] [--threads=n]\n";
+         return 2;
+      }
+   }
+
+   return testRunner(filter, numThreads) == 0 ? 0 : 1;
 }
@@ -9,4 +9,7 @@
 
 #pragma once
 
-void testRunner();
+// run every test class whose name contains filter, spread across
+// numThreads threads (0 means one per core). Returns the number of
+// test classes with a failure
+int testRunner(const char* filter = "", int numThreads = 0);
@@ -199,7 +199,7 @@ private:
       a.ddx = -99.9;
       a.ddy = -88.8;
       Angle angle;
-      angle.radians = 0.0; // up
+      angle.setRadians(0.0); // up
       double magnitude = 3.3;
 
       // exercise
@@ -223,7 +223,7 @@ private:
       a.ddx = -99.9;
       a.ddy = -88.8;
       Angle angle;
-      angle.radians = M_PI; // DOWN
+      angle.setRadians(M_PI); // DOWN
       double magnitude = 3.3;
 
       // exercise
@@ -247,7 +247,7 @@ private:
       a.ddx = -99.9;
       a.ddy = -88.8;
       Angle angle;
-      angle.radians = M_PI_2; // RIGHT
+      angle.setRadians(M_PI_2); // RIGHT
       double magnitude = 3.3;
 
       // exercise
@@ -271,7 +271,7 @@ private:
       a.ddx = -99.9;
       a.ddy = -88.8;
       Angle angle;
-      angle.radians = M_PI_2 + M_PI; // RIGHT
+      angle.setRadians(M_PI_2 + M_PI); // RIGHT
       double magnitude = 3.3;
 
       // exercise
@@ -295,7 +295,7 @@ private:
       a.ddx = -99.9;
       a.ddy = -88.8;
       Angle angle;
-      angle.radians = 1.0; // up and right somewhat
+      angle.setRadians(1.0); // up and right somewhat
       double magnitude = 1.0;
 
       // exercise
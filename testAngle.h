@@ -12,6 +12,8 @@
 
 #include "angle.h"
 #include "unitTest.h"
+#include <algorithm>   // for max()
+#include <cmath>       // for fabs()
 
  /*******************************
   * TEST ANGLE
@@ -72,6 +74,11 @@ public:
       setDxDy_left();
       setDxDy_diagonal();
 
+      // Ticket 3: Caching
+      setRadians_millionLaps();
+      getDx_afterChange();
+      getDy_afterCopy();
+
       report("Angle");
    }
 
@@ -111,7 +118,7 @@ private:
    void setUp()
    {  // setup
       Angle a;
-      a.radians = -99.9;
+      a.setRadians(-99.9);
       // exercise
       a.setUp();
       // verify
@@ -126,7 +133,7 @@ private:
    void setDown()
    {  // setup
       Angle a;
-      a.radians = -99.9;
+      a.setRadians(-99.9);
       // exercise
       a.setDown();
       // verify
@@ -141,7 +148,7 @@ private:
    void setRight()
    {  // setup
       Angle a;
-      a.radians = -99.9;
+      a.setRadians(-99.9);
       // exercise
       a.setRight();
       // verify
@@ -156,7 +163,7 @@ private:
    void setLeft()
    {  // setup
       Angle a;
-      a.radians = -99.9;
+      a.setRadians(-99.9);
       // exercise
       a.setLeft();
       // verify
@@ -171,7 +178,7 @@ private:
    void reverse()
    {  // setup
       Angle a;
-      a.radians = M_PI_2; // 90 degrees
+      a.setRadians(M_PI_2); // 90 degrees
       // exercise
       a.reverse();
       // verify
@@ -186,7 +193,7 @@ private:
    void setRadians_noNormalize()
    {  // setup
       Angle a;
-      a.radians = -99.9;
+      a.setRadians(-99.9);
       // exercise
       a.setRadians(0.785398);
       // verify
@@ -201,7 +208,7 @@ private:
    void setRadians_negative()
    {  // setup
       Angle a;
-      a.radians = -99.9;
+      a.setRadians(-99.9);
       // exercise
       a.setRadians(-M_PI_2);
       // verify
@@ -216,7 +223,7 @@ private:
    void setRadians_oneLap()
    {  // setup
       Angle a;
-      a.radians = -99.9;
+      a.setRadians(-99.9);
       // exercise
       a.setRadians(0.785398 + (M_PI * 2.0));
       // verify
@@ -231,7 +238,7 @@ private:
    void setRadians_sixLaps()
    {  // setup
       Angle a;
-      a.radians = -99.9;
+      a.setRadians(-99.9);
       // exercise
       a.setRadians(0.785398 + (M_PI * 2.0) * 6.0);
       // verify
@@ -246,7 +253,7 @@ private:
    void setRadians_negativeThreeQuarters()
    {  // setup
       Angle a;
-      a.radians = -99.9;
+      a.setRadians(-99.9);
       // exercise
       a.setRadians(-M_PI - M_PI_2);
       // verify
@@ -261,7 +268,7 @@ private:
    void setRadians_negativeOneLap()
    {  // setup
       Angle a;
-      a.radians = -99.9;
+      a.setRadians(-99.9);
       // exercise
       a.setRadians(-0.785398 - (M_PI * 2.0));
       // verify
@@ -276,7 +283,7 @@ private:
    void setRadians_negativeSixLaps()
    {  // setup
       Angle a;
-      a.radians = -99.9;
+      a.setRadians(-99.9);
       // exercise
       a.setRadians(-0.785398 - (M_PI * 2.0) * 6.0);
       // verify
@@ -291,7 +298,7 @@ private:
    void setDegrees_noNormalize()
    {  // setup
       Angle a;
-      a.radians = -99.9;
+      a.setRadians(-99.9);
       // exercise
       a.setDegrees(45.0);
       // verify
@@ -306,7 +313,7 @@ private:
    void setDegrees_negative()
    {  // setup
       Angle a;
-      a.radians = -99.9;
+      a.setRadians(-99.9);
       // exercise
       a.setDegrees(-90.0);
       // verify
@@ -321,7 +328,7 @@ private:
    void setDegrees_oneLap()
    {  // setup
       Angle a;
-      a.radians = -99.9;
+      a.setRadians(-99.9);
       // exercise
       a.setDegrees(45.0 + 360.0);
       // verify
@@ -336,7 +343,7 @@ private:
    void setDegrees_sixLaps()
    {  // setup
       Angle a;
-      a.radians = -99.9;
+      a.setRadians(-99.9);
       // exercise
       a.setDegrees(45.0 + 360.0 * 6.0);
       // verify
@@ -351,7 +358,7 @@ private:
    void setDegrees_negativeThreeQuarters()
    {  // setup
       Angle a;
-      a.radians = -99.9;
+      a.setRadians(-99.9);
       // exercise
       a.setDegrees(-270.0);
       // verify
@@ -366,7 +373,7 @@ private:
    void setDegrees_negativeOneLap()
    {  // setup
       Angle a;
-      a.radians = -99.9;
+      a.setRadians(-99.9);
       // exercise
       a.setDegrees(-45.0 - 360.0);
       // verify
@@ -381,7 +388,7 @@ private:
    void setDegrees_negativeSixLaps()
    {  // setup
       Angle a;
-      a.radians = -99.9;
+      a.setRadians(-99.9);
       // exercise
       a.setDegrees(-45.0 - 360.0 * 6.0);
       // verify
@@ -402,7 +409,7 @@ private:
    void add_0()
    {  // setup
       Angle a;
-      a.radians = 0.785398;
+      a.setRadians(0.785398);
       double r = 0.0;
 
       // exercise
@@ -421,7 +428,7 @@ private:
    void add_value()
    {  // setup
       Angle a;
-      a.radians = 0.785398;
+      a.setRadians(0.785398);
       double r = M_PI;
 
       // exercise
@@ -440,7 +447,7 @@ private:
    void add_positiveLap()
    {  // setup
       Angle a;
-      a.radians = 0.785398;
+      a.setRadians(0.785398);
       double r = M_PI + M_PI * 2.0;
 
       // exercise
@@ -459,7 +466,7 @@ private:
    void add_negativeLap()
    {  // setup
       Angle a;
-      a.radians = 0.785398;
+      a.setRadians(0.785398);
       double r = -M_PI_2;
 
       // exercise
@@ -479,7 +486,7 @@ private:
    {
       // setup
       Angle a;
-      a.radians = 1.234567;
+      a.setRadians(1.234567);
       double dx = 0.0;
       double dy = 1.0;
 
@@ -500,7 +507,7 @@ private:
    {
       // setup
       Angle a;
-      a.radians = 1.234567;
+      a.setRadians(1.234567);
       double dx = 4.0;
       double dy = 0.0;
 
@@ -520,7 +527,7 @@ private:
    {
       // setup
       Angle a;
-      a.radians = 1.234567;
+      a.setRadians(1.234567);
       double dx = -0.01;
       double dy = 0.0;
 
@@ -539,7 +546,7 @@ private:
    void setDxDy_diagonal()
    {  // setup
       Angle a;
-      a.radians = 1.234567;
+      a.setRadians(1.234567);
       double dx = 5.0;
       double dy = 8.6602;
 
@@ -565,7 +572,7 @@ private:
    void getDegrees_0()
    {  // setup
       Angle a;
-      a.radians = 0.0;
+      a.setRadians(0.0);
       double d = -99.9;
       // exercise
       d = a.getDegrees();
@@ -582,7 +589,7 @@ private:
    void getDegrees_270()
    {  // setup
       Angle a;
-      a.radians = M_PI + M_PI_2;
+      a.setRadians(M_PI + M_PI_2);
       double d = -99.9;
       // exercise
       d = a.getDegrees();
@@ -599,7 +606,7 @@ private:
    void getRadians_0()
    {  // setup
       Angle a;
-      a.radians = 0.0;
+      a.setRadians(0.0);
       double r = -99.9;
       // exercise
       r = a.getRadians();
@@ -616,7 +623,7 @@ private:
    void getRadians_270()
    {  // setup
       Angle a;
-      a.radians = M_PI + M_PI_2;
+      a.setRadians(M_PI + M_PI_2);
       double r = -99.9;
       // exercise
       r = a.getRadians();
@@ -634,7 +641,7 @@ private:
    {
       // setup
       Angle a;
-      a.radians = 0.0;
+      a.setRadians(0.0);
       double r = -99.9;
 
       // exercise
@@ -654,7 +661,7 @@ private:
    {
       // setup
       Angle a;
-      a.radians = M_PI;
+      a.setRadians(M_PI);
       double r = -99.9;
 
       // exercise
@@ -675,7 +682,7 @@ private:
    {
       // setup
       Angle a;
-      a.radians = M_PI + M_PI_2;
+      a.setRadians(M_PI + M_PI_2);
       double r = -99.9;
 
       // exercise
@@ -695,7 +702,7 @@ private:
    {
       // setup
       Angle a;
-      a.radians = M_PI_2;
+      a.setRadians(M_PI_2);
       double r = -99.9;
 
       // exercise
@@ -714,7 +721,7 @@ private:
    void getDx_diagonal()
    {  // setup
       Angle a;
-      a.radians = M_PI / 6.0; // 30 degrees
+      a.setRadians(M_PI / 6.0); // 30 degrees
       double dx = -99.9;
       // exercise
       dx = a.getDx();
@@ -733,7 +740,7 @@ private:
    {
       // setup
       Angle a;
-      a.radians = 0.0;
+      a.setRadians(0.0);
       double r = -99.9;
 
       // exercise
@@ -753,7 +760,7 @@ private:
    {
       // setup
       Angle a;
-      a.radians = M_PI;
+      a.setRadians(M_PI);
       double r = -99.9;
 
       // exercise
@@ -774,7 +781,7 @@ private:
    {
       // setup
       Angle a;
-      a.radians = M_PI + M_PI_2;
+      a.setRadians(M_PI + M_PI_2);
       double r = -99.9;
 
       // exercise
@@ -794,7 +801,7 @@ private:
    {
       // setup
       Angle a;
-      a.radians = M_PI_2;
+      a.setRadians(M_PI_2);
       double r = -99.9;
 
       // exercise
@@ -814,7 +821,7 @@ private:
    {
       // setup
       Angle a;
-      a.radians = M_PI / 6.0; // 30 degrees
+      a.setRadians(M_PI / 6.0); // 30 degrees
       double dy = -99.9;
       // exercise
       dy = a.getDy();
@@ -832,7 +839,7 @@ private:
    {
       // setup
       Angle a;
-      a.radians = M_PI / 6.0; // 30 degrees
+      a.setRadians(M_PI / 6.0); // 30 degrees
       bool inRange = false;
       // exercise
       inRange = a.isRight();
@@ -850,7 +857,7 @@ private:
    {
       // setup
       Angle a;
-      a.radians = (11.0 * M_PI) / 6.0; // 330 degrees
+      a.setRadians((11.0 * M_PI) / 6.0); // 330 degrees
       bool inRange = true;
       // exercise
       inRange = a.isRight();
@@ -868,7 +875,7 @@ private:
    {
       // setup
       Angle a;
-      a.radians = M_PI / 6.0; // 30 degrees
+      a.setRadians(M_PI / 6.0); // 30 degrees
       bool inRange = true;
       // exercise
       inRange = a.isLeft();
@@ -886,7 +893,7 @@ private:
    {
       // setup
       Angle a;
-      a.radians = (11.0 * M_PI) / 6.0; // 330 degrees
+      a.setRadians((11.0 * M_PI) / 6.0); // 330 degrees
       bool inRange = false;
       // exercise
       inRange = a.isLeft();
@@ -895,4 +902,62 @@ private:
       assertEquals(a.radians, (11.0 * M_PI) / 6.0);
    }  // teardown
 
+
+   /*****************************************************************
+    *****************************************************************
+    * CACHING AND APPROXIMATION
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    SET RADIANS - MILLION LAPS
+    * input:   30 degrees + 1,000,000 laps
+    * output:  30 degrees
+    *********************************************/
+   void setRadians_millionLaps()
+   {  // setup
+      Angle a;
+      // exercise
+      a.setRadians(M_PI / 6.0 + 1000000.0 * 2.0 * M_PI);
+      // verify
+      assertEquals(a.radians, M_PI / 6.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET DX - AFTER CHANGE
+    *          The cache follows the angle
+    * input:   30 degrees, getDx(), then 90 degrees
+    * output:  1
+    *********************************************/
+   void getDx_afterChange()
+   {  // setup
+      Angle a;
+      a.setRadians(M_PI / 6.0);
+      double dxBefore = a.getDx();
+      a.setRadians(M_PI_2);
+      // exercise
+      double dx = a.getDx();
+      // verify
+      assertEquals(dxBefore, 0.5);
+      assertEquals(dx, 1.0);
+      assertEquals(a.radians, M_PI_2);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET DY - AFTER COPY
+    * input:   60 degrees, getDy(), then copied
+    * output:  0.5 from both
+    *********************************************/
+   void getDy_afterCopy()
+   {  // setup
+      Angle a;
+      a.setRadians(M_PI / 3.0);
+      a.getDy();
+      // exercise
+      Angle aCopy(a);
+      // verify
+      assertEquals(aCopy.getDy(), 0.5);
+      assertEquals(a.getDy(), 0.5);
+      assertEquals(aCopy.radians, M_PI / 3.0);
+   }  // teardown
 };
@@ -0,0 +1,276 @@
+/***********************************************************************
+ * Header File:
+ *    TEST ATMOSPHERE
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    All the unit tests for the atmosphere profile
+ ************************************************************************/
+
+#pragma once
+
+#include "atmosphere.h"
+#include "trajectory.h"
+#include "unitTest.h"
+#include <sstream>   // for istringstream
+#include <cmath>     // for sqrt()
+
+/*******************************
+ * TEST ATMOSPHERE
+ * A friend class for AtmosphereProfile which contains its unit tests
+ ********************************/
+class TestAtmosphere : public UnitTest
+{
+public:
+   void run()
+   {
+      read_layers();
+      read_outOfOrder();
+      read_junk();
+
+      sample_calm();
+      sample_between();
+      sample_outside();
+      sample_hint();
+
+      speedSound_warmer();
+      density_warmer();
+
+      trajectory_calmProfile();
+      trajectory_tailwind();
+
+      report("Atmosphere");
+   }
+
+private:
+
+   /*********************************************
+    * name:    READ three layers with comments and a blank line
+    * input:   0/1000/5000m
+    * output:  three layers, in order
+    *********************************************/
+   void read_layers()
+   {  // setup
+      std::istringstream in(
+         "# altitude wind temperature density\n"
+         "0     5.0  2.0 1.0\n"
+         "\n"
+         "1000 10.0  0.0 0.98   # the inversion\n"
+         "5000 25.0 -3.0 1.0\n");
+      AtmosphereProfile profile;
+      // exercise
+      bool fRead = profile.read(in);
+      // verify
+      assertUnit(fRead);
+      assertUnit(profile.getNumLayers() == 3);
+      assertEquals(profile.layers[1].altitude, 1000.0);
+      assertEquals(profile.layers[1].windX, 10.0);
+      assertEquals(profile.layers[1].temperatureOffset, 0.0);
+      assertEquals(profile.layers[1].densityScale, 0.98);
+      assertEquals(profile.layers[2].temperatureOffset, -3.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    READ layers that are not going up
+    * input:   1000m then 500m
+    * output:  false and an empty profile
+    *********************************************/
+   void read_outOfOrder()
+   {  // setup
+      std::istringstream in("1000 1 0 1\n500 2 0 1\n");
+      AtmosphereProfile profile;
+      // exercise
+      bool fRead = profile.read(in);
+      // verify
+      assertUnit(!fRead);
+      assertUnit(profile.isCalm());
+   }  // teardown
+
+   /*********************************************
+    * name:    READ a line that is not a layer
+    * input:   a missing density, then words
+    * output:  false and an empty profile
+    *********************************************/
+   void read_junk()
+   {  // setup
+      std::istringstream missing("0 1 0\n");
+      std::istringstream words("wind 0 1 0 1\n");
+      AtmosphereProfile profile;
+      // exercise
+      bool fMissing = profile.read(missing);
+      bool fWords = profile.read(words);
+      // verify
+      assertUnit(!fMissing);
+      assertUnit(!fWords);
+      assertUnit(profile.isCalm());
+   }  // teardown
+
+   /*********************************************
+    * name:    SAMPLE an empty profile
+    * input:   3000m
+    * output:  no wind, no offset, a scale of 1
+    *********************************************/
+   void sample_calm()
+   {  // setup
+      AtmosphereProfile profile;
+      LookupCursor cursor;
+      // exercise
+      AtmosphereSample air = profile.sample(3000.0, cursor);
+      // verify
+      assertEquals(air.windX, 0.0);
+      assertEquals(air.temperatureOffset, 0.0);
+      assertEquals(air.densityScale, 1.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    SAMPLE between two layers
+    * input:   a quarter of the way from 1000m to 5000m
+    * output:  a quarter of the way between the layers
+    *********************************************/
+   void sample_between()
+   {  // setup
+      AtmosphereProfile profile;
+      addLayer(profile, 0.0,    5.0,  2.0, 1.0);
+      addLayer(profile, 1000.0, 10.0, 0.0, 0.98);
+      addLayer(profile, 5000.0, 30.0, -4.0, 1.02);
+      LookupCursor cursor;
+      // exercise
+      AtmosphereSample air = profile.sample(2000.0, cursor);
+      // verify
+      assertUnit(cursor.segment == 1);
+      assertEquals(air.windX, 15.0);
+      assertEquals(air.temperatureOffset, -1.0);
+      assertEquals(air.densityScale, 0.99);
+   }  // teardown
+
+   /*********************************************
+    * name:    SAMPLE below the bottom and above the top
+    * input:   -50m and 9000m
+    * output:  the bottom and top layers
+    *********************************************/
+   void sample_outside()
+   {  // setup
+      AtmosphereProfile profile;
+      addLayer(profile, 100.0,  5.0,  2.0, 1.0);
+      addLayer(profile, 5000.0, 30.0, -4.0, 1.02);
+      LookupCursor cursor;
+      // exercise
+      AtmosphereSample below = profile.sample(-50.0, cursor);
+      AtmosphereSample above = profile.sample(9000.0, cursor);
+      // verify
+      assertEquals(below.windX, 5.0);
+      assertEquals(below.temperatureOffset, 2.0);
+      assertEquals(above.windX, 30.0);
+      assertEquals(above.densityScale, 1.02);
+   }  // teardown
+
+   /*********************************************
+    * name:    SAMPLE with a hint that is wrong
+    * input:   ten layers, hint at the bottom, altitude near the top
+    * output:  the right segment all the same, and the cursor moved
+    *********************************************/
+   void sample_hint()
+   {  // setup
+      AtmosphereProfile profile;
+      for (int i = 0; i < 10; i++)
+         addLayer(profile, 1000.0 * i, (double)i, 0.0, 1.0);
+      LookupCursor cursor;
+      // exercise
+      AtmosphereSample high = profile.sample(8500.0, cursor);
+      int segmentHigh = cursor.segment;
+      AtmosphereSample low = profile.sample(1500.0, cursor);
+      // verify
+      assertUnit(segmentHigh == 8);
+      assertEquals(high.windX, 8.5);
+      assertUnit(cursor.segment == 1);
+      assertEquals(low.windX, 1.5);
+   }  // teardown
+
+   /*********************************************
+    * name:    SPEED SOUND ten degrees warmer
+    * input:   340m/s, +10K
+    * output:  sqrt(340^2 + 401.874 * 10)
+    *********************************************/
+   void speedSound_warmer()
+   {  // setup
+      AtmosphereSample air;
+      air.temperatureOffset = 10.0;
+      // exercise
+      double speed = AtmosphereProfile::speedSound(340.0, air);
+      // verify
+      assertEquals(speed, sqrt(340.0 * 340.0 + 4018.74));
+      assertUnit(AtmosphereProfile::speedSound(340.0, AtmosphereSample()) == 340.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    DENSITY ten degrees warmer and scaled
+    * input:   1.225kg/m^3, 340m/s (287.67K), +10K, scale 0.9
+    * output:  1.225 * 0.9 * 287.67 / 297.67
+    *********************************************/
+   void density_warmer()
+   {  // setup
+      AtmosphereSample air;
+      air.temperatureOffset = 10.0;
+      air.densityScale = 0.9;
+      double temperature = 340.0 * 340.0 / 401.874;
+      // exercise
+      double density = AtmosphereProfile::density(1.225, 340.0, air);
+      // verify
+      assertEquals(density, 1.225 * 0.9 * temperature / (temperature + 10.0));
+      assertUnit(AtmosphereProfile::density(1.225, 340.0, AtmosphereSample()) == 1.225);
+   }  // teardown
+
+   /*********************************************
+    * name:    TRAJECTORY through an empty profile
+    * input:   45 degrees, 827m/s, with and without a calm profile
+    * output:  exactly the same impact
+    *********************************************/
+   void trajectory_calmProfile()
+   {  // setup
+      AtmosphereProfile profile;
+      ShotSpec spec(45.0, 827.0);
+      Trajectory standard = computeTrajectory(spec);
+      spec.pAtmosphere = &profile;
+      // exercise
+      Trajectory calm = computeTrajectory(spec);
+      // verify
+      assertUnit(calm.impactX == standard.impactX);
+      assertUnit(calm.impactTime == standard.impactTime);
+      assertUnit(calm.numSteps == standard.numSteps);
+   }  // teardown
+
+   /*********************************************
+    * name:    TRAJECTORY with the wind behind it and in its face
+    * input:   45 degrees, 827m/s, +/-20m/s wind at every altitude
+    * output:  longer with a tailwind, shorter into a headwind
+    *********************************************/
+   void trajectory_tailwind()
+   {  // setup
+      AtmosphereProfile tail;
+      AtmosphereProfile head;
+      addLayer(tail, 0.0, 20.0, 0.0, 1.0);
+      addLayer(head, 0.0, -20.0, 0.0, 1.0);
+      ShotSpec spec(45.0, 827.0);
+      double standard = computeTrajectory(spec).impactX;
+      // exercise
+      spec.pAtmosphere = &tail;
+      double withTail = computeTrajectory(spec).impactX;
+      spec.pAtmosphere = &head;
+      double withHead = computeTrajectory(spec).impactX;
+      // verify
+      assertUnit(withTail > standard + 100.0);
+      assertUnit(withHead < standard - 100.0);
+   }  // teardown
+
+   // one layer on top of the profile
+   void addLayer(AtmosphereProfile& profile, double altitude, double windX,
+                 double temperatureOffset, double densityScale)
+   {
+      AtmosphereLayer layer;
+      layer.altitude = altitude;
+      layer.windX = windX;
+      layer.temperatureOffset = temperatureOffset;
+      layer.densityScale = densityScale;
+      assertUnit(profile.addLayer(layer));
+   }
+};
@@ -0,0 +1,311 @@
+/***********************************************************************
+ * Header File:
+ *    TEST BATCH
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    All the unit tests for the batch scenario runner
+ ************************************************************************/
+
+#pragma once
+
+#include "batch.h"
+#include "unitTest.h"
+#include <sstream>     // for istringstream and ostringstream
+#include <string>
+
+/*******************************
+ * TEST BATCH
+ * The unit tests for scenarios and batch runs
+ ********************************/
+class TestBatch : public UnitTest
+{
+public:
+   void run()
+   {
+      // scenarios
+      readScenario_all();
+      readScenario_unknown();
+      readScenario_badSweep();
+      getShot_acrossRanges();
+
+      // flying
+      flyOverGround_flat();
+      flyOverGround_hill();
+
+      // running
+      runBatch_csv();
+      runBatch_binary();
+      runBatch_chunks();
+
+      report("Batch");
+   }
+
+private:
+
+   /*****************************************************************
+    *****************************************************************
+    * SCENARIOS
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    READ SCENARIO every setting
+    * input:   one of each setting, with comments and blank lines
+    * output:  every value read, 1 + 5 shots
+    *********************************************/
+   void readScenario_all()
+   {  // setup
+      istringstream in(
+         "# a test\n"
+         "seed 7\n"
+         "\n"
+         "view 10 100 50   # 1km x 500m\n"
+         "howitzer 250\n"
+         "velocity 500\n"
+         "timestep 0.25\n"
+         "drag off\n"
+         "shot 30 600\n"
+         "sweep -10 10 5\n");
+      Scenario scenario;
+      std::string error;
+      // exercise
+      bool fRead = readScenario(in, scenario, error);
+      // verify
+      assertUnit(fRead);
+      assertUnit(error.empty());
+      assertUnit(scenario.seed == 7);
+      assertUnit(scenario.demFile.empty());
+      assertEquals(scenario.view.getZoom(), 10.0);
+      assertUnit(scenario.view.getWidth() == 100);
+      assertEquals(scenario.howitzerX, 250.0);
+      assertEquals(scenario.spec.muzzleVelocity, 500.0);
+      assertEquals(scenario.spec.timeStep, 0.25);
+      assertUnit(!scenario.spec.fDrag);
+      assertUnit(scenario.shots.size() == 2);
+      assertUnit(scenario.getNumShots() == 6);
+      assertEquals(scenario.shots[0].muzzleVelocity, 600.0);
+      assertEquals(scenario.shots[1].muzzleVelocity, 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    READ SCENARIO unknown setting
+    * input:   a misspelled keyword on line 2
+    * output:  false, and the error names the line
+    *********************************************/
+   void readScenario_unknown()
+   {  // setup
+      istringstream in("seed 7\nhowizter 250\n");
+      Scenario scenario;
+      std::string error;
+      // exercise
+      bool fRead = readScenario(in, scenario, error);
+      // verify
+      assertUnit(!fRead);
+      assertUnit(error.find("line 2") == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    READ SCENARIO bad sweep
+    * input:   a sweep that runs backwards
+    * output:  false
+    *********************************************/
+   void readScenario_badSweep()
+   {  // setup
+      istringstream in("sweep 10 -10 1\n");
+      Scenario scenario;
+      std::string error;
+      // exercise
+      bool fRead = readScenario(in, scenario, error);
+      // verify
+      assertUnit(!fRead);
+      assertUnit(error.find("line 1") == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET SHOT across ranges
+    * input:   shot 30 at 600m/s, sweep -10 to 10 by 5, velocity 500
+    * output:  30@600 -10@500 -5@500 ... 10@500
+    *********************************************/
+   void getShot_acrossRanges()
+   {  // setup
+      istringstream in("velocity 500\nshot 30 600\nsweep -10 10 5\n");
+      Scenario scenario;
+      std::string error;
+      readScenario(in, scenario, error);
+      // exercise
+      ShotSpec first = scenario.getShot(0);
+      ShotSpec second = scenario.getShot(1);
+      ShotSpec last = scenario.getShot(5);
+      // verify
+      assertEquals(first.elevation, 30.0);
+      assertEquals(first.muzzleVelocity, 600.0);
+      assertEquals(second.elevation, -10.0);
+      assertEquals(second.muzzleVelocity, 500.0);
+      assertEquals(last.elevation, 10.0);
+      assertEquals(last.muzzleVelocity, 500.0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * FLYING
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    FLY OVER GROUND flat
+    *          Ground at sea level is what computeTrajectory() assumes
+    * input:   flat ground at 0m, 827m/s at 60 degrees from 2km
+    * output:  the same steps, landing point and time
+    *********************************************/
+   void flyOverGround_flat()
+   {  // setup
+      Ground ground(View(100.0, 500, 200));
+      Position posHowitzer(2000.0, 0.0);
+      ground.load(std::vector<double>(500, 0.0), posHowitzer);
+      ShotSpec spec(60.0, 827.0);
+      Trajectory trajectory = computeTrajectory(spec);
+      // exercise
+      BatchResult result = flyOverGround(spec, posHowitzer, ground);
+      // verify
+      assertUnit(result.numSteps == trajectory.numSteps);
+      assertEquals(result.impactX, 2000.0 + trajectory.impactX);
+      assertEquals(result.impactTime, trajectory.impactTime);
+      assertEquals(result.impactY, 0.0);
+      assertUnit(result.maxAltitude > 1000.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    FLY OVER GROUND hill
+    * input:   a 1km plateau from 10km on, the same shot
+    * output:  lands sooner and shorter, on top of the plateau
+    *********************************************/
+   void flyOverGround_hill()
+   {  // setup
+      Ground ground(View(100.0, 500, 200));
+      Position posHowitzer(2000.0, 0.0);
+      std::vector<double> elevations(500, 0.0);
+      for (int i = 100; i < 500; i++)
+         elevations[i] = 1000.0;
+      ground.load(elevations, posHowitzer);
+      ShotSpec spec(60.0, 827.0);
+      Trajectory trajectory = computeTrajectory(spec);
+      // exercise
+      BatchResult result = flyOverGround(spec, posHowitzer, ground);
+      // verify
+      assertUnit(result.impactX > 10000.0);
+      assertUnit(result.impactX < 2000.0 + trajectory.impactX);
+      assertUnit(result.impactTime < trajectory.impactTime);
+      assertEquals(result.impactY, 1000.0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * RUNNING
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    RUN BATCH csv
+    * input:   3 shots over random ground
+    * output:  a header row and 3 rows, in order
+    *********************************************/
+   void runBatch_csv()
+   {  // setup
+      Scenario scenario;
+      Ground ground(scenario.view);
+      Position posHowitzer;
+      setupFixture(scenario, ground, posHowitzer, "sweep 30 50 10\n");
+      std::ostringstream out;
+      // exercise
+      long long numWritten = runBatch(scenario, ground, posHowitzer, out, BATCH_CSV);
+      // verify
+      assertUnit(numWritten == 3);
+      std::istringstream in(out.str());
+      std::string line;
+      std::getline(in, line);
+      assertUnit(line.find("index,elevation,") == 0);
+      std::getline(in, line);
+      assertUnit(line.find("0,30,827,") == 0);
+      std::getline(in, line);
+      assertUnit(line.find("1,40,827,") == 0);
+      std::getline(in, line);
+      assertUnit(line.find("2,50,827,") == 0);
+      assertUnit(!std::getline(in, line));
+   }  // teardown
+
+   /*********************************************
+    * name:    RUN BATCH binary
+    * input:   3 shots over random ground
+    * output:  reads back as exactly what flyOverGround() gives
+    *********************************************/
+   void runBatch_binary()
+   {  // setup
+      Scenario scenario;
+      Ground ground(scenario.view);
+      Position posHowitzer;
+      setupFixture(scenario, ground, posHowitzer, "sweep 30 50 10\n");
+      std::ostringstream out;
+      // exercise
+      long long numWritten = runBatch(scenario, ground, posHowitzer, out, BATCH_BINARY);
+      // verify
+      assertUnit(numWritten == 3);
+      assertUnit(out.str().size() == 20 + 3 * 60);
+      std::istringstream in(out.str());
+      long long numShots = 0;
+      assertUnit(readBatchHeader(in, numShots));
+      assertUnit(numShots == 3);
+      for (long long i = 0; i < 3; i++)
+      {
+         BatchResult result;
+         assertUnit(readBatchResult(in, result));
+         BatchResult expected = flyOverGround(scenario.getShot(i), posHowitzer, ground);
+         assertUnit(result.index == i);
+         assertUnit(result.impactX == expected.impactX);
+         assertUnit(result.impactTime == expected.impactTime);
+         assertUnit(result.numSteps == expected.numSteps);
+      }
+      BatchResult extra;
+      assertUnit(!readBatchResult(in, extra));
+   }  // teardown
+
+   /*********************************************
+    * name:    RUN BATCH chunks
+    *          Small chunks on several threads write the same bytes
+    *          as one big chunk on one thread
+    * input:   101 shots, chunks of 7 on 4 threads
+    * output:  identical output
+    *********************************************/
+   void runBatch_chunks()
+   {  // setup
+      Scenario scenario;
+      Ground ground(scenario.view);
+      Position posHowitzer;
+      setupFixture(scenario, ground, posHowitzer, "sweep -50 50 1\n");
+      std::ostringstream outOne;
+      std::ostringstream outMany;
+      // exercise
+      long long numOne = runBatch(scenario, ground, posHowitzer, outOne, BATCH_CSV, 1, 1000);
+      long long numMany = runBatch(scenario, ground, posHowitzer, outMany, BATCH_CSV, 4, 7);
+      // verify
+      assertUnit(numOne == 101);
+      assertUnit(numMany == 101);
+      assertUnit(outOne.str() == outMany.str());
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * FIXTURE
+    *****************************************************************
+    *****************************************************************/
+
+   // the default field with random ground from seed 1, and some shots
+   void setupFixture(Scenario& scenario, Ground& ground, Position& posHowitzer,
+                     const char* shots)
+   {
+      std::istringstream in(shots);
+      std::string error;
+      readScenario(in, scenario, error);
+      setupGround(scenario, ground, posHowitzer, error);
+   }
+};
@@ -0,0 +1,352 @@
+/***********************************************************************
+ * Header File:
+ *    TEST BATTERY
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    All the unit tests for a battery of howitzers
+ ************************************************************************/
+
+#pragma once
+
+#include "battery.h"
+#include "scheduler.h"   // for TOT_WINDOW
+#include "trajectory.h"
+#include "view.h"
+#include "unitTest.h"
+#include <cmath>       // for fabs()
+#include <vector>
+
+/*******************************
+ * TEST BATTERY
+ * A friend class for Battery which contains its unit tests
+ ********************************/
+class TestBattery : public UnitTest
+{
+public:
+   void run()
+   {
+      add_two();
+      generatePositions_oneSide();
+      placeOn_heights();
+      aim_timeOnTarget();
+      aim_outOfRange();
+      aim_threadsAgree();
+      aim_heights();
+      fire_timeOnTarget();
+      fire_waitsItsTurn();
+      fire_threadsAgree();
+
+      report("Battery");
+   }
+
+private:
+
+   /*********************************************
+    * name:    ADD two
+    * input:   guns at 1km with 827 m/s and 2km with 700 m/s
+    * output:  two guns in that order, pointing up
+    *********************************************/
+   void add_two()
+   {  // setup
+      Battery battery;
+      // exercise
+      battery.add(Position(1000.0, 0.0));
+      battery.add(Position(2000.0, 0.0), 700.0);
+      // verify
+      assertUnit(battery.size() == 2);
+      assertEquals(battery[0].getPosition().getMetersX(), 1000.0);
+      assertEquals(battery[0].getMuzzleVelocity(), 827.0);
+      assertEquals(battery[1].getPosition().getMetersX(), 2000.0);
+      assertEquals(battery[1].getMuzzleVelocity(), 700.0);
+      assertEquals(battery[1].getElevation().getRadians(), 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    GENERATE POSITIONS one side
+    * input:   4 guns on a 700 x 500 screen
+    * output:  left to right, all on the same half, away from the edges
+    *********************************************/
+   void generatePositions_oneSide()
+   {  // setup
+      Battery battery;
+      View view(40.0, 700, 500);
+      // exercise
+      battery.generatePositions(view, 4);
+      // verify
+      assertUnit(battery.size() == 4);
+      for (int i = 1; i < battery.size(); i++)
+         assertUnit(battery[i - 1].getPosition().getMetersX() <
+                    battery[i].getPosition().getMetersX());
+      bool fLeft = battery[0].getPosition().getMetersX() < 14000.0;
+      for (int i = 0; i < battery.size(); i++)
+      {
+         double x = battery[i].getPosition().getMetersX();
+         assertUnit((x < 14000.0) == fLeft);
+         assertUnit(x >= 2800.0 && x <= 25200.0);
+      }
+   }  // teardown
+
+   /*********************************************
+    * name:    PLACE ON heights
+    * input:   guns at 10km and 20km on a 30km field
+    * output:  each gun sits on the ground, the x is unchanged
+    *********************************************/
+   void placeOn_heights()
+   {  // setup
+      Battery battery;
+      battery.add(Position(10000.0, 0.0));
+      battery.add(Position(20000.0, 0.0));
+      Ground ground(View(100.0, 300, 200));
+      // exercise
+      battery.placeOn(ground);
+      // verify
+      assertEquals(battery[0].getPosition().getMetersX(), 10000.0);
+      assertEquals(battery[1].getPosition().getMetersX(), 20000.0);
+      assertEquals(battery[0].getPosition().getMetersY(),
+                   ground.getElevationMeters(battery[0].getPosition()));
+      assertEquals(battery[1].getPosition().getMetersY(),
+                   ground.getElevationMeters(battery[1].getPosition()));
+   }  // teardown
+
+   /*********************************************
+    * name:    AIM time on target
+    *          Without drag the solver is exact, so the delays can be
+    *          checked against the vacuum equations
+    * input:   guns at 0km, 4km and 8km, target at 20km, no drag
+    * output:  every shell lands on the target at the same moment,
+    *          the farthest gun fires first
+    *********************************************/
+   void aim_timeOnTarget()
+   {  // setup
+      Battery battery;
+      battery.add(Position(0.0, 0.0));
+      battery.add(Position(4000.0, 0.0));
+      battery.add(Position(8000.0, 0.0));
+      ShotSpec spec;
+      spec.fDrag = false;
+      // exercise
+      Volley volley = battery.aim(Position(20000.0, 0.0), spec);
+      // verify
+      assertUnit(volley.numValid == 3);
+      assertUnit(volley.orders.size() == 3);
+      assertEquals(volley.orders[0].fireDelay, 0.0);
+      assertUnit(volley.orders[1].fireDelay > 0.0);
+      assertUnit(volley.orders[2].fireDelay > volley.orders[1].fireDelay);
+      for (int i = 0; i < 3; i++)
+      {
+         const FireOrder& order = volley.orders[i];
+         assertUnit(order.solution.fValid);
+         assertEquals(order.fireDelay + order.solution.timeOfFlight, volley.impactTime);
+         assertUnit(fabs(battery[i].getPosition().getMetersX() + order.solution.impactX
+                         - 20000.0) <= SOLVER_TOLERANCE);
+         assertEquals(battery[i].getElevation().getDegrees(), order.solution.elevation);
+      }
+   }  // teardown
+
+   /*********************************************
+    * name:    AIM out of range
+    * input:   a 827 m/s gun and a 100 m/s gun, target 20km away, no drag
+    * output:  only the first is valid and it fires at once. The other
+    *          is left pointing up
+    *********************************************/
+   void aim_outOfRange()
+   {  // setup
+      Battery battery;
+      battery.add(Position(0.0, 0.0));
+      battery.add(Position(0.0, 0.0), 100.0);
+      ShotSpec spec;
+      spec.fDrag = false;
+      // exercise
+      Volley volley = battery.aim(Position(20000.0, 0.0), spec);
+      // verify
+      assertUnit(volley.numValid == 1);
+      assertUnit(volley.orders[0].solution.fValid);
+      assertUnit(!volley.orders[1].solution.fValid);
+      assertEquals(volley.orders[0].fireDelay, 0.0);
+      assertEquals(volley.orders[1].fireDelay, 0.0);
+      assertEquals(volley.impactTime, volley.orders[0].solution.timeOfFlight);
+      assertEquals(battery[1].getElevation().getRadians(), 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    AIM threads agree
+    *          Each gun is solved on its own, so the number of threads
+    *          cannot change the answer
+    * input:   five guns with drag, aimed on 1 thread and on 4
+    * output:  the same bits
+    *********************************************/
+   void aim_threadsAgree()
+   {  // setup
+      Battery battery;
+      for (int i = 0; i < 5; i++)
+         battery.add(Position(1000.0 * i, 0.0), 800.0 + 10.0 * i);
+      ShotSpec spec;
+      Position posTarget(-12000.0, 0.0);
+      // exercise
+      Volley volley1 = battery.aim(posTarget, spec, false, 1);
+      Volley volley4 = battery.aim(posTarget, spec, false, 4);
+      // verify
+      assertUnit(volley1.numValid == 5);
+      assertUnit(volley4.numValid == 5);
+      assertUnit(volley1.impactTime == volley4.impactTime);
+      for (int i = 0; i < 5; i++)
+      {
+         assertUnit(volley1.orders[i].solution.elevation == volley4.orders[i].solution.elevation);
+         assertUnit(volley1.orders[i].fireDelay == volley4.orders[i].fireDelay);
+         assertUnit(volley1.orders[i].solution.elevation < 0.0);
+      }
+   }  // teardown
+
+   /*********************************************
+    * name:    AIM at guns on different heights
+    *          Each gun solves for the target's height above its own
+    * input:   guns at 0m, 500m and 1500m, a target 20km off at
+    *          1000m, no drag, high angle
+    * output:  flying each gun's elevation to the target's height
+    *          above it lands on the target, all at the same moment
+    *********************************************/
+   void aim_heights()
+   {  // setup
+      Battery battery;
+      battery.add(Position(0.0, 0.0));
+      battery.add(Position(1000.0, 500.0));
+      battery.add(Position(2000.0, 1500.0));
+      ShotSpec spec;
+      spec.fDrag = false;
+      Position posTarget(20000.0, 1000.0);
+      // exercise
+      Volley volley = battery.aim(posTarget, spec, true /*fHighAngle*/);
+      // verify
+      assertUnit(volley.numValid == 3);
+      for (int i = 0; i < 3; i++)
+      {
+         const FireOrder& order = volley.orders[i];
+         ShotSpec shot = spec;
+         shot.elevation = order.solution.elevation;
+         shot.impactHeight = posTarget.getMetersY() - battery[i].getPosition().getMetersY();
+         Trajectory trajectory = computeTrajectory(shot);
+         assertUnit(trajectory.fReached);
+         assertUnit(fabs(battery[i].getPosition().getMetersX() + trajectory.impactX
+                         - posTarget.getMetersX()) <= SOLVER_TOLERANCE);
+         assertEquals(order.fireDelay + trajectory.impactTime, volley.impactTime);
+      }
+   }  // teardown
+
+   /*********************************************
+    * name:    FIRE time on target
+    *          Flying the plan, not just making it
+    * input:   guns at 1km, 5km and 9km with drag and a 100 m/s gun
+    *          at 3km, a target at 20km on flat ground, 30 frames a
+    *          second until nothing is left in the air
+    * output:  every gun that can reach lands on the target, all
+    *          inside the window. The short gun never fires
+    *********************************************/
+   void fire_timeOnTarget()
+   {  // setup
+      Ground ground(View(100.0, 300, 200));
+      setupFlat(ground);
+      Battery battery;
+      battery.add(Position(1000.0, 0.0));
+      battery.add(Position(3000.0, 0.0), 100.0);
+      battery.add(Position(5000.0, 0.0), 800.0);
+      battery.add(Position(9000.0, 0.0), 750.0);
+      ShotSpec spec;
+      Volley volley = battery.aim(Position(20000.0, 0.0), spec);
+      int numLanded = 0;
+      int numFrames = 0;
+      // exercise
+      battery.fire(volley, spec);
+      while (battery.isFiring() && numFrames++ < 30 * 200)
+         numLanded += battery.advance(1.0 / 30.0, ground);
+      // verify
+      assertUnit(volley.numValid == 3);
+      assertUnit(numLanded == 3);
+      assertUnit(!battery.isFiring());
+      for (int i = 0; i < battery.size(); i++)
+      {
+         const Impact& impact = battery.getImpact(i);
+         assertUnit(impact.fLanded == volley.orders[i].solution.fValid);
+         assertUnit(battery.getSalvo(i).getNumFlying() == 0);
+         if (!impact.fLanded)
+            continue;
+         assertUnit(fabs(impact.x - 20000.0) <= SOLVER_TOLERANCE);
+         assertUnit(fabs(impact.time - volley.impactTime) <= TOT_WINDOW / 2.0);
+      }
+   }  // teardown
+
+   /*********************************************
+    * name:    FIRE waits its turn
+    * input:   guns at 1km and 9km, target at 20km, no drag. The clock
+    *          runs to just short of the near gun's delay, then past it
+    * output:  only the far gun's shell is in the air, then both
+    *********************************************/
+   void fire_waitsItsTurn()
+   {  // setup
+      Ground ground(View(100.0, 300, 200));
+      setupFlat(ground);
+      Battery battery;
+      battery.add(Position(1000.0, 0.0));
+      battery.add(Position(9000.0, 0.0));
+      ShotSpec spec;
+      spec.fDrag = false;
+      Volley volley = battery.aim(Position(20000.0, 0.0), spec);
+      battery.fire(volley, spec);
+      // exercise
+      battery.advance(volley.orders[1].fireDelay - 0.01, ground);
+      int numFlyingBefore[2] = { battery.getSalvo(0).getNumFlying(),
+                                 battery.getSalvo(1).getNumFlying() };
+      battery.advance(0.02, ground);
+      // verify
+      assertUnit(volley.orders[1].fireDelay > 1.0);
+      assertUnit(numFlyingBefore[0] == 1);
+      assertUnit(numFlyingBefore[1] == 0);
+      assertUnit(battery.getSalvo(1).getNumFlying() == 1);
+      assertEquals(battery.getSalvo(1)[0].getCurrentTime(), volley.orders[1].fireDelay);
+      assertUnit(battery.isFiring());
+   }  // teardown
+
+   /*********************************************
+    * name:    FIRE threads agree
+    *          Each gun flies its own shell, so the number of threads
+    *          cannot change where they land
+    * input:   four guns with drag, flown on 1 thread and on 4
+    * output:  the same bits
+    *********************************************/
+   void fire_threadsAgree()
+   {  // setup
+      Ground ground(View(100.0, 300, 200));
+      setupFlat(ground);
+      Battery battery;
+      for (int i = 0; i < 4; i++)
+         battery.add(Position(3000.0 + 2000.0 * i, 0.0), 800.0 - 10.0 * i);
+      ShotSpec spec;
+      Volley volley = battery.aim(Position(18000.0, 0.0), spec);
+      std::vector<Impact> impacts1;
+      std::vector<Impact> impacts4;
+      // exercise
+      for (int numThreads : { 1, 4 })
+      {
+         battery.fire(volley, spec);
+         for (int frame = 0; battery.isFiring() && frame < 30 * 200; frame++)
+            battery.advance(1.0 / 30.0, ground, numThreads);
+         for (int i = 0; i < battery.size(); i++)
+            (numThreads == 1 ? impacts1 : impacts4).push_back(battery.getImpact(i));
+      }
+      // verify
+      assertUnit(volley.numValid == 4);
+      for (int i = 0; i < 4; i++)
+      {
+         assertUnit(impacts1[i].fLanded && impacts4[i].fLanded);
+         assertUnit(impacts1[i].x == impacts4[i].x);
+         assertUnit(impacts1[i].time == impacts4[i].time);
+      }
+   }  // teardown
+
+   // a flat field 30km wide at sea level
+   void setupFlat(Ground& ground)
+   {
+      Position posHowitzer(1000.0, 0.0);
+      ground.load(std::vector<double>(300, 0.0), posHowitzer);
+   }
+};
@@ -0,0 +1,191 @@
+/***********************************************************************
+ * Header File:
+ *    TEST DRAG TABLE
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    All the unit tests for the precomputed drag table
+ ************************************************************************/
+
+#pragma once
+
+#include "dragTable.h"
+#include "projectile.h"
+#include "physics.h"
+#include "unitTest.h"
+#include <cmath>     // for fabs()
+
+/*******************************
+ * TEST DRAG TABLE
+ * A friend class for DragTable which contains its unit tests
+ ********************************/
+class TestDragTable : public UnitTest
+{
+public:
+   void run()
+   {
+      constructor_default();
+
+      getDeceleration_gridPoint();
+      getDeceleration_cubic();
+      getDeceleration_stopped();
+      getDeceleration_belowGround();
+      getDeceleration_tooFast();
+      getDeceleration_errorBound();
+
+      advance_withTable();
+
+      report("DragTable");
+   }
+
+private:
+
+   /*********************************************
+    * name:    CONSTRUCTOR with the default grid
+    * input:   M795: 46.7kg, 0.077545m
+    * output:  81 altitudes (0..80km) x 751 speeds (0..1500m/s)
+    *********************************************/
+   void constructor_default()
+   {  // setup
+      // exercise
+      DragTable table(46.7, 0.077545);
+      // verify
+      assertEquals(table.getMass(), 46.7);
+      assertEquals(table.getRadius(), 0.077545);
+      assertUnit(table.numAltitudes == 81);
+      assertUnit(table.numSpeeds == 751);
+      assertUnit(table.k.size() == 81 * 751);
+      assertEquals(table.maxAltitude, 80000.0);
+      assertEquals(table.maxSpeed, 1500.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET DECELERATION right on a grid point
+    * input:   5000m, 400m/s
+    * output:  the exact value, give or take float rounding
+    *********************************************/
+   void getDeceleration_gridPoint()
+   {  // setup
+      DragTable table(46.7, 0.077545);
+      double exact = DragTable::exactDeceleration(5000.0, 400.0, 46.7, 0.077545);
+      // exercise
+      double deceleration = table.getDeceleration(5000.0, 400.0);
+      // verify
+      assertUnit(exact > 0.0);
+      assertUnit(fabs(deceleration - exact) <= exact * 1e-6);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET DECELERATION from a table built smoothly
+    * input:   cubic interpolation, 5000m, 400m/s
+    * output:  the exact cubic value, not the linear one
+    *********************************************/
+   void getDeceleration_cubic()
+   {  // setup
+      DragTable table(46.7, 0.077545, DRAG_TABLE_ALTITUDE_STEP, DRAG_TABLE_SPEED_STEP,
+                      INTERPOLATE_CUBIC);
+      double cubic = DragTable::exactDeceleration(5000.0, 401.0, 46.7, 0.077545,
+                                                  INTERPOLATE_CUBIC);
+      double linear = DragTable::exactDeceleration(5000.0, 401.0, 46.7, 0.077545);
+      // exercise
+      double deceleration = table.getDeceleration(5000.0, 401.0);
+      // verify
+      assertUnit(table.getInterpolation() == INTERPOLATE_CUBIC);
+      assertUnit(fabs(deceleration - cubic) <= cubic * 1e-4);
+      assertUnit(cubic != linear);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET DECELERATION when not moving
+    * input:   1000m, 0m/s
+    * output:  0
+    *********************************************/
+   void getDeceleration_stopped()
+   {  // setup
+      DragTable table(46.7, 0.077545);
+      // exercise
+      double deceleration = table.getDeceleration(1000.0, 0.0);
+      // verify
+      assertEquals(deceleration, 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET DECELERATION below sea level
+    * input:   -100m, 300m/s
+    * output:  the same as at 0m, as the atmosphere tables clamp
+    *********************************************/
+   void getDeceleration_belowGround()
+   {  // setup
+      DragTable table(46.7, 0.077545);
+      // exercise
+      double below = table.getDeceleration(-100.0, 300.0);
+      double ground = table.getDeceleration(0.0, 300.0);
+      // verify
+      assertEquals(below, ground);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET DECELERATION off the fast end of the table
+    * input:   2000m, 1600m/s
+    * output:  exactly what advance() would compute
+    *********************************************/
+   void getDeceleration_tooFast()
+   {  // setup
+      DragTable table(46.7, 0.077545);
+      double exact = DragTable::exactDeceleration(2000.0, 1600.0, 46.7, 0.077545);
+      // exercise
+      double deceleration = table.getDeceleration(2000.0, 1600.0);
+      // verify
+      assertUnit(deceleration == exact);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET DECELERATION error bound
+    * input:   a spread of altitudes and speeds between grid points
+    * output:  within 3% of exact, and 0.6% outside Mach 0.85 to 1.1
+    *********************************************/
+   void getDeceleration_errorBound()
+   {  // setup
+      DragTable table(46.7, 0.077545);
+      double worst = 0.0;
+      double worstAway = 0.0;
+      // exercise
+      for (double altitude = 0.0; altitude < 80000.0; altitude += 373.0)
+         for (double speed = 20.0; speed < 1500.0; speed += 3.7)
+         {
+            double exact = DragTable::exactDeceleration(altitude, speed, 46.7, 0.077545);
+            double error = fabs(table.getDeceleration(altitude, speed) - exact) / exact;
+            double mach = speed / speedSoundFromAltitude(altitude);
+            worst = error > worst ? error : worst;
+            if (mach < 0.85 || mach > 1.1)
+               worstAway = error > worstAway ? error : worstAway;
+         }
+      // verify
+      assertUnit(worst < 0.03);
+      assertUnit(worstAway < 0.006);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADVANCE with the table
+    * input:   pos=0,1000 v=300,400 t=0, one second
+    * output:  within a centimeter of advancing without it
+    *********************************************/
+   void advance_withTable()
+   {  // setup
+      DragTable table(46.7, 0.077545);
+      Projectile exact;
+      Projectile fast;
+      fast.setDragTable(&table);
+      Angle angle;
+      angle.setDxDy(300.0, 400.0);
+      exact.fire(Position(0.0, 1000.0), 0.0, angle, 500.0);
+      fast.fire(Position(0.0, 1000.0), 0.0, angle, 500.0);
+      // exercise
+      exact.advance(1.0);
+      fast.advance(1.0);
+      // verify
+      assertUnit(fabs(fast.getPosition().getMetersX() - exact.getPosition().getMetersX()) < 0.01);
+      assertUnit(fabs(fast.getPosition().getMetersY() - exact.getPosition().getMetersY()) < 0.01);
+      assertUnit(fabs(fast.getSpeed() - exact.getSpeed()) < 0.01);
+   }  // teardown
+};
@@ -0,0 +1,336 @@
+/***********************************************************************
+ * Header File:
+ *    TEST FIRING TABLE
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    All the unit tests for the firing table and its cache
+ ************************************************************************/
+
+#pragma once
+
+#include "firingTable.h"
+#include "projectile.h"   // for GRAVITY
+#include "unitTest.h"
+#include <cmath>          // for fabs()
+
+/*******************************
+ * TEST FIRING TABLE
+ * A friend class for FiringTable which contains its unit tests
+ ********************************/
+class TestFiringTable : public UnitTest
+{
+public:
+   void run()
+   {
+      // no drag: check against the vacuum equations
+      construct_vacuum();
+      lookup_vacuumFlat();
+      lookup_vacuumHighLeft();
+      lookup_outOfReach();
+
+      // with drag: check against a full trajectory
+      lookup_drag();
+      matches_spec();
+
+      // a target above or below the gun
+      lookup_above();
+      lookup_below();
+      lookup_tooHigh();
+      lookup_belowTable();
+      getMaxRange_height();
+      lookup_maxRange();
+
+      // the cache
+      cache_getThenFind();
+
+      report("FiringTable");
+   }
+
+private:
+
+   /*********************************************
+    * name:    CONSTRUCT in a vacuum
+    * input:   827m/s, no drag, 0.25 degree rows
+    * output:  361 rows, the longest shot at 45 degrees is v^2/g
+    *********************************************/
+   void construct_vacuum()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      spec.fDrag = false;
+      // exercise
+      FiringTable table(spec);
+      // verify
+      assertUnit(table.ranges.size() == 361);
+      assertUnit(table.times.size() == 361);
+      assertUnit(table.errorTimes.size() == 360);
+      assertUnit(table.iPeak == 180);
+      assertUnit(table.descents.empty());
+      assertEquals(table.getMaxRange(), 827.0 * 827.0 / -GRAVITY);
+   }  // teardown
+
+   /*********************************************
+    * name:    LOOKUP in a vacuum, flat
+    * input:   10000m, 827m/s, no drag
+    * output:  within a hundredth of a degree of the vacuum equations
+    *********************************************/
+   void lookup_vacuumFlat()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      spec.fDrag = false;
+      FiringTable table(spec);
+      double elevation;
+      elevationFromVacuum(10000.0, 827.0, GRAVITY, false, elevation);
+      // exercise
+      FiringSolution solution = table.lookup(10000.0, 0.0);
+      // verify
+      assertUnit(solution.fValid);
+      assertUnit(solution.numEvaluations == 0);
+      assertUnit(fabs(solution.elevation - elevation) < 0.01);
+      assertEquals(solution.impactX, 10000.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    LOOKUP in a vacuum, high angle to the left
+    * input:   -30000m, 827m/s, no drag
+    * output:  a negative elevation under 45 degrees, with the time of
+    *          flight the vacuum gives for it
+    *********************************************/
+   void lookup_vacuumHighLeft()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      spec.fDrag = false;
+      FiringTable table(spec);
+      double errorTime;
+      double errorRange;
+      // exercise
+      FiringSolution solution = table.lookup(-30000.0, 0.0, true, errorTime, errorRange);
+      // verify
+      assertUnit(solution.fValid);
+      assertUnit(solution.elevation < 0.0 && solution.elevation > -45.0);
+      assertEquals(solution.impactX, -30000.0);
+      double dy = 827.0 * cos(solution.elevation * M_PI / 180.0);
+      assertUnit(fabs(solution.timeOfFlight - 2.0 * dy / -GRAVITY) <= errorTime + 0.01);
+      assertUnit(errorTime < 0.01);
+      assertUnit(errorRange < 1.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    LOOKUP out of reach
+    * input:   80000m, 827m/s, no drag
+    * output:  not valid
+    *********************************************/
+   void lookup_outOfReach()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      spec.fDrag = false;
+      FiringTable table(spec);
+      // exercise
+      FiringSolution flat = table.lookup(80000.0, 0.0, false);
+      FiringSolution high = table.lookup(80000.0, 0.0, true);
+      // verify
+      assertUnit(!flat.fValid);
+      assertUnit(!high.fValid);
+   }  // teardown
+
+   /*********************************************
+    * name:    LOOKUP with drag
+    * input:   15000m, 827m/s
+    * output:  a full trajectory at that elevation lands as close as
+    *          the table says it will
+    *********************************************/
+   void lookup_drag()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      FiringTable table(spec);
+      double errorTime;
+      double errorRange;
+      // exercise
+      FiringSolution solution = table.lookup(15000.0, 0.0, false, errorTime, errorRange);
+      // verify
+      assertUnit(solution.fValid);
+      assertUnit(errorRange < 1.0);
+      spec.elevation = solution.elevation;
+      Trajectory trajectory = computeTrajectory(spec);
+      assertUnit(fabs(trajectory.impactX - 15000.0) <= 2.0 * errorRange + 0.01);
+      assertUnit(fabs(trajectory.impactTime - solution.timeOfFlight) <= 2.0 * errorTime + 0.01);
+   }  // teardown
+
+   /*********************************************
+    * name:    LOOKUP above the gun
+    * input:   15000m out and 1000m up, 827m/s, high angle
+    * output:  a full trajectory to that height lands as close as the
+    *          table says it will
+    *********************************************/
+   void lookup_above()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      FiringTable table(spec);
+      double errorTime;
+      double errorRange;
+      // exercise
+      FiringSolution solution = table.lookup(15000.0, 1000.0, true, errorTime, errorRange);
+      // verify
+      assertUnit(solution.fValid);
+      assertUnit(solution.elevation < 45.0);
+      assertUnit(errorRange < 1.0);
+      spec.elevation = solution.elevation;
+      spec.impactHeight = 1000.0;
+      Trajectory trajectory = computeTrajectory(spec);
+      assertUnit(fabs(trajectory.impactX - 15000.0) <= 2.0 * errorRange + 0.01);
+      assertUnit(fabs(trajectory.impactTime - solution.timeOfFlight) <= 2.0 * errorTime + 0.01);
+   }  // teardown
+
+   /*********************************************
+    * name:    LOOKUP below the gun
+    * input:   15000m out and 1000m down, 827m/s, flat
+    * output:  a full trajectory to that height lands as close as the
+    *          table says it will, flatter than on level ground
+    *********************************************/
+   void lookup_below()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      FiringTable table(spec);
+      double errorTime;
+      double errorRange;
+      // exercise
+      FiringSolution solution = table.lookup(15000.0, -1000.0, false, errorTime, errorRange);
+      // verify
+      assertUnit(solution.fValid);
+      assertUnit(solution.elevation > table.lookup(15000.0, 0.0).elevation);
+      assertUnit(errorRange < 1.0);
+      spec.elevation = solution.elevation;
+      spec.impactHeight = -1000.0;
+      Trajectory trajectory = computeTrajectory(spec);
+      assertUnit(fabs(trajectory.impactX - 15000.0) <= 2.0 * errorRange + 0.01);
+      assertUnit(fabs(trajectory.impactTime - solution.timeOfFlight) <= 2.0 * errorTime + 0.01);
+   }  // teardown
+
+   /*********************************************
+    * name:    LOOKUP higher than any shell climbs
+    * input:   15000m out and 40km up, 827m/s
+    * output:  not valid either way
+    *********************************************/
+   void lookup_tooHigh()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      FiringTable table(spec);
+      // exercise
+      FiringSolution flat = table.lookup(15000.0, 40000.0, false);
+      FiringSolution high = table.lookup(15000.0, 40000.0, true);
+      // verify
+      assertUnit(!flat.fValid);
+      assertUnit(!high.fValid);
+   }  // teardown
+
+   /*********************************************
+    * name:    LOOKUP below the bottom of the table
+    * input:   15000m out and 1m further down than the rows go
+    * output:  not valid
+    *********************************************/
+   void lookup_belowTable()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      FiringTable table(spec);
+      // exercise
+      FiringSolution solution = table.lookup(15000.0, FIRING_TABLE_LOWEST - 1.0, false);
+      // verify
+      assertUnit(!solution.fValid);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET MAX RANGE at a height
+    * input:   827m/s, 1000m below, level and 1000m above
+    * output:  the lower the target, the farther the gun reaches
+    *********************************************/
+   void getMaxRange_height()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      FiringTable table(spec);
+      // exercise
+      double below = table.getMaxRange(-1000.0);
+      double level = table.getMaxRange(0.0);
+      double above = table.getMaxRange(1000.0);
+      // verify
+      assertUnit(below > level);
+      assertUnit(level > above);
+      assertUnit(above > 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    LOOKUP max range
+    *          The lookup finds the longest shot on its way
+    * input:   827m/s, 15000m out, 1000m below, level and 1000m above,
+    *          and 40000m above, which no row reaches
+    * output:  the same as getMaxRange() at each height, and 0 for the
+    *          one out of reach
+    *********************************************/
+   void lookup_maxRange()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      FiringTable table(spec);
+      double errorTime;
+      double errorRange;
+      double below;
+      double level;
+      double above;
+      double tooHigh;
+      // exercise
+      table.lookup(15000.0, -1000.0, false, errorTime, errorRange, below);
+      table.lookup(15000.0,     0.0, false, errorTime, errorRange, level);
+      table.lookup(15000.0,  1000.0, true,  errorTime, errorRange, above);
+      table.lookup(15000.0, 40000.0, false, errorTime, errorRange, tooHigh);
+      // verify
+      assertEquals(below, table.getMaxRange(-1000.0));
+      assertEquals(level, table.getMaxRange(0.0));
+      assertEquals(above, table.getMaxRange(1000.0));
+      assertEquals(tooHigh, 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    MATCHES spec
+    * input:   a table for 827m/s, no drag
+    * output:  any elevation or impact height matches; another speed or
+    *          drag does not
+    *********************************************/
+   void matches_spec()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      spec.fDrag = false;
+      FiringTable table(spec);
+      ShotSpec other = spec;
+      // exercise and verify
+      other.elevation = 30.0;
+      assertUnit(table.matches(other));
+      other.impactHeight = 500.0;
+      assertUnit(table.matches(other));
+      other.muzzleVelocity = 700.0;
+      assertUnit(!table.matches(other));
+      other.muzzleVelocity = 827.0;
+      other.fDrag = true;
+      assertUnit(!table.matches(other));
+   }  // teardown
+
+   /*********************************************
+    * name:    CACHE get then find
+    * input:   an empty cache, a 827m/s shot
+    * output:  nothing is found until it is built, then the same table
+    *          every time
+    *********************************************/
+   void cache_getThenFind()
+   {  // setup
+      FiringTableCache cache;
+      ShotSpec spec(0.0, 827.0);
+      spec.fDrag = false;
+      assertUnit(cache.find(spec) == nullptr);
+      // exercise
+      const FiringTable& table = cache.get(spec);
+      // verify
+      assertUnit(cache.size() == 1);
+      assertUnit(cache.find(spec) == &table);
+      assertUnit(&cache.get(spec) == &table);
+      assertUnit(cache.size() == 1);
+      spec.muzzleVelocity = 700.0;
+      assertUnit(cache.find(spec) == nullptr);
+   }  // teardown
+};
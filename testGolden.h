@@ -0,0 +1,248 @@
+/***********************************************************************
+ * Header File:
+ *    TEST GOLDEN
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    All the unit tests for the reference shot corpus
+ ************************************************************************/
+
+#pragma once
+
+#include "golden.h"
+#include "unitTest.h"
+#include <sstream>   // for stringstream
+#include <cmath>     // for nextafter()
+
+/*******************************
+ * TEST GOLDEN
+ * The unit tests for reading, writing and comparing the corpus
+ ********************************/
+class TestGolden : public UnitTest
+{
+public:
+   void run()
+   {
+      corpusSpecs_grid();
+
+      // the file format
+      writeRead_roundTrip();
+      read_badMagic();
+      read_truncated();
+
+      // comparing trajectories
+      compare_identical();
+      compare_oneUlpStrict();
+      compare_oneUlpAllowed();
+      compare_absolute();
+      compare_numSteps();
+
+      report("Golden");
+   }
+
+private:
+
+   /*********************************************
+    * name:    CORPUS SPECS
+    * input:   nothing
+    * output:  6 elevations x 3 velocities x 2 shells, all sampled
+    *********************************************/
+   void corpusSpecs_grid()
+   {  // setup
+      // exercise
+      std::vector<ShotSpec> specs = goldenCorpusSpecs();
+      // verify
+      assertUnit(specs.size() == 36);
+      assertEquals(specs[0].elevation, -45.0);
+      assertEquals(specs[0].muzzleVelocity, 300.0);
+      assertEquals(specs[0].mass, 46.7);
+      assertEquals(specs[35].elevation, 70.0);
+      assertEquals(specs[35].muzzleVelocity, 827.0);
+      assertEquals(specs[35].mass, 30.0);
+      assertUnit(specs[0].sampleEvery > 0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * FILE FORMAT
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    WRITE then READ
+    * input:   two shots, one with two samples
+    * output:  the same two shots, bit for bit
+    *********************************************/
+   void writeRead_roundTrip()
+   {  // setup
+      std::vector<GoldenShot> shots = standardShots();
+      std::stringstream stream;
+      std::vector<GoldenShot> shotsRead;
+      // exercise
+      bool fWrite = writeGoldenCorpus(stream, shots);
+      bool fRead = readGoldenCorpus(stream, shotsRead);
+      // verify
+      assertUnit(fWrite);
+      assertUnit(fRead);
+      assertUnit(shotsRead.size() == 2);
+      if (shotsRead.size() == 2)
+      {
+         assertUnit(shotsRead[0].spec.elevation == 40.0);
+         assertUnit(shotsRead[0].spec.sampleEvery == 10);
+         assertUnit(shotsRead[0].trajectory.impactX == 12345.678);
+         assertUnit(shotsRead[0].trajectory.numSteps == 123);
+         assertUnit(shotsRead[0].trajectory.samples.size() == 2);
+         assertUnit(shotsRead[0].trajectory.samples[1].dy == -0.125);
+         assertUnit(shotsRead[1].spec.mass == 30.0);
+         assertUnit(shotsRead[1].trajectory.samples.empty());
+      }
+   }  // teardown
+
+   /*********************************************
+    * name:    READ something that is not a corpus
+    * input:   "hello world"
+    * output:  false
+    *********************************************/
+   void read_badMagic()
+   {  // setup
+      std::stringstream stream("hello world, this is not a corpus");
+      std::vector<GoldenShot> shots;
+      // exercise
+      bool fRead = readGoldenCorpus(stream, shots);
+      // verify
+      assertUnit(!fRead);
+   }  // teardown
+
+   /*********************************************
+    * name:    READ a corpus cut short
+    * input:   the standard shots, missing the last byte
+    * output:  false
+    *********************************************/
+   void read_truncated()
+   {  // setup
+      std::stringstream streamFull;
+      writeGoldenCorpus(streamFull, standardShots());
+      std::string text = streamFull.str();
+      std::stringstream stream(text.substr(0, text.size() - 1));
+      std::vector<GoldenShot> shots;
+      // exercise
+      bool fRead = readGoldenCorpus(stream, shots);
+      // verify
+      assertUnit(!fRead);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * COMPARE
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    COMPARE a trajectory with itself
+    * input:   the first standard shot twice
+    * output:  match, 0 ulps
+    *********************************************/
+   void compare_identical()
+   {  // setup
+      Trajectory trajectory = standardShots()[0].trajectory;
+      // exercise
+      GoldenDiff diff = compareTrajectory(trajectory, trajectory, GoldenTolerance());
+      // verify
+      assertUnit(diff.fMatch);
+      assertUnit(diff.maxUlps == 0);
+      assertEquals(diff.maxAbsolute, 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    COMPARE with one value a ulp away and no tolerance
+    * input:   sample 0 x nudged up one ulp
+    * output:  no match on sample 0 x
+    *********************************************/
+   void compare_oneUlpStrict()
+   {  // setup
+      Trajectory expected = standardShots()[0].trajectory;
+      Trajectory actual = expected;
+      actual.samples[0].x = std::nextafter(actual.samples[0].x, 1e300);
+      // exercise
+      GoldenDiff diff = compareTrajectory(expected, actual, GoldenTolerance());
+      // verify
+      assertUnit(!diff.fMatch);
+      assertUnit(diff.field == "x");
+      assertUnit(diff.sample == 0);
+      assertUnit(diff.maxUlps == 1);
+   }  // teardown
+
+   /*********************************************
+    * name:    COMPARE with one value a ulp away, allowing one
+    * input:   sample 0 x nudged up one ulp, ulps=1
+    * output:  match
+    *********************************************/
+   void compare_oneUlpAllowed()
+   {  // setup
+      Trajectory expected = standardShots()[0].trajectory;
+      Trajectory actual = expected;
+      actual.samples[0].x = std::nextafter(actual.samples[0].x, 1e300);
+      // exercise
+      GoldenDiff diff = compareTrajectory(expected, actual, GoldenTolerance(1, 0.0));
+      // verify
+      assertUnit(diff.fMatch);
+      assertUnit(diff.maxUlps == 1);
+   }  // teardown
+
+   /*********************************************
+    * name:    COMPARE within an absolute tolerance
+    * input:   impactX off by 1e-9, absolute=1e-6
+    * output:  match
+    *********************************************/
+   void compare_absolute()
+   {  // setup
+      Trajectory expected = standardShots()[0].trajectory;
+      Trajectory actual = expected;
+      actual.impactX += 1e-9;
+      // exercise
+      GoldenDiff diff = compareTrajectory(expected, actual, GoldenTolerance(0, 1e-6));
+      // verify
+      assertUnit(diff.fMatch);
+      assertUnit(diff.maxUlps > 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    COMPARE with a different number of steps
+    * input:   numSteps 123 and 124, a huge tolerance
+    * output:  no match on numSteps
+    *********************************************/
+   void compare_numSteps()
+   {  // setup
+      Trajectory expected = standardShots()[0].trajectory;
+      Trajectory actual = expected;
+      actual.numSteps++;
+      // exercise
+      GoldenDiff diff = compareTrajectory(expected, actual, GoldenTolerance(1000000, 1000.0));
+      // verify
+      assertUnit(!diff.fMatch);
+      assertUnit(diff.field == "numSteps");
+      assertEquals(diff.expected, 123.0);
+      assertEquals(diff.actual, 124.0);
+   }  // teardown
+
+   // two made-up shots, the first with two samples
+   std::vector<GoldenShot> standardShots()
+   {
+      std::vector<GoldenShot> shots(2);
+      shots[0].spec = ShotSpec(40.0, 827.0);
+      shots[0].spec.sampleEvery = 10;
+      shots[0].trajectory.impactX = 12345.678;
+      shots[0].trajectory.impactTime = 61.5;
+      shots[0].trajectory.numSteps = 123;
+      TrajectorySample sample0 = { 0.0, 0.0, 0.0, 531.5, 633.5 };
+      TrajectorySample sample1 = { 5.0, 2500.25, 2800.5, 480.0, -0.125 };
+      shots[0].trajectory.samples.push_back(sample0);
+      shots[0].trajectory.samples.push_back(sample1);
+      shots[1].spec = ShotSpec(-45.0, 300.0);
+      shots[1].spec.mass = 30.0;
+      shots[1].trajectory.impactX = -4000.0;
+      shots[1].trajectory.impactTime = 30.0;
+      shots[1].trajectory.numSteps = 30;
+      return shots;
+   }
+};
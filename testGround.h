@@ -38,13 +38,12 @@ public:
 
       // setter
       reset_ten();
+      reset_battery();
 
       report("Ground");
    }
 
 private:
-   double metersFromPixels = -1.0;
-
    /*****************************************************************
     *****************************************************************
     * CONSTRUCTOR
@@ -58,22 +57,17 @@ private:
      *********************************************/
    void constructor()
    {  // setup
-      Position posUpperRight;
-      double metersFromPixels = posUpperRight.metersFromPixels;
-      posUpperRight.metersFromPixels = 1100.0;
-      posUpperRight.x = 4400; // 4px
-      posUpperRight.y = 5500; // 5px
+      View view(1100.0, 4, 5);
       // exercise
-      Ground g(posUpperRight);
+      Ground g(view);
       // verify
       assertUnit(g.iHowitzer == 0);
       assertUnit(g.ground != nullptr);
-      assertEquals(g.posUpperRight.x, 4400);
-      assertEquals(g.posUpperRight.y, 5500);
-      assertEquals(posUpperRight.x, 4400);
-      assertEquals(posUpperRight.y, 5500);
-      // teardown
-      posUpperRight.metersFromPixels = metersFromPixels;
+      assertEquals(g.view.getZoom(), 1100.0);
+      assertUnit(g.view.getWidth() == 4);
+      assertUnit(g.view.getHeight() == 5);
+      assertEquals(g.view.getUpperRight().getMetersX(), 4400.0);
+      assertEquals(g.view.getUpperRight().getMetersY(), 5500.0);
    }  // teardown
 
    /*****************************************************************
@@ -100,8 +94,6 @@ private:
       // verify
       assertEquals(elevation, 0.0);
       verifyStandardFixture(g);
-      // teardown
-      teardownStandardFixture(g);
    }  
 
    /*********************************************
@@ -121,8 +113,6 @@ private:
       // verify
       assertEquals(elevation, 7700.0);  // 7 pixels high or 7700m
       verifyStandardFixture(g);
-      // teardown
-      teardownStandardFixture(g);
    }  
 
    /*********************************************
@@ -144,8 +134,6 @@ private:
       assertEquals(posTarget.y, 7700.0);  // 7px
       g.iTarget = iTargetSave;
       verifyStandardFixture(g);
-      // teardown
-      teardownStandardFixture(g);
    }
 
    /*********************************************
@@ -167,8 +155,6 @@ private:
       assertEquals(posTarget.y, 2200.0);  // 2px
       g.iTarget = iTargetSave;
       verifyStandardFixture(g);
-      // teardown
-      teardownStandardFixture(g);
    }
 
    // Spy to see exactly what ogstream::draw*() methods are called... and how.
@@ -259,8 +245,6 @@ private:
       assertEquals(goutSpy.rectanglesEnd[8].y, 1100.0);
       assertEquals(goutSpy.rectanglesEnd[9].y, 0.0);
       verifyStandardFixture(g);
-      // teardown
-      teardownStandardFixture(g);
    }
 
 
@@ -287,8 +271,8 @@ private:
       // verify
       assertUnit(g.iHowitzer == 3);
       assertUnit(g.iTarget >= 0 && g.iTarget < 10);
-      assertEquals(g.posUpperRight.x, 11000.0);  // 10px
-      assertEquals(g.posUpperRight.y, 11000.0);  // 10px
+      assertUnit(g.view.getWidth() == 10);
+      assertUnit(g.view.getHeight() == 10);
       assertUnit(g.ground != nullptr);
       if (g.ground != nullptr)
       {
@@ -303,11 +287,34 @@ private:
          assertUnit(g.ground[8] >= 0.0 && g.ground[8] < 10.0);
          assertUnit(g.ground[9] >= 0.0 && g.ground[9] < 10.0);
       }
-      // teardown
-      teardownStandardFixture(g);
    }  
 
-
+   /*********************************************
+    * name:    RESET BATTERY
+    *          Every gun gets its own flat spot and its height from it
+    * input:   100 x 100 at 100m per pixel, guns at 10px, 30px and 45px
+    * output:  ground level under and beside each gun, target on the right
+    *********************************************/
+   void reset_battery()
+   {  // setup
+      Ground g(View(100.0, 100, 100));
+      vector<Position> posHowitzers;
+      posHowitzers.push_back(Position(1000.0, 0.0));   // 10px
+      posHowitzers.push_back(Position(3000.0, 0.0));   // 30px
+      posHowitzers.push_back(Position(4500.0, 0.0));   // 45px
+      // exercise
+      g.reset(posHowitzers);
+      // verify
+      assertUnit(g.iHowitzer == 10);
+      assertUnit(g.iTarget >= 55 && g.iTarget < 95);
+      for (int iGun : { 10, 30, 45 })
+         for (int i = iGun - 6; i < iGun + 6; i++)
+            assertEquals(g.ground[i], g.ground[i + 1]);
+      assertEquals(posHowitzers[0].getMetersY(), g.ground[10] * 100.0);
+      assertEquals(posHowitzers[1].getMetersY(), g.ground[30] * 100.0);
+      assertEquals(posHowitzers[2].getMetersY(), g.ground[45] * 100.0);
+      assertEquals(posHowitzers[1].getMetersX(), 3000.0);
+   }  // teardown
 
    /*****************************************************************
     *****************************************************************
@@ -319,9 +326,6 @@ private:
    // standard fixture: 10 x 10 with howitzer at 5 and target at 7
    void setupStandardFixture(Ground& g)
    {
-      metersFromPixels = g.posUpperRight.metersFromPixels;
-      g.posUpperRight.metersFromPixels = 1100.0;
-
       // delete the old
       if (g.ground != nullptr)
          delete [] g.ground;
@@ -330,8 +334,7 @@ private:
       for (int i = 0; i < 10; i++)
          g.ground[i] = 9.0 - (double)i;
 
-      g.posUpperRight.x = 11000.0;   // 10 pixels
-      g.posUpperRight.y = 11000.0;   // 10 pixels
+      g.view = View(1100.0, 10, 10);   // 11,000m on a side
       g.iHowitzer = 5;
       g.iTarget = 7;
    }
@@ -341,9 +344,9 @@ private:
    {
       assertUnit(g.iHowitzer == 5);
       assertUnit(g.iTarget == 7);
-      assertEquals(g.posUpperRight.x, 11000.0);
-      assertEquals(g.posUpperRight.y, 11000.0);
-      assertEquals(g.posUpperRight.metersFromPixels, 1100.0);
+      assertUnit(g.view.getWidth() == 10);
+      assertUnit(g.view.getHeight() == 10);
+      assertEquals(g.view.getZoom(), 1100.0);
       assert(g.ground != nullptr);
       if (g.ground != nullptr)
       {
@@ -359,11 +362,4 @@ private:
          assertEquals(g.ground[9], 0.0);
       }
    }
-
-   // standard fixture: teardown
-   void teardownStandardFixture(Ground& g)
-   {
-      assertUnit(-1.0 != metersFromPixels);
-      g.posUpperRight.metersFromPixels = metersFromPixels;
-   }
 };
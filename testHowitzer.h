@@ -48,8 +48,6 @@ public:
    }
 
 private:
-   double metersFromPixels = -1.0;
-
    /*****************************************************************
     *****************************************************************
     * CONSTRUCTOR
@@ -178,7 +176,7 @@ private:
    {
       // setup
       Howitzer h;
-      h.elevation.radians = 0.0;
+      h.elevation.setRadians(0.0);
       Angle e;
 
       // exercise
@@ -199,7 +197,7 @@ private:
    {
       // setup
       Howitzer h;
-      h.elevation.radians = 0.4;
+      h.elevation.setRadians(0.4);
       Angle e;
 
       // exercise
@@ -221,7 +219,7 @@ private:
    {
       // setup
       Howitzer h;
-      h.elevation.radians = 5.8;
+      h.elevation.setRadians(5.8);
       Angle e;
 
       // exercise
@@ -248,10 +246,10 @@ private:
    {
       // setup
       Howitzer h;
-      Position pos(10.0, 10.0);
+      View view(1.0, 10, 10);
 
       // exercise
-      h.generatePosition(pos);
+      h.generatePosition(view);
 
       // verify
       assertUnit(h.position.x >= 0.0);
@@ -268,10 +266,10 @@ private:
    {
       // setup
       Howitzer h;
-      Position pos(1000.0, 1000.0);
+      View view(1.0, 1000, 1000);
 
       // exercise
-      h.generatePosition(pos);
+      h.generatePosition(view);
 
       // verify
       assertUnit(h.position.x >= 0.0);
@@ -288,7 +286,7 @@ private:
    {
       // setup
       Howitzer h;
-      h.elevation.radians = 0.5;
+      h.elevation.setRadians(0.5);
 
       // exercise
       h.raise(-0.1);
@@ -307,7 +305,7 @@ private:
    {
       // setup
       Howitzer h;
-      h.elevation.radians = 0.5;
+      h.elevation.setRadians(0.5);
 
       // exercise
       h.raise(0.1);
@@ -326,7 +324,7 @@ private:
    {
       // setup
       Howitzer h;
-      h.elevation.radians = (2*M_PI) - 0.5;
+      h.elevation.setRadians((2*M_PI) - 0.5);
 
       // exercise
       h.raise(-0.1);
@@ -345,7 +343,7 @@ private:
    {
       // setup
       Howitzer h;
-      h.elevation.radians = (2 * M_PI) - 0.5;
+      h.elevation.setRadians((2 * M_PI) - 0.5);
 
       // exercise
       h.raise(0.1);
@@ -364,7 +362,7 @@ private:
    {
       // setup
       Howitzer h;
-      h.elevation.radians = 1.23;
+      h.elevation.setRadians(1.23);
 
       // exercise
       h.rotate(0.3);
@@ -383,7 +381,7 @@ private:
    {
       // setup
       Howitzer h;
-      h.elevation.radians = 1.23;
+      h.elevation.setRadians(1.23);
 
       // exercise
       h.rotate(-0.3);
@@ -402,7 +400,7 @@ private:
    {
       // setup
       Howitzer h;
-      h.elevation.radians = 6.1;
+      h.elevation.setRadians(6.1);
       tolerance = 0.1;
 
       // exercise
@@ -424,7 +422,7 @@ private:
    {
       // setup
       Howitzer h;
-      h.elevation.radians = 0.1;
+      h.elevation.setRadians(0.1);
       tolerance = 0.1;
 
       // exercise
@@ -436,26 +434,4 @@ private:
       //teardown
       tolerance = 0.0001;
    }
-
-   /*****************************************************************
-    *****************************************************************
-    * STANDARD FIXTURE
-    *****************************************************************
-    *****************************************************************/
-
-   // setup standard fixture - set the zoom to 1100m per pixel
-   void setupStandardFixture()
-   {
-      Position p;
-      metersFromPixels = p.metersFromPixels;
-      p.metersFromPixels = 1100.0;
-   }
-
-   // teardown the standard fixture - reset the zoom to what it was previously
-   void teardownStandardFixture()
-   {
-      assert(metersFromPixels != -1.0);
-      Position p;
-      p.metersFromPixels = metersFromPixels;
-   }
 };
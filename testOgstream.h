@@ -0,0 +1,190 @@
+/***********************************************************************
+ * Header File:
+ *    TEST OGSTREAM
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    All the unit tests for drawing text through the text arena
+ ************************************************************************/
+
+#pragma once
+
+#include "uiDraw.h"
+#include "unitTest.h"
+#include <string>
+#include <vector>
+
+/*******************************
+ * TEST OGSTREAM
+ * The unit tests for how the text written to an ogstream becomes lines
+ * on the screen, especially when there is more than the arena holds
+ ********************************/
+class TestOgstream : public UnitTest
+{
+public:
+   void run()
+   {
+      // lines
+      flush_lines();
+      flush_partial();
+
+      // more than the arena holds
+      overflow_carry();
+      overflow_longLine();
+      overflow_straddle();
+
+      report("Ogstream");
+   }
+
+private:
+
+   /*****************************************************************
+    *****************************************************************
+    * LINES
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    FLUSH lines
+    * input:   "one\ntwo\n" at (100,400)
+    * output:  "one" at 400, "two" at 382
+    *********************************************/
+   void flush_lines()
+   {  // setup
+      ogstreamText gout(View(1.0, 700, 500), Position(100.0, 400.0));
+      // exercise
+      gout << "one\ntwo\n";
+      gout.flush();
+      // verify
+      assertUnit(gout.texts.size() == 2);
+      assertUnit(gout.texts[0] == "one");
+      assertUnit(gout.texts[1] == "two");
+      assertEquals(gout.tops[0].getMetersX(), 100.0);
+      assertEquals(gout.tops[0].getMetersY(), 400.0);
+      assertEquals(gout.tops[1].getMetersX(), 100.0);
+      assertEquals(gout.tops[1].getMetersY(), 382.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    FLUSH partial
+    *          Text with no newline yet is drawn on a flush
+    * input:   "one\ntw"
+    * output:  "one" at 400, "tw" at 382
+    *********************************************/
+   void flush_partial()
+   {  // setup
+      ogstreamText gout(View(1.0, 700, 500), Position(0.0, 400.0));
+      // exercise
+      gout << "one\ntw";
+      gout.flush();
+      // verify
+      assertUnit(gout.texts.size() == 2);
+      assertUnit(gout.texts[0] == "one");
+      assertUnit(gout.texts[1] == "tw");
+      assertEquals(gout.tops[1].getMetersY(), 382.0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * MORE THAN THE ARENA HOLDS
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    OVERFLOW carry
+    *          The arena fills in the middle of a line
+    * input:   200 a's and a newline, then 100 b's and a newline
+    * output:  the a's are drawn when the arena fills, and the b's it
+    *          had so far wait for the rest of their line. The flush
+    *          draws all 100 b's 18 pixels lower
+    *********************************************/
+   void overflow_carry()
+   {  // setup
+      ogstreamText gout(View(1.0, 700, 500), Position(0.0, 400.0));
+      // exercise
+      gout << std::string(200, 'a') << "\n" << std::string(100, 'b') << "\n";
+      size_t numBeforeFlush = gout.texts.size();
+      gout.flush();
+      // verify
+      assertUnit(numBeforeFlush == 1);
+      assertUnit(gout.texts.size() == 2);
+      assertUnit(gout.texts[0] == std::string(200, 'a'));
+      assertUnit(gout.texts[1] == std::string(100, 'b'));
+      assertEquals(gout.tops[0].getMetersY(), 400.0);
+      assertEquals(gout.tops[1].getMetersY(), 382.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    OVERFLOW long line
+    *          A line longer than the arena is drawn in pieces
+    * input:   600 x's and a newline
+    * output:  a full arena of x's, another, then the 90 left over,
+    *          each 18 pixels below the last
+    *********************************************/
+   void overflow_longLine()
+   {  // setup
+      ogstreamText gout(View(1.0, 700, 500), Position(0.0, 400.0));
+      const size_t piece = TEXT_ARENA_SIZE - 1;
+      // exercise
+      gout << std::string(600, 'x') << "\n";
+      gout.flush();
+      // verify
+      assertUnit(gout.texts.size() == 3);
+      assertUnit(gout.texts[0] == std::string(piece, 'x'));
+      assertUnit(gout.texts[1] == std::string(piece, 'x'));
+      assertUnit(gout.texts[2] == std::string(600 - 2 * piece, 'x'));
+      assertEquals(gout.tops[0].getMetersY(), 400.0);
+      assertEquals(gout.tops[1].getMetersY(), 382.0);
+      assertEquals(gout.tops[2].getMetersY(), 364.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    OVERFLOW straddle
+    *          Whole lines on either side of the arena filling
+    * input:   99 a's, 99 b's, 99 c's, each with a newline
+    * output:  the a's and b's when the arena fills, the c's on the
+    *          flush, in order 18 pixels apart
+    *********************************************/
+   void overflow_straddle()
+   {  // setup
+      ogstreamText gout(View(1.0, 700, 500), Position(0.0, 400.0));
+      // exercise
+      gout << std::string(99, 'a') << "\n"
+           << std::string(99, 'b') << "\n"
+           << std::string(99, 'c') << "\n";
+      size_t numBeforeFlush = gout.texts.size();
+      gout.flush();
+      // verify
+      assertUnit(numBeforeFlush == 2);
+      assertUnit(gout.texts.size() == 3);
+      assertUnit(gout.texts[0] == std::string(99, 'a'));
+      assertUnit(gout.texts[1] == std::string(99, 'b'));
+      assertUnit(gout.texts[2] == std::string(99, 'c'));
+      assertEquals(gout.tops[0].getMetersY(), 400.0);
+      assertEquals(gout.tops[1].getMetersY(), 382.0);
+      assertEquals(gout.tops[2].getMetersY(), 364.0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * FIXTURE
+    *****************************************************************
+    *****************************************************************/
+
+   // note every piece of text and where it went, and draw nothing
+   class ogstreamText : public ogstream
+   {
+   public:
+      ogstreamText(const View& view, const Position& pos) : ogstream(view, pos) {}
+      ~ogstreamText() { flush(); }
+
+      void drawText(const Position& topLeft, const char* text)
+      {
+         texts.push_back(text);
+         tops.push_back(topLeft);
+      }
+
+      std::vector<std::string> texts;
+      std::vector<Position> tops;
+   };
+};
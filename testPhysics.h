@@ -70,6 +70,17 @@ public:
       linearInterpolation_mappinglower23();
       linearInterpolation_mappingSmall();
       linearInterpolation_mappingLarge();
+      linearInterpolation_cursorSweep();
+      linearInterpolation_cursorNeighbor();
+      linearInterpolation_cursorJump();
+      linearInterpolation_cursorOutside();
+
+      // Smooth interpolation
+      monotoneCubic_entries();
+      monotoneCubic_flat();
+      monotoneCubic_noOvershoot();
+      monotoneCubic_smoothSlope();
+      monotoneCubic_outside();
 
       //// Ticket 4: Gravity
       gravityFromAltitude_0();
@@ -105,6 +116,17 @@ public:
       dragFromMach_060();
       dragFromMach_010();
       dragFromMach_314();
+      dragFromMach_cursor();
+
+      // Closed form flight with no drag
+      impactTimeFromVacuum_ground();
+      impactTimeFromVacuum_falling();
+      elevationFromVacuum_45();
+      elevationFromVacuum_left();
+      elevationFromVacuum_high();
+      elevationFromVacuum_outOfReach();
+      elevationFromVacuum_above();
+      elevationFromVacuum_tooHigh();
 
       report("Physics");
    }
@@ -1040,6 +1062,188 @@ private:
    }  // teardown
 
 
+   /*******************************************************
+    * LINEAR INTERPOLATION with a cursor : up and back down
+    * input:  the density table, every 250m from -1000m to 85000m
+    *         and back, including every boundary
+    * output: exactly what the search without a cursor gives
+    ********************************************************/
+   void linearInterpolation_cursorSweep()
+   {  // setup
+      LookupCursor cursor;
+      bool fSame = true;
+      // exercise
+      for (int i = -4; i <= 340; i++)
+         fSame = fSame && densityFromAltitude(250.0 * i, cursor) == densityFromAltitude(250.0 * i);
+      for (int i = 340; i >= -4; i--)
+         fSame = fSame && densityFromAltitude(250.0 * i, cursor) == densityFromAltitude(250.0 * i);
+      // verify
+      assertUnit(fSame);
+   }  // teardown
+
+   /*******************************************************
+    * LINEAR INTERPOLATION with a cursor : into the next segment
+    * input:  mapping {0,0},{1,2},{2,3},{3,4}, cursor in segment 1,
+    *         domain 2.5
+    * output: 3.5, the cursor now in segment 2
+    ********************************************************/
+   void linearInterpolation_cursorNeighbor()
+   {  // setup
+      const Mapping mapping[] = { {0.0, 0.0}, {1.0, 2.0}, {2.0, 3.0}, {3.0, 4.0} };
+      LookupCursor cursor;
+      cursor.segment = 1;
+      // exercise
+      double range = linearInterpolation(mapping, 4, 2.5, cursor);
+      // verify
+      assertEquals(range, 3.5);
+      assertUnit(cursor.segment == 2);
+   }  // teardown
+
+   /*******************************************************
+    * LINEAR INTERPOLATION with a cursor : far from the last lookup
+    * input:  mapping {0,0},{1,2},{2,3},{3,4}, cursor in segment 2,
+    *         domain 0.5, then domain right on 2.0
+    * output: 1.0 in segment 0, then 3.0 in segment 1 where the
+    *         search without a cursor finds it
+    ********************************************************/
+   void linearInterpolation_cursorJump()
+   {  // setup
+      const Mapping mapping[] = { {0.0, 0.0}, {1.0, 2.0}, {2.0, 3.0}, {3.0, 4.0} };
+      LookupCursor cursor;
+      cursor.segment = 2;
+      // exercise
+      double low = linearInterpolation(mapping, 4, 0.5, cursor);
+      int segmentLow = cursor.segment;
+      cursor.segment = 2;
+      double boundary = linearInterpolation(mapping, 4, 2.0, cursor);
+      // verify
+      assertEquals(low, 1.0);
+      assertUnit(segmentLow == 0);
+      assertEquals(boundary, 3.0);
+      assertUnit(cursor.segment == 1);
+   }  // teardown
+
+   /*******************************************************
+    * LINEAR INTERPOLATION with a cursor : off either end
+    * input:  mapping {0,0},{1,2},{2,3},{3,4}, a cursor that is out
+    *         of range, domains -1 and 4
+    * output: 0 and 4, the cursor left alone
+    ********************************************************/
+   void linearInterpolation_cursorOutside()
+   {  // setup
+      const Mapping mapping[] = { {0.0, 0.0}, {1.0, 2.0}, {2.0, 3.0}, {3.0, 4.0} };
+      LookupCursor cursor;
+      cursor.segment = 99;
+      // exercise
+      double below = linearInterpolation(mapping, 4, -1.0, cursor);
+      double above = linearInterpolation(mapping, 4, 4.0, cursor);
+      // verify
+      assertEquals(below, 0.0);
+      assertEquals(above, 4.0);
+      assertUnit(cursor.segment == 99);
+   }  // teardown
+
+   /*******************************************************
+    * MONOTONE CUBIC : right on the entries
+    * input:  the drag table at Mach 0.3, 0.98, 1.0 and 5.0
+    * output: the table's own values
+    ********************************************************/
+   void monotoneCubic_entries()
+   {  // setup
+      LookupCursor cursor;
+      // exercise
+      double drag030 = dragFromMach(0.300, cursor, INTERPOLATE_CUBIC);
+      double drag098 = dragFromMach(0.980, cursor, INTERPOLATE_CUBIC);
+      double drag100 = dragFromMach(1.000, cursor, INTERPOLATE_CUBIC);
+      double drag500 = dragFromMach(5.000, cursor, INTERPOLATE_CUBIC);
+      // verify
+      assertEquals(drag030, 0.1629);
+      assertEquals(drag098, 0.4002);
+      assertEquals(drag100, 0.4258);
+      assertEquals(drag500, 0.2656);
+   }  // teardown
+
+   /*******************************************************
+    * MONOTONE CUBIC : where the table is flat
+    * input:  speed of sound from 15000m to 25000m, all 295m/s
+    * output: 295m/s the whole way, no bulge
+    ********************************************************/
+   void monotoneCubic_flat()
+   {  // setup
+      LookupCursor cursor;
+      bool fFlat = true;
+      // exercise
+      for (double altitude = 15000.0; altitude <= 25000.0; altitude += 125.0)
+         fFlat = fFlat && speedSoundFromAltitude(altitude, cursor, INTERPOLATE_CUBIC) == 295.0;
+      // verify
+      assertUnit(fFlat);
+   }  // teardown
+
+   /*******************************************************
+    * MONOTONE CUBIC : never past its neighbors
+    * input:  mapping {0,0},{1,0},{2,10},{3,10}, a hard step
+    * output: every value between 0 and 10, and rising
+    ********************************************************/
+   void monotoneCubic_noOvershoot()
+   {  // setup
+      const Mapping mapping[] = { {0.0, 0.0}, {1.0, 0.0}, {2.0, 10.0}, {3.0, 10.0} };
+      MonotoneCubic cubic(mapping, 4);
+      LookupCursor cursor;
+      bool fInside = true;
+      bool fRising = true;
+      double previous = 0.0;
+      // exercise
+      for (int i = 0; i <= 300; i++)
+      {
+         double range = cubic.interpolate(0.01 * i, cursor);
+         fInside = fInside && range >= 0.0 && range <= 10.0;
+         fRising = fRising && range >= previous;
+         previous = range;
+      }
+      // verify
+      assertUnit(fInside);
+      assertUnit(fRising);
+      assertEquals(cubic.interpolate(1.5, cursor), 5.0);
+   }  // teardown
+
+   /*******************************************************
+    * MONOTONE CUBIC : no kink at an entry
+    * input:  the drag table just either side of Mach 0.98, where the
+    *         linear slope jumps from 3.6 to 1.3 per Mach
+    * output: the slopes on either side agree
+    ********************************************************/
+   void monotoneCubic_smoothSlope()
+   {  // setup
+      LookupCursor cursor;
+      const double h = 1e-6;
+      // exercise
+      double below = (dragFromMach(0.98, cursor, INTERPOLATE_CUBIC) -
+                      dragFromMach(0.98 - h, cursor, INTERPOLATE_CUBIC)) / h;
+      double above = (dragFromMach(0.98 + h, cursor, INTERPOLATE_CUBIC) -
+                      dragFromMach(0.98, cursor, INTERPOLATE_CUBIC)) / h;
+      double linearBelow = (dragFromMach(0.98) - dragFromMach(0.98 - h)) / h;
+      double linearAbove = (dragFromMach(0.98 + h) - dragFromMach(0.98)) / h;
+      // verify
+      assertUnit(fabs(above - below) < 0.01);
+      assertUnit(fabs(linearAbove - linearBelow) > 1.0);
+   }  // teardown
+
+   /*******************************************************
+    * MONOTONE CUBIC : off either end
+    * input:  density at -500m and 90000m
+    * output: the first and last entries, as linear gives
+    ********************************************************/
+   void monotoneCubic_outside()
+   {  // setup
+      LookupCursor cursor;
+      // exercise
+      double below = densityFromAltitude(-500.0, cursor, INTERPOLATE_CUBIC);
+      double above = densityFromAltitude(90000.0, cursor, INTERPOLATE_CUBIC);
+      // verify
+      assertEquals(below, 1.2250000);
+      assertEquals(above, 0.0000185);
+   }  // teardown
+
    /*****************************************************************
     *****************************************************************
     * GRAVITY FROM ALTITUDE
@@ -1544,4 +1748,147 @@ private:
       // teardown
    }
 
+   /*******************************************************
+    * DRAG FROM MACH with a cursor : speeding up through Mach 1
+    * input:  Mach 0.0 to 2.0 in steps of 0.005
+    * output: exactly what the search without a cursor gives
+    ********************************************************/
+   void dragFromMach_cursor()
+   {  // setup
+      LookupCursor cursor;
+      bool fSame = true;
+      // exercise
+      for (int i = 0; i <= 400; i++)
+         fSame = fSame && dragFromMach(0.005 * i, cursor) == dragFromMach(0.005 * i);
+      // verify
+      assertUnit(fSame);
+   }  // teardown
+
+   /*******************************************************
+    * IMPACT TIME FROM VACUUM : fired up from the ground
+    * input:  y=0 dy=19.6128 gravity=-9.8064
+    * output: 4s, 2 up and 2 down
+    ********************************************************/
+   void impactTimeFromVacuum_ground()
+   {  // setup
+      double time = -99.99;
+      // exercise
+      time = impactTimeFromVacuum(0.0, 19.6128, -9.8064);
+      // verify
+      assertEquals(time, 4.0);
+   }  // teardown
+
+   /*******************************************************
+    * IMPACT TIME FROM VACUUM : dropped from a height
+    * input:  y=19.6128 dy=0 gravity=-9.8064
+    * output: 2s  since 19.6128 = 1/2 9.8064 t^2
+    ********************************************************/
+   void impactTimeFromVacuum_falling()
+   {  // setup
+      double time = -99.99;
+      // exercise
+      time = impactTimeFromVacuum(19.6128, 0.0, -9.8064);
+      // verify
+      assertEquals(time, 2.0);
+   }  // teardown
+
+   /*******************************************************
+    * ELEVATION FROM VACUUM : the longest possible shot
+    * input:  distance=10000 speed=sqrt(98064) gravity=-9.8064
+    * output: 45 degrees
+    ********************************************************/
+   void elevationFromVacuum_45()
+   {  // setup
+      double elevation = -99.99;
+      // exercise
+      bool fReach = elevationFromVacuum(10000.0, sqrt(98064.0), -9.8064, false, elevation);
+      // verify
+      assertUnit(fReach);
+      assertEquals(elevation, 45.0);
+   }  // teardown
+
+   /*******************************************************
+    * ELEVATION FROM VACUUM : to the left, the flat shot
+    * input:  distance=-5000 speed=sqrt(98064) gravity=-9.8064
+    * output: -75 degrees  since sin(2 x 15) = 1/2
+    ********************************************************/
+   void elevationFromVacuum_left()
+   {  // setup
+      double elevation = -99.99;
+      // exercise
+      bool fReach = elevationFromVacuum(-5000.0, sqrt(98064.0), -9.8064, false, elevation);
+      // verify
+      assertUnit(fReach);
+      assertEquals(elevation, -75.0);
+   }  // teardown
+
+   /*******************************************************
+    * ELEVATION FROM VACUUM : to the right, the lob
+    * input:  distance=5000 speed=sqrt(98064) gravity=-9.8064
+    * output: 15 degrees  since sin(2 x 75) = 1/2
+    ********************************************************/
+   void elevationFromVacuum_high()
+   {  // setup
+      double elevation = -99.99;
+      // exercise
+      bool fReach = elevationFromVacuum(5000.0, sqrt(98064.0), -9.8064, true, elevation);
+      // verify
+      assertUnit(fReach);
+      assertEquals(elevation, 15.0);
+   }  // teardown
+
+   /*******************************************************
+    * ELEVATION FROM VACUUM : too far away
+    * input:  distance=10001 speed=sqrt(98064) gravity=-9.8064
+    * output: false, elevation untouched
+    ********************************************************/
+   void elevationFromVacuum_outOfReach()
+   {  // setup
+      double elevation = -99.99;
+      // exercise
+      bool fReach = elevationFromVacuum(10001.0, sqrt(98064.0), -9.8064, false, elevation);
+      // verify
+      assertUnit(!fReach);
+      assertEquals(elevation, -99.99);
+   }  // teardown
+
+   /*******************************************************
+    * ELEVATION FROM VACUUM : a target above the gun
+    * input:  distance=5000 height=1000 speed=sqrt(98064)
+    *         gravity=-9.8064, flat and high
+    * output: both paths pass through (5000,1000), the high one steeper
+    ********************************************************/
+   void elevationFromVacuum_above()
+   {  // setup
+      double flat = -99.99;
+      double high = -99.99;
+      // exercise
+      bool fReachFlat = elevationFromVacuum(5000.0, 1000.0, sqrt(98064.0), -9.8064, false, flat);
+      bool fReachHigh = elevationFromVacuum(5000.0, 1000.0, sqrt(98064.0), -9.8064, true, high);
+      // verify
+      assertUnit(fReachFlat);
+      assertUnit(fReachHigh);
+      assertUnit(high < flat);
+      double uFlat = tan((90.0 - flat) * M_PI / 180.0);
+      double uHigh = tan((90.0 - high) * M_PI / 180.0);
+      assertEquals(5000.0 * uFlat - 1250.0 * (1.0 + uFlat * uFlat), 1000.0);
+      assertEquals(5000.0 * uHigh - 1250.0 * (1.0 + uHigh * uHigh), 1000.0);
+   }  // teardown
+
+   /*******************************************************
+    * ELEVATION FROM VACUUM : higher than the shell can climb
+    * input:  distance=0 height=5001 speed=sqrt(98064) gravity=-9.8064
+    *         (straight up reaches 5000m)
+    * output: false, elevation untouched
+    ********************************************************/
+   void elevationFromVacuum_tooHigh()
+   {  // setup
+      double elevation = -99.99;
+      // exercise
+      bool fReach = elevationFromVacuum(0.0, 5001.0, sqrt(98064.0), -9.8064, false, elevation);
+      // verify
+      assertUnit(!fReach);
+      assertEquals(elevation, -99.99);
+   }  // teardown
+
 };
@@ -35,27 +35,9 @@ public:
       getMetersX();
       getMetersY();
 
-      // ticket 8: pixels and zoom
-      setZoom_member();
-      setZoom_anotherVariable();
-      getZoom_member();
-      getZoom_anotherVariable();
-      setPixelsX_noZoom();
-      setPixelsX_zoom();
-      setPixelsY_noZoom();
-      setPixelsY_zoom();
-      getPixelsX_noZoom();
-      getPixelsX_zoom();
-      getPixelsY_noZoom();
-      getPixelsY_zoom();
-
       //// ticket 9: add
       addMetersX();
       addMetersY();
-      addPixelsX_noZoom();
-      addPixelsX_zoom();
-      addPixelsY_noZoom();
-      addPixelsY_zoom();
       add_stationary();
       add_moving();
       add_movingLonger();
@@ -81,19 +63,13 @@ private:
      * output:  pos=(0, 0)
      *********************************************/
    void construct_default()
-   {
-      // setup
-      double metersFromPixels = Position::metersFromPixels;
-      Position::metersFromPixels = 99.9;
+   {  // setup
       // exercise
       Position pos;
       // verify
       assertEquals(pos.x, 0.0);
       assertEquals(pos.y, 0.0);
-      assertEquals(pos.metersFromPixels, 99.9);
-      // teardown
-      Position::metersFromPixels = metersFromPixels;
-   }
+   }  // teardown
 
    /*********************************************
     * name:    NON-DEFAULT CONSTRUCTOR
@@ -103,8 +79,6 @@ private:
    void construct_nonDefault()
    {
       // setup
-      double metersFromPixels = Position::metersFromPixels;
-      Position::metersFromPixels = 99.9;
       double x = 120.0;
       double y = 360.0;
       // exercise
@@ -112,11 +86,8 @@ private:
       // verify
       assertEquals(pos.x, 120.0);
       assertEquals(pos.y, 360.0);
-      assertEquals(pos.metersFromPixels, 99.9);
       assertEquals(x, 120.0);
       assertEquals(y, 360.0);
-      // teardown
-      Position::metersFromPixels = metersFromPixels;
    }
 
    /*********************************************
@@ -127,8 +98,6 @@ private:
    void construct_copy()
    {
       // setup
-      double metersFromPixels = Position::metersFromPixels;
-      Position::metersFromPixels = 99.9;
       Position posRHS;
       posRHS.x = 1234.5;
       posRHS.y = 6789.0;
@@ -137,12 +106,8 @@ private:
       // verify
       assertEquals(posRHS.x, 1234.5);
       assertEquals(posRHS.y, 6789.0);
-      assertEquals(posRHS.metersFromPixels, 99.9);
       assertEquals(pos.x, 1234.5);
       assertEquals(pos.y, 6789.0);
-      assertEquals(pos.metersFromPixels, 99.9);
-      // teardown
-      Position::metersFromPixels = metersFromPixels;
    }
 
    /*********************************************
@@ -153,8 +118,6 @@ private:
    void assign()
    {
       // setup
-      double metersFromPixels = Position::metersFromPixels;
-      Position::metersFromPixels = 99.9;
       Position posLHS;
       posLHS.x = -99.9;
       posLHS.y = -88.8;
@@ -166,12 +129,8 @@ private:
       // verify
       assertEquals(posRHS.x, 24.68);
       assertEquals(posRHS.y, -13.57);
-      assertEquals(posRHS.metersFromPixels, 99.9);
       assertEquals(posLHS.x, 24.68);
       assertEquals(posLHS.y, -13.57);
-      assertEquals(posLHS.metersFromPixels, 99.9);
-      // teardown
-      Position::metersFromPixels = metersFromPixels;
    }
 
    /*****************************************************************
@@ -180,60 +139,6 @@ private:
     *****************************************************************
     *****************************************************************/
 
-    /*********************************************
-     * name:    GET ZOOM : member variable
-     * input:   pos.metersFromPixels=123.4
-     * output:  zoom=123.4
-     *          Position::metersFromPixels=123.4
-     *********************************************/
-   void getZoom_member()
-   {
-      // SETUP
-      Position pos;
-      Position::metersFromPixels = 99.9;
-      double metersFromPixels = Position::metersFromPixels;
-
-      // EXERCISE
-      pos.setZoom(123.4);
-
-      // VERIFY
-      assertEquals(pos.metersFromPixels, 123.4);
-      assertEquals(Position::metersFromPixels, 123.4);
-
-      // TEARDOWN
-      Position::metersFromPixels = metersFromPixels;
-   }
-
-   /*********************************************
-    * name:    GET ZOOM : another variable
-    * input:   pos1.metersFromPixels=99.9  (set this first)
-    *          pos2.metersFromPixels=123.4 (set this second)
-    * output:  zoom=123.4
-    *          pos1.metersFromPixels=123.4 (last assignment sticks)
-    *          pos2.metersFromPixels=123.4
-    *********************************************/
-   void getZoom_anotherVariable()
-   {
-      // SETUP
-      Position pos;
-      Position pos1;
-      Position pos2;
-      pos1.metersFromPixels = 99.9;
-      pos2.metersFromPixels = 88.9;
-      double metersFromPixels = Position::metersFromPixels;
-
-      // EXERCISE
-      pos2.setZoom(123.4);
-
-      // VERIFY
-      assertEquals(pos1.metersFromPixels, 123.4);
-      assertEquals(pos2.metersFromPixels, 123.4);
-      assertEquals(Position::metersFromPixels, 123.4);
-
-      // TEARDOWN
-      Position::metersFromPixels = metersFromPixels;
-   }
-
 
    /*********************************************
     * name:    GET METERS X
@@ -243,8 +148,6 @@ private:
    void getMetersX()
    {
       // setup
-      double metersFromPixels = Position::metersFromPixels;
-      Position::metersFromPixels = 99.9;
       Position pos;
       pos.x = 4500.0;
       pos.y = 2500.0;
@@ -254,9 +157,6 @@ private:
       assertEquals(x, 4500.0);
       assertEquals(pos.x, 4500.0);
       assertEquals(pos.y, 2500.0);
-      assertEquals(pos.metersFromPixels, 99.9);
-      // teardown
-      Position::metersFromPixels = metersFromPixels;
    }
 
    /*********************************************
@@ -267,8 +167,6 @@ private:
    void getMetersY()
    {
       // setup
-      double metersFromPixels = Position::metersFromPixels;
-      Position::metersFromPixels = 99.9;
       Position pos;
       pos.x = 4500.0;
       pos.y = 2500.0;
@@ -277,123 +175,7 @@ private:
       // verify
       assertEquals(pos.x, 4500.0);
       assertEquals(pos.y, 2500.0);
-      assertEquals(pos.metersFromPixels, 99.9);
       assertEquals(y, 2500.0);
-      // teardown
-      Position::metersFromPixels = metersFromPixels;
-   }
-
-   /*********************************************
-    * name:    GET METERS X NO ZOOM
-    * input:   pos=(123.4, 567.8) metersFromPixels=1
-    * output:  x=123.4
-    *********************************************/
-   void getPixelsX_noZoom()
-   {
-      //setup
-      double metersFromPixels = Position::metersFromPixels;
-      Position pos;
-      pos.x = 123.4;
-      pos.y = 567.8;
-      pos.metersFromPixels = 1.0;
-      double pixelsX;
-
-      //exercise
-      pixelsX = pos.getPixelsX();
-
-      //Verify
-      assertEquals(pixelsX, 123.4);
-      assertEquals(pos.x, 123.4);
-      assertEquals(pos.y, 567.8);
-      assertEquals(pos.metersFromPixels, 1.0);
-
-      //teardown
-      Position::metersFromPixels = metersFromPixels;
-   }
-
-   /*********************************************
-    * name:    GET PIXELS X ZOOM
-    *          pixels = meters / metersFromPixels
-    * input:   pos=(123.4, 567.8) metersFromPixels=100
-    * output:  x=1.234
-    *********************************************/
-   void getPixelsX_zoom()
-   {
-      //setup
-      double metersFromPixels = Position::metersFromPixels;
-      Position pos;
-      pos.x = 123.4;
-      pos.y = 567.8;
-      pos.metersFromPixels = 100.0;
-      double pixelsX;
-
-      //exercise
-      pixelsX = pos.getPixelsX();
-
-      //Verify
-      assertEquals(pixelsX, 1.234);
-      assertEquals(pos.x, 123.4);
-      assertEquals(pos.y, 567.8);
-      assertEquals(pos.metersFromPixels, 100.0);
-
-      //teardown
-      Position::metersFromPixels = metersFromPixels;
-   }
-
-   /*********************************************
-    * name:    GET PIXELS Y NO ZOOM
-    * input:   pos=(123.4, 567.8) metersFromPixels=1
-    * output:  y=567.8
-    *********************************************/
-   void getPixelsY_noZoom()
-   {
-      //setup
-      double metersFromPixels = Position::metersFromPixels;
-      Position pos;
-      pos.x = 123.4;
-      pos.y = 567.8;
-      pos.metersFromPixels = 1.0;
-      double pixelsY;
-
-      //exercise
-      pixelsY = pos.getPixelsY();
-
-      //Verify
-      assertEquals(pixelsY, 567.8);
-      assertEquals(pos.x, 123.4);
-      assertEquals(pos.y, 567.8);
-      assertEquals(pos.metersFromPixels, 1.0);
-
-      //teardown
-      Position::metersFromPixels = metersFromPixels;
-   }
-
-   /*********************************************
-    * name:    GET PIXELS Y ZOOM
-    * input:   pos=(123.4, 567.8) metersFromPixels=100
-    * output:  y=5.678
-    *********************************************/
-   void getPixelsY_zoom()
-   {
-      //setup
-      double metersFromPixels = Position::metersFromPixels;
-      Position pos;
-      pos.x = 123.4;
-      pos.y = 567.8;
-      pos.metersFromPixels = 100.0;
-      double pixelsY;
-
-      //exercise
-      pixelsY = pos.getPixelsY();
-
-      //Verify
-      assertEquals(pixelsY, 5.678);
-      assertEquals(pos.x, 123.4);
-      assertEquals(pos.y, 567.8);
-      assertEquals(pos.metersFromPixels, 100.0);
-
-      //teardown
-      Position::metersFromPixels = metersFromPixels;
    }
 
    /*****************************************************************
@@ -410,8 +192,6 @@ private:
      *********************************************/
    void setMetersX()
    {  // setup
-      double metersFromPixels = Position::metersFromPixels;
-      Position::metersFromPixels = 99.9;
       Position pos;
       pos.x = 999.9;
       pos.y = 888.8;
@@ -420,10 +200,7 @@ private:
       // verify
       assertEquals(pos.x, 123.4);
       assertEquals(pos.y, 888.8);
-      assertEquals(pos.metersFromPixels, 99.9);
-      // teardown
-      Position::metersFromPixels = metersFromPixels;
-   }
+   }  // teardown
 
    /*********************************************
     * name:    GET METERS Y
@@ -432,8 +209,6 @@ private:
     *********************************************/
    void setMetersY()
    {  // setup
-      double metersFromPixels = Position::metersFromPixels;
-      Position::metersFromPixels = 99.9;
       Position pos;
       pos.x = 999.9;
       pos.y = 888.8;
@@ -442,101 +217,7 @@ private:
       // verify
       assertEquals(pos.x, 999.9);
       assertEquals(pos.y, 123.4);
-      assertEquals(pos.metersFromPixels, 99.9);
-      // teardown
-      Position::metersFromPixels = metersFromPixels;
-   }
-
-   /*********************************************
-    * name:    SET PIXELS X NO ZOOM
-    *          When meterFromPixels == 1, pixels and meters are the same
-    * input:   pos=(999.9, 888.8) x=123.4 meterFromPixels=1
-    * output:  pos=(123.4, 888.8)
-    *********************************************/
-   void setPixelsX_noZoom()
-   {
-      // SETUP
-      Position pos;
-      pos.x = 999.9;
-      pos.y = 888.8;
-      pos.metersFromPixels = 1.0;
-
-      // EXERCISE
-      pos.setPixelsX(123.4);
-
-      // VERIFY
-      assertEquals(pos.x, 123.4);
-      assertEquals(pos.y, 888.8);
-      assertEquals(pos.metersFromPixels, 1.0);
-   }
-
-   /*********************************************
-    * name:    SET PIXELS X ZOOM
-    *          meters = pixels * metersFromPixels
-    * input:   pos=(999.9, 888.8) x=123.4 meterFromPixels=100
-    * output:  pos=(12340.0, 888.8)
-    *********************************************/
-   void setPixelsX_zoom()
-   {
-      // SETUP
-      Position pos;
-      pos.x = 999.9;
-      pos.y = 888.8;
-      pos.metersFromPixels = 100.0;
-
-      // EXERCISE
-      pos.setPixelsX(123.4);
-
-      // VERIFY
-      assertEquals(pos.x, 12340.0);
-      assertEquals(pos.y, 888.8);
-      assertEquals(pos.metersFromPixels, 100.0);
-   }
-
-   /*********************************************
-    * name:    SET PIXELS Y NO ZOOM
-    * input:   pos=(999.9, 888.8) y=123.4 meterFromPixels=1
-    * output:  pos=(999.9, 123.4)
-    *********************************************/
-   void setPixelsY_noZoom()
-   {
-      // SETUP
-      Position pos;
-      pos.x = 999.9;
-      pos.y = 888.8;
-      pos.metersFromPixels = 1.0;
-
-      // EXERCISE
-      pos.setPixelsY(123.4);
-
-      // VERIFY
-      assertEquals(pos.x, 999.9);
-      assertEquals(pos.y, 123.4);
-      assertEquals(pos.metersFromPixels, 1.0);
-   }
-
-   /*********************************************
-    * name:    SET PIXELS Y ZOOM
-    * input:   pos=(999.9, 888.8) y=123.4 meterFromPixels=100
-    * output:  pos=(999.9, 12340.0)
-    *********************************************/
-   void setPixelsY_zoom()
-   {
-      // SETUP
-      Position pos;
-      pos.x = 999.9;
-      pos.y = 888.8;
-      pos.metersFromPixels = 100.0;
-
-      // EXERCISE
-      pos.setPixelsY(123.4);
-
-
-      // VERIFY
-      assertEquals(pos.x, 999.9);
-      assertEquals(pos.y, 12340.0);
-      assertEquals(pos.metersFromPixels, 100.0);
-   }
+   }  // teardown
 
    /*********************************************
     * name:    ADD METERS X
@@ -584,174 +265,6 @@ private:
       assertEquals(yMeters, 123.4);
    }
 
-   /*********************************************
-    * name:    ADD PIXELS X ZERO ZOOM
-    * input:   pos=(4500,2500) x=3pixels meterFromPixels=1.0
-    * output:  pos=(4503,2500)
-    *********************************************/
-   void addPixelsX_noZoom()
-   {
-      //setup
-      double metersFromPixels = Position::metersFromPixels;
-      Position pos;
-      pos.x = 4500;
-      pos.y = 2500;
-      pos.metersFromPixels = 1.0;
-      double xPixels = 3;
-
-      //exercise
-      pos.addPixelsX(xPixels);
-
-      //Verify
-      assertEquals(pos.x, 4503.0);  //4503 == 4500 + 1 * 3
-      assertEquals(pos.y, 2500.0);
-      assertEquals(pos.metersFromPixels, 1.0);
-      assertEquals(xPixels, 3.0);
-
-      //teardown
-      Position::metersFromPixels = metersFromPixels;
-   }
-
-   /*********************************************
-    * name:    ADD PIXELS X ZOOM
-    * input:   pos=(4500,2500) x=3pixels meterFromPixels=50.0
-    * output:  pos=(4650,2500)
-    *********************************************/
-   void addPixelsX_zoom()
-   {
-      //setup
-      double metersFromPixels = Position::metersFromPixels;
-      Position pos;
-      pos.x = 4500;
-      pos.y = 2500;
-      pos.metersFromPixels = 50.0;
-      double xPixels = 3;
-
-      //exercise
-      pos.addPixelsX(xPixels);
-
-      //Verify
-      assertEquals(pos.x, 4650.0);  //4650 == 4500 + 50 * 3
-      assertEquals(pos.y, 2500.0);
-      assertEquals(pos.metersFromPixels, 50.0);
-      assertEquals(xPixels, 3.0);
-
-      //teardown
-      Position::metersFromPixels = metersFromPixels;
-   }
-
-   /*********************************************
-    * name:    ADD PIXELS Y ZERO ZOOM
-    * input:   pos=(4500,2500) y=3pixels meterFromPixels=1.0
-    * output:  pos=(4500,2503)
-    *********************************************/
-   void addPixelsY_noZoom()
-   {
-      //setup
-      double metersFromPixels = Position::metersFromPixels;
-      Position pos;
-      pos.x = 4500;
-      pos.y = 2500;
-      pos.metersFromPixels = 1.0;
-      double yPixels = 3;
-
-      //exercise
-      pos.addPixelsY(yPixels);
-
-      //Verify
-      assertEquals(pos.x, 4500.0);
-      assertEquals(pos.y, 2503.0);  //2503 == 2500 + 1 * 3
-      assertEquals(pos.metersFromPixels, 1.0);
-      assertEquals(yPixels, 3.0);
-
-      //teardown
-      Position::metersFromPixels = metersFromPixels;
-   }
-
-   /*********************************************
-    * name:    ADD PIXELS Y ZOOM
-    * input:   pos=(4500,2500) y=3pixels meterFromPixels=50.0
-    * output:  pos=(4500,2650)
-    *********************************************/
-   void addPixelsY_zoom()
-   {
-      //setup
-      double metersFromPixels = Position::metersFromPixels;
-      Position pos;
-      pos.x = 4500;
-      pos.y = 2500;
-      pos.metersFromPixels = 50.0;
-      double yPixels = 3;
-
-      //exercise
-      pos.addPixelsY(yPixels);
-
-      //Verify
-      assertEquals(pos.x, 4500.0);
-      assertEquals(pos.y, 2650.0);   //2650 == 2500 + 50 * 3
-      assertEquals(pos.metersFromPixels, 50.0);
-      assertEquals(yPixels, 3.0);
-
-      //teardown
-      Position::metersFromPixels = metersFromPixels;
-
-   }
-
-   /*********************************************
-    * name:    SET ZOOM : member variable
-    * input:   pos.metersFromPixels = 99.9, setZoom(123.4)
-    * output:  pos.metersFromPixels=123.4
-    *          Position::metersFromPixels=123.4
-    *********************************************/
-   void setZoom_member()
-   {
-      // SETUP
-      Position pos;
-      Position::metersFromPixels = 99.9;
-      double metersFromPixels = Position::metersFromPixels;
-
-      // EXERCISE
-      pos.setZoom(123.4);
-
-      // VERIFY
-      assertEquals(pos.metersFromPixels, 123.4);
-      assertEquals(Position::metersFromPixels, 123.4);
-
-      // TEARDOWN
-      Position::metersFromPixels = metersFromPixels;
-   }
-
-   /*********************************************
-    * name:    SET ZOOM : another variable
-    * input:   pos1.metersFromPixels=99.9
-    *          pos2.metersFromPixels=88.9
-    *          pos2.setZoom(123.4)
-    * output:  pos1.metersFromPixels=123.4
-    *          pos2.metersFromPixels=123.4
-    *          Position::metersFromPixels=123.4
-    *********************************************/
-   void setZoom_anotherVariable()
-   {
-      // SETUP
-      Position pos;
-      Position pos1;
-      Position pos2;
-      pos1.metersFromPixels = 99.9;
-      pos2.metersFromPixels = 88.9;
-      double metersFromPixels = Position::metersFromPixels;
-
-      // EXERCISE
-      pos2.setZoom(123.4);
-
-      // VERIFY
-      assertEquals(pos1.metersFromPixels, 123.4);
-      assertEquals(pos2.metersFromPixels, 123.4);
-      assertEquals(Position::metersFromPixels, 123.4);
-
-      // TEARDOWN
-      Position::metersFromPixels = metersFromPixels;
-   }
-
    /*********************************************
  * name:    ADD update position when not moving and not accelerating
  * input:   pos=(11.1,22.2) acc=(0,0), vel=(0,0) t=1
@@ -900,8 +413,6 @@ private:
     // update position when both moving and accelerating for 2 seconds
    void add_complex()
    {  // SETUP
-      double metersFromPixels = Position::metersFromPixels;
-      Position::metersFromPixels = 99.9;
       Position pos;
       pos.x = 11.1;
       pos.y = 22.2;
@@ -926,7 +437,6 @@ private:
       assertEquals(time, 2.0);
 
       // TEARDOWN
-      Position::metersFromPixels = metersFromPixels;
    }
 
 };
@@ -0,0 +1,171 @@
+/***********************************************************************
+ * Header File:
+ *    TEST PROFILE
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    All the unit tests for the profiling histograms
+ ************************************************************************/
+
+#pragma once
+
+#include "profile.h"
+#include "unitTest.h"
+#include <thread>      // for thread
+
+/*******************************
+ * TEST PROFILE
+ * The unit tests for the profiling histograms
+ ********************************/
+class TestProfile : public UnitTest
+{
+public:
+   void run()
+   {
+      count_empty();
+      count_three();
+      percentile_empty();
+      percentile_single();
+      percentile_outlier();
+      reset_full();
+      record_threadsRecycled();
+
+      report("Profile");
+   }
+
+private:
+
+   /*********************************************
+    * name:    COUNT nothing recorded
+    * input:   nothing
+    * output:  0
+    *********************************************/
+   void count_empty()
+   {  // setup
+      profileReset();
+      // exercise
+      uint64_t count = profileCount(PROFILE_UPDATE);
+      // verify
+      assertUnit(count == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    COUNT three samples
+    * input:   three samples of update, one of display
+    * output:  update=3 display=1
+    *********************************************/
+   void count_three()
+   {  // setup
+      profileReset();
+      // exercise
+      record(PROFILE_UPDATE, 1000);
+      record(PROFILE_UPDATE, 2000);
+      record(PROFILE_UPDATE, 3000);
+      record(PROFILE_DISPLAY, 1000);
+      // verify
+      assertUnit(profileCount(PROFILE_UPDATE) == 3);
+      assertUnit(profileCount(PROFILE_DISPLAY) == 1);
+      assertUnit(profileCount(PROFILE_ADVANCE) == 0);
+      // teardown
+      profileReset();
+   }
+
+   /*********************************************
+    * name:    PERCENTILE nothing recorded
+    * input:   nothing
+    * output:  0us
+    *********************************************/
+   void percentile_empty()
+   {  // setup
+      profileReset();
+      // exercise
+      double p50 = profilePercentile(PROFILE_UPDATE, 0.5);
+      // verify
+      assertEquals(p50, 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    PERCENTILE one sample
+    * input:   1000ns
+    * output:  within a bucket (25%) of 1us
+    *********************************************/
+   void percentile_single()
+   {  // setup
+      profileReset();
+      record(PROFILE_UPDATE, 1000);
+      // exercise
+      double p50 = profilePercentile(PROFILE_UPDATE, 0.5);
+      // verify
+      assertUnit(p50 > 0.75 && p50 < 1.25);
+      // teardown
+      profileReset();
+   }
+
+   /*********************************************
+    * name:    PERCENTILE with one slow outlier
+    * input:   99 x 1us, 1 x 1000us
+    * output:  p50 and p99 near 1us, max near 1000us
+    *********************************************/
+   void percentile_outlier()
+   {  // setup
+      profileReset();
+      for (int i = 0; i < 99; i++)
+         record(PROFILE_ADVANCE, 1000);
+      record(PROFILE_ADVANCE, 1000000);
+      // exercise
+      double p50 = profilePercentile(PROFILE_ADVANCE, 0.50);
+      double p99 = profilePercentile(PROFILE_ADVANCE, 0.99);
+      double max = profilePercentile(PROFILE_ADVANCE, 1.00);
+      // verify
+      assertUnit(p50 > 0.75 && p50 < 1.25);
+      assertUnit(p99 > 0.75 && p99 < 1.25);
+      assertUnit(max > 750.0 && max < 1250.0);
+      // teardown
+      profileReset();
+   }
+
+   /*********************************************
+    * name:    RESET after recording
+    * input:   two samples
+    * output:  count=0
+    *********************************************/
+   void reset_full()
+   {  // setup
+      record(PROFILE_GAMEPLAY, 5000);
+      record(PROFILE_GAMEPLAY, 5000);
+      // exercise
+      profileReset();
+      // verify
+      assertUnit(profileCount(PROFILE_GAMEPLAY) == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    RECORD threads recycled
+    *          A thread's recorder is taken over by the next thread
+    *          once it exits
+    * input:   ten threads, one after another, each recording once
+    * output:  at most one new recorder, and all ten samples kept
+    *********************************************/
+   void record_threadsRecycled()
+   {  // setup
+      profileReset();
+      int numBefore = profileNumRecorders();
+      // exercise
+      for (int i = 0; i < 10; i++)
+      {
+         std::thread worker([this]() { record(PROFILE_ADVANCE, 1000); });
+         worker.join();
+      }
+      // verify
+      assertUnit(profileNumRecorders() <= numBefore + 1);
+      assertUnit(profileCount(PROFILE_ADVANCE) == 10);
+      profileReset();
+   }  // teardown
+
+   // record a sample of a given number of nanoseconds
+   void record(ProfilePhase phase, long long ns)
+   {
+      std::chrono::steady_clock::time_point begin;
+      profileRecord(phase, begin, begin + std::chrono::nanoseconds(ns));
+   }
+};
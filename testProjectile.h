@@ -38,13 +38,20 @@ public:
       advance_up();
       advance_diagonalUp();
       advance_diagonalDown();
+      advance_noDrag();
+      advance_vacuum();
+      advance_trailFull();
+      getFlight_pastTrail();
+
+      // Interpolate between steps
+      getPosition_alphaEmpty();
+      getPosition_alphaSingle();
+      getPosition_alphaQuarter();
 
       report("Projectile");
    }
 
 private:
-   double metersFromPixels = -1.0;
-
    /*****************************************************************
     *****************************************************************
     * CONSTRUCTOR
@@ -147,7 +154,7 @@ private:
       pos.y = 222.0;
       double simulationTime(1.0);
       Angle angle;
-      angle.radians = MI_PI / 2.0;
+      angle.setRadians(MI_PI / 2.0);
       double muzzleVelocity(100.0);
 
       // EXERCISE
@@ -177,7 +184,7 @@ private:
       pos.y = 222.0;
       double simulationTime(1.0);
       Angle angle;
-      angle.radians = -MI_PI / 2.0;
+      angle.setRadians(-MI_PI / 2.0);
       double muzzleVelocity(100.0);
 
       // EXERCISE
@@ -207,7 +214,7 @@ private:
       pos.y = 222.0;
       double simulationTime(1.0);
       Angle d;
-      d.radians = 0.0;
+      d.setRadians(0.0);
       double muzzleVelocity(100.0);
 
       // EXERCISE
@@ -238,7 +245,6 @@ private:
    void advance_nothing()
    {
       // setup
-      setupStandardFixture();
       Projectile p;
 
       // exercise
@@ -249,9 +255,6 @@ private:
       assertEquals(p.mass, 46.7);
       assertEquals(p.radius, 0.077545);
       assertUnit(p.flightPath.empty());
-
-      // teardown
-      teardownStandardFixture();
    }
 
    /*********************************************
@@ -266,7 +269,6 @@ private:
    void advance_fall()
    {
       // setup
-      setupStandardFixture();
       Position pos;
       Projectile p;
       Projectile::PositionVelocityTime pvt;
@@ -295,9 +297,6 @@ private:
          assertEquals(p.flightPath.back().v.dy, -9.8064);  // 0 + (-9.8064)*1
          assertEquals(p.flightPath.back().t, 101.0);
       }
-
-      // teardown
-      teardownStandardFixture();
    }
 
    /*********************************************
@@ -312,7 +311,6 @@ private:
    void advance_horizontal()
    {
       // setup
-      setupStandardFixture();
       Position pos;
       Projectile p;
       Projectile::PositionVelocityTime pvt;
@@ -342,9 +340,6 @@ private:
          assertEquals(p.flightPath.back().v.dy, -9.8064);  // 0 + (-9.8064)*1
          assertEquals(p.flightPath.back().t, 101.0);
       }
-
-      // teardown
-      teardownStandardFixture();
    }
 
    /*********************************************
@@ -359,7 +354,6 @@ private:
    void advance_up()
    {
       // setup
-      setupStandardFixture();
       Position pos;
       Projectile p;
       Projectile::PositionVelocityTime pvt;
@@ -388,9 +382,6 @@ private:
          assertEquals(p.flightPath.back().v.dy, 89.8042);  // 100 + (-9.8064-.3893)
          assertEquals(p.flightPath.back().t, 101.0);
       }
-
-      // teardown
-      teardownStandardFixture();
    }
 
    /*********************************************
@@ -405,7 +396,6 @@ private:
    void advance_diagonalUp()
    {
       // setup
-      setupStandardFixture();
       Position pos;
       Projectile p;
       Projectile::PositionVelocityTime pvt;
@@ -434,8 +424,6 @@ private:
          assertEquals(p.flightPath.back().v.dy, 30.1297);  //40 + (-9.8064-0.0638)*1
          assertEquals(p.flightPath.back().t, 101.0);
       }
-      // teardown
-      teardownStandardFixture();
    }
 
    /*********************************************
@@ -449,7 +437,6 @@ private:
     *********************************************/
    void advance_diagonalDown()
    {  // setup
-      setupStandardFixture();
       Position pos;
       Projectile p;
       Projectile::PositionVelocityTime pvt;
@@ -478,30 +465,190 @@ private:
          assertEquals(p.flightPath.back().v.dy, -49.7425);  //-40 + (-9.8064+0.0638)*1*1
          assertEquals(p.flightPath.back().t, 101.0);
       }
-      // teardown
-      teardownStandardFixture();
-   }
+   }  // teardown
+
+   /*********************************************
+    * name:    ADVANCE : with drag turned off
+    * input:   flightPath={pos=100,200 v=50,40 t=100} no drag
+    * output:  flightPath={}{pos.x=150      = 100 + 50*1
+    *                       pos.y=235.0968 = 200 + 40*1 + .5(-9.8064)*1*1
+    *                       v.dx = 50
+    *                       v.dy = 30.1936 =  40 + (-9.8064)*1
+    *                       t=101}
+    *********************************************/
+   void advance_noDrag()
+   {  // setup
+      Projectile p;
+      p.setDrag(false);
+      Projectile::PositionVelocityTime pvt;
+      pvt.pos.x = 100.0;
+      pvt.pos.y = 200.0;
+      pvt.v.dx = 50.0;
+      pvt.v.dy = 40.0;
+      pvt.t = 100.0;
+      p.flightPath.push_back(pvt);
+
+      // exercise
+      p.advance(1.0);
+
+      // verify
+      assertUnit(p.flightPath.size() == 2);
+      assertEquals(p.flightPath.back().pos.x, 150.0);
+      assertEquals(p.flightPath.back().pos.y, 235.0968);
+      assertEquals(p.flightPath.back().v.dx, 50.0);
+      assertEquals(p.flightPath.back().v.dy, 30.1936);
+      assertEquals(p.flightPath.back().t, 101.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADVANCE : above the atmosphere
+    * input:   flightPath={pos=0,90000 v=100,0 t=0}
+    * output:  flightPath={}{pos.x=100      = 0 + 100*1
+    *                       pos.y=89995.0968 = 90000 + .5(-9.8064)*1*1
+    *                       v.dx = 100  no drag at all
+    *                       v.dy =-9.8064
+    *                       t=1}
+    *********************************************/
+   void advance_vacuum()
+   {  // setup
+      Projectile p;
+      Projectile::PositionVelocityTime pvt;
+      pvt.pos.x = 0.0;
+      pvt.pos.y = 90000.0;
+      pvt.v.dx = 100.0;
+      pvt.v.dy = 0.0;
+      pvt.t = 0.0;
+      p.flightPath.push_back(pvt);
+
+      // exercise
+      p.advance(1.0);
+
+      // verify
+      assertUnit(p.flightPath.size() == 2);
+      assertEquals(p.flightPath.back().pos.x, 100.0);
+      assertEquals(p.flightPath.back().pos.y, 89995.0968);
+      assertEquals(p.flightPath.back().v.dx, 100.0);
+      assertEquals(p.flightPath.back().v.dy, -9.8064);
+      assertEquals(p.flightPath.back().t, 1.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADVANCE : the trail is as long as it gets
+    * input:   flightPath={t=0}{t=1}...{t=9} pos=0,90000 v=100,0
+    * output:  flightPath={t=1}...{t=9}{t=10}
+    *********************************************/
+   void advance_trailFull()
+   {  // setup
+      Projectile p;
+      Projectile::PositionVelocityTime pvt;
+      pvt.pos.x = 0.0;
+      pvt.pos.y = 90000.0;
+      pvt.v.dx = 100.0;
+      pvt.v.dy = 0.0;
+      for (int i = 0; i < FLIGHT_PATH_LENGTH; i++)
+      {
+         pvt.t = (double)i;
+         p.flightPath.push_back(pvt);
+      }
+
+      // exercise
+      p.advance(1.0);
+
+      // verify
+      assertUnit(p.flightPath.size() == FLIGHT_PATH_LENGTH);
+      assertEquals(p.flightPath.front().t, 1.0);
+      assertEquals(p.flightPath.back().t, 10.0);
+      assertEquals(p.flightPath.back().pos.x, 100.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET FLIGHT : longer than the trail remembers
+    *          Distance and time are from the muzzle, not from the
+    *          oldest step still in the trail
+    * input:   fired right at 100m/s from (111,90000) t=1, no drag,
+    *          20 steps of 1s
+    * output:  distance 2000m, time 20s
+    *********************************************/
+   void getFlight_pastTrail()
+   {  // setup
+      Projectile p;
+      Position pos;
+      pos.x = 111.0;
+      pos.y = 90000.0;
+      Angle angle;
+      angle.setRadians(MI_PI / 2.0);
+      p.setDrag(false);
+      p.fire(pos, 1.0, angle, 100.0);
+      for (int i = 0; i < 20; i++)
+         p.advance(1.0);
+      // exercise
+      double distance = p.getFlightDistance();
+      double time = p.getFlightTime();
+      // verify
+      assertEquals(distance, 2000.0);
+      assertEquals(time, 20.0);
+   }  // teardown
 
    /*****************************************************************
     *****************************************************************
-    * STANDARD FIXTURE
+    * GET POSITION (interpolated)
     *****************************************************************
     *****************************************************************/
 
-    // setup standard fixture - set the zoom to 1100m per pixel
-   void setupStandardFixture()
-   {
-      Position p;
-      metersFromPixels = p.metersFromPixels;
-      p.metersFromPixels = 1.0;
-   }
+   /*********************************************
+    * name:    GET POSITION ALPHA : nothing in flight
+    * input:   flightPath={} alpha=0.5
+    * output:  (0,0)
+    *********************************************/
+   void getPosition_alphaEmpty()
+   {  // setup
+      Projectile p;
+      // exercise
+      Position pos = p.getPosition(0.5);
+      // verify
+      assertEquals(pos.x, 0.0);
+      assertEquals(pos.y, 0.0);
+   }  // teardown
 
-   // teardown the standard fixture - reset the zoom to what it was previously
-   void teardownStandardFixture()
-   {
-      assert(metersFromPixels != -1.0);
-      Position p;
-      p.metersFromPixels = metersFromPixels;
-   }
+   /*********************************************
+    * name:    GET POSITION ALPHA : only one step so far
+    * input:   flightPath={pos=100,200} alpha=0.5
+    * output:  (100,200)
+    *********************************************/
+   void getPosition_alphaSingle()
+   {  // setup
+      Projectile p;
+      Projectile::PositionVelocityTime pvt;
+      pvt.pos.x = 100.0;
+      pvt.pos.y = 200.0;
+      p.flightPath.push_back(pvt);
+      // exercise
+      Position pos = p.getPosition(0.5);
+      // verify
+      assertEquals(pos.x, 100.0);
+      assertEquals(pos.y, 200.0);
+   }  // teardown
 
+   /*********************************************
+    * name:    GET POSITION ALPHA : a quarter of the way between two steps
+    * input:   flightPath={pos=100,200}{pos=300,100} alpha=0.25
+    * output:  (150,175)
+    *********************************************/
+   void getPosition_alphaQuarter()
+   {  // setup
+      Projectile p;
+      Projectile::PositionVelocityTime pvt;
+      pvt.pos.x = 100.0;
+      pvt.pos.y = 200.0;
+      p.flightPath.push_back(pvt);
+      pvt.pos.x = 300.0;
+      pvt.pos.y = 100.0;
+      p.flightPath.push_back(pvt);
+      // exercise
+      Position pos = p.getPosition(0.25);
+      // verify
+      assertEquals(pos.x, 150.0);
+      assertEquals(pos.y, 175.0);
+      assertUnit(p.flightPath.size() == 2);
+   }  // teardown
 };
\ No newline at end of file
@@ -0,0 +1,241 @@
+/***********************************************************************
+ * Header File:
+ *    TEST RASTER
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    All the unit tests for the software rasterizer
+ ************************************************************************/
+
+#pragma once
+
+#include "uiRaster.h"
+#include "unitTest.h"
+
+/*******************************
+ * TEST RASTER
+ * A friend class for ogstreamRaster which contains its unit tests
+ ********************************/
+class TestRaster : public UnitTest
+{
+public:
+   void run()
+   {
+      // setup
+      constructor();
+      clear_black();
+
+      // primitives
+      drawRectangle_inside();
+      drawRectangle_reversed();
+      drawLine_horizontal();
+      drawLine_diagonal();
+      drawPolygon_triangle();
+      drawPolygon_degenerate();
+
+      // built on the primitives
+      drawTarget_center();
+      drawText_letter();
+
+      report("Raster");
+   }
+
+private:
+   /*****************************************************************
+    *****************************************************************
+    * CONSTRUCTOR
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    CONSTRUCTOR
+    * input:   10 x 8
+    * output:  10 x 8, every pixel white
+    *********************************************/
+   void constructor()
+   {  // setup
+      // exercise
+      ogstreamRaster gout(View(1.0, 10, 8));
+      // verify
+      assertUnit(gout.getWidth() == 10);
+      assertUnit(gout.getHeight() == 8);
+      assertUnit(gout.pixels.size() == 80);
+      assertUnit(gout.getPixel(0, 0) == 0xFFFFFF);
+      assertUnit(gout.getPixel(9, 7) == 0xFFFFFF);
+   }  // teardown
+
+   /*********************************************
+    * name:    CLEAR to black
+    * input:   10 x 8 white
+    * output:  every pixel black
+    *********************************************/
+   void clear_black()
+   {  // setup
+      ogstreamRaster gout(View(1.0, 10, 8));
+      // exercise
+      gout.clear(0.0, 0.0, 0.0);
+      // verify
+      assertUnit(gout.getPixel(0, 0) == 0x000000);
+      assertUnit(gout.getPixel(5, 4) == 0x000000);
+      assertUnit(gout.getPixel(9, 7) == 0x000000);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * PRIMITIVES
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    DRAW RECTANGLE inside the frame
+    * input:   (2,2) to (5,4) red
+    * output:  x=2..4, y=2..3 red, the rest white
+    *********************************************/
+   void drawRectangle_inside()
+   {  // setup
+      ogstreamRaster gout(View(1.0, 10, 8));
+      // exercise
+      gout.drawRectangle(Position(2.0, 2.0), Position(5.0, 4.0), 1.0, 0.0, 0.0);
+      // verify
+      assertUnit(gout.getPixel(2, 2) == 0xFF0000);
+      assertUnit(gout.getPixel(4, 3) == 0xFF0000);
+      assertUnit(gout.getPixel(5, 2) == 0xFFFFFF);
+      assertUnit(gout.getPixel(2, 4) == 0xFFFFFF);
+      assertUnit(gout.getPixel(1, 2) == 0xFFFFFF);
+      assertUnit(gout.getPixel(2, 1) == 0xFFFFFF);
+   }  // teardown
+
+   /*********************************************
+    * name:    DRAW RECTANGLE with the corners swapped and off the edge
+    * input:   (12,6) to (8,-3) blue
+    * output:  x=8..9, y=0..5 blue
+    *********************************************/
+   void drawRectangle_reversed()
+   {  // setup
+      ogstreamRaster gout(View(1.0, 10, 8));
+      // exercise
+      gout.drawRectangle(Position(12.0, 6.0), Position(8.0, -3.0), 0.0, 0.0, 1.0);
+      // verify
+      assertUnit(gout.getPixel(8, 0) == 0x0000FF);
+      assertUnit(gout.getPixel(9, 5) == 0x0000FF);
+      assertUnit(gout.getPixel(7, 0) == 0xFFFFFF);
+      assertUnit(gout.getPixel(9, 6) == 0xFFFFFF);
+   }  // teardown
+
+   /*********************************************
+    * name:    DRAW LINE horizontally
+    * input:   (1,1) to (6,1) black
+    * output:  x=1..6, y=1 black
+    *********************************************/
+   void drawLine_horizontal()
+   {  // setup
+      ogstreamRaster gout(View(1.0, 10, 8));
+      // exercise
+      gout.drawLine(Position(1.0, 1.0), Position(6.0, 1.0));
+      // verify
+      assertUnit(gout.getPixel(0, 1) == 0xFFFFFF);
+      assertUnit(gout.getPixel(1, 1) == 0x000000);
+      assertUnit(gout.getPixel(3, 1) == 0x000000);
+      assertUnit(gout.getPixel(6, 1) == 0x000000);
+      assertUnit(gout.getPixel(7, 1) == 0xFFFFFF);
+      assertUnit(gout.getPixel(3, 0) == 0xFFFFFF);
+      assertUnit(gout.getPixel(3, 2) == 0xFFFFFF);
+   }  // teardown
+
+   /*********************************************
+    * name:    DRAW LINE diagonally
+    * input:   (0,0) to (4,4) green
+    * output:  the diagonal is green
+    *********************************************/
+   void drawLine_diagonal()
+   {  // setup
+      ogstreamRaster gout(View(1.0, 10, 8));
+      // exercise
+      gout.drawLine(Position(0.0, 0.0), Position(4.0, 4.0), 0.0, 1.0, 0.0);
+      // verify
+      assertUnit(gout.getPixel(0, 0) == 0x00FF00);
+      assertUnit(gout.getPixel(2, 2) == 0x00FF00);
+      assertUnit(gout.getPixel(4, 4) == 0x00FF00);
+      assertUnit(gout.getPixel(1, 0) == 0xFFFFFF);
+      assertUnit(gout.getPixel(5, 5) == 0xFFFFFF);
+   }  // teardown
+
+   /*********************************************
+    * name:    DRAW POLYGON a right triangle
+    * input:   (0,0) (8,0) (0,8) black
+    * output:  lower-left half filled
+    *********************************************/
+   void drawPolygon_triangle()
+   {  // setup
+      ogstreamRaster gout(View(1.0, 10, 8));
+      Position points[3] = { Position(0.0, 0.0), Position(8.0, 0.0), Position(0.0, 8.0) };
+      // exercise
+      gout.drawPolygon(points, 3);
+      // verify
+      assertUnit(gout.getPixel(0, 0) == 0x000000);
+      assertUnit(gout.getPixel(6, 0) == 0x000000);
+      assertUnit(gout.getPixel(0, 6) == 0x000000);
+      assertUnit(gout.getPixel(3, 3) == 0x000000);
+      assertUnit(gout.getPixel(4, 4) == 0xFFFFFF);
+      assertUnit(gout.getPixel(9, 0) == 0xFFFFFF);
+   }  // teardown
+
+   /*********************************************
+    * name:    DRAW POLYGON with no area
+    * input:   (1,1) (5,5) (3,3) black
+    * output:  nothing drawn
+    *********************************************/
+   void drawPolygon_degenerate()
+   {  // setup
+      ogstreamRaster gout(View(1.0, 10, 8));
+      Position points[3] = { Position(1.0, 1.0), Position(5.0, 5.0), Position(3.0, 3.0) };
+      unsigned int checksum = gout.checksum();
+      // exercise
+      gout.drawPolygon(points, 3);
+      // verify
+      assertUnit(gout.checksum() == checksum);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * SHAPES
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    DRAW TARGET in the middle of the screen
+    * input:   (10,10) on a 20x20 frame
+    * output:  a green 10x10 square from 5 to 14
+    *********************************************/
+   void drawTarget_center()
+   {  // setup
+      ogstreamRaster gout(View(1.0, 20, 20));
+      // exercise
+      gout.drawTarget(Position(10.0, 10.0));
+      // verify
+      assertUnit(gout.getPixel(10, 10) == 0x33BF33);
+      assertUnit(gout.getPixel(5, 5)   == 0x33BF33);
+      assertUnit(gout.getPixel(14, 14) == 0x33BF33);
+      assertUnit(gout.getPixel(4, 10)  == 0xFFFFFF);
+      assertUnit(gout.getPixel(15, 10) == 0xFFFFFF);
+   }  // teardown
+
+   /*********************************************
+    * name:    DRAW TEXT one letter
+    * input:   "I" at (0,0)
+    * output:  top bar at y=6 from x=1..3, stem at x=2
+    *********************************************/
+   void drawText_letter()
+   {  // setup
+      ogstreamRaster gout(View(1.0, 10, 8));
+      // exercise
+      gout.drawText(Position(0.0, 0.0), "I");
+      // verify
+      assertUnit(gout.getPixel(1, 6) == 0x000000);
+      assertUnit(gout.getPixel(3, 6) == 0x000000);
+      assertUnit(gout.getPixel(2, 3) == 0x000000);
+      assertUnit(gout.getPixel(1, 3) == 0xFFFFFF);
+      assertUnit(gout.getPixel(0, 6) == 0xFFFFFF);
+      assertUnit(gout.getPixel(2, 7) == 0xFFFFFF);
+   }  // teardown
+};
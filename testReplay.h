@@ -0,0 +1,425 @@
+/***********************************************************************
+ * Header File:
+ *    TEST REPLAY
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    All the unit tests for recording and replaying input
+ ************************************************************************/
+
+#pragma once
+
+#include "replay.h"
+#include "simulation.h"
+#include "uiRaster.h"
+#include "unitTest.h"
+#include "littleEndian.h"
+#include <sstream>     // for istringstream and ostringstream
+#include <string>
+#include <vector>
+
+/*******************************
+ * TEST REPLAY
+ * The unit tests for the input log, for setting the keys by hand, and
+ * for running the game without a window
+ ********************************/
+class TestReplay : public UnitTest
+{
+public:
+   void run()
+   {
+      // the keys
+      setInput_held();
+      getInput_all();
+
+      // the log
+      record_runs();
+      record_compact();
+      record_delta();
+      read_notALog();
+      read_cutShort();
+      read_version1();
+
+      // playing it back
+      scriptInput_cycles();
+      replayInput_frames();
+      replayInput_delta();
+      replayInput_same();
+
+      report("Replay");
+   }
+
+private:
+
+   /*****************************************************************
+    *****************************************************************
+    * THE KEYS
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    SET INPUT held
+    * input:   up and space, a frame goes by, then up alone
+    * output:  up counts 1 then 2, space is only there the first frame
+    *********************************************/
+   void setInput_held()
+   {  // setup
+      Interface ui;
+      ui.setInput(0);
+      // exercise
+      ui.setInput(INPUT_UP | INPUT_SPACE);
+      int upFirst = ui.isUp();
+      bool spaceFirst = ui.isSpace();
+      ui.keyEvent();
+      ui.setInput(INPUT_UP);
+      // verify
+      assertUnit(upFirst == 1);
+      assertUnit(spaceFirst);
+      assertUnit(ui.isUp() == 2);
+      assertUnit(!ui.isSpace());
+      assertUnit(ui.isDown() == 0);
+      assertUnit(ui.getInput() == INPUT_UP);
+      ui.setInput(0);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET INPUT all
+    * input:   every key
+    * output:  every bit comes back
+    *********************************************/
+   void getInput_all()
+   {  // setup
+      Interface ui;
+      unsigned int keys = INPUT_UP | INPUT_DOWN | INPUT_LEFT | INPUT_RIGHT |
+                          INPUT_SPACE | INPUT_Q;
+      // exercise
+      ui.setInput(keys);
+      // verify
+      assertUnit(ui.getInput() == keys);
+      assertUnit(ui.isLeft() && ui.isRight() && ui.isQ());
+      ui.setInput(0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * THE LOG
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    RECORD runs
+    * input:   nothing 3 frames, up 2 frames, space 1 frame, seed 42,
+    *          each frame 1/30s
+    * output:  reads back as three runs with the seed and the view
+    *********************************************/
+   void record_runs()
+   {  // setup
+      std::ostringstream out;
+      InputLog log;
+      std::string error;
+      // exercise
+      {
+         InputRecorder recorder(out, 42, View(40.0, 700, 500));
+         recorder.record(0, 1.0 / 30.0);
+         recorder.record(0, 1.0 / 30.0);
+         recorder.record(0, 1.0 / 30.0);
+         recorder.record(INPUT_UP, 1.0 / 30.0);
+         recorder.record(INPUT_UP, 1.0 / 30.0);
+         recorder.record(INPUT_SPACE, 1.0 / 30.0);
+         assertUnit(recorder.getNumFrames() == 6);
+      }
+      std::istringstream in(out.str());
+      bool fRead = readInputLog(in, log, error);
+      // verify
+      assertUnit(fRead);
+      assertUnit(log.seed == 42);
+      assertEquals(log.view.getZoom(), 40.0);
+      assertUnit(log.view.getWidth() == 700);
+      assertUnit(log.view.getHeight() == 500);
+      assertUnit(log.runs.size() == 3);
+      assertUnit(log.runs[0].keys == 0 && log.runs[0].count == 3);
+      assertUnit(log.runs[1].keys == INPUT_UP && log.runs[1].count == 2);
+      assertUnit(log.runs[2].keys == INPUT_SPACE && log.runs[2].count == 1);
+      assertUnit(log.runs[0].delta == INPUT_FRAME_DELTA);
+      assertUnit(log.runs[2].delta == INPUT_FRAME_DELTA);
+      assertUnit(log.getNumFrames() == 6);
+   }  // teardown
+
+   /*********************************************
+    * name:    RECORD compact
+    *          Holding a key for an hour costs a few bytes
+    * input:   up for 100,000 frames, then nothing for 1, each 1/30s
+    * output:  32 bytes of header, 7 for the first run, 5 for the last
+    *********************************************/
+   void record_compact()
+   {  // setup
+      std::ostringstream out;
+      // exercise
+      {
+         InputRecorder recorder(out, 1, View());
+         for (int i = 0; i < 100000; i++)
+            recorder.record(INPUT_UP, 1.0 / 30.0);
+         recorder.record(0, 1.0 / 30.0);
+      }
+      // verify
+      assertUnit(out.str().size() == 32 + 7 + 5);
+      InputLog log;
+      std::string error;
+      std::istringstream in(out.str());
+      assertUnit(readInputLog(in, log, error));
+      assertUnit(log.runs.size() == 2);
+      assertUnit(log.runs[0].count == 100000);
+   }  // teardown
+
+   /*********************************************
+    * name:    RECORD delta
+    *          A change of frame time starts a run, as keys do
+    * input:   up for 0s, 2 frames of 1/60s, then 1 frame of 1/20s
+    * output:  three runs of up, at 0us, 16667us and 50000us
+    *********************************************/
+   void record_delta()
+   {  // setup
+      std::ostringstream out;
+      InputLog log;
+      std::string error;
+      // exercise
+      {
+         InputRecorder recorder(out, 1, View());
+         recorder.record(INPUT_UP, 0.0);
+         recorder.record(INPUT_UP, 1.0 / 60.0);
+         recorder.record(INPUT_UP, 1.0 / 60.0);
+         recorder.record(INPUT_UP, 1.0 / 20.0);
+      }
+      std::istringstream in(out.str());
+      bool fRead = readInputLog(in, log, error);
+      // verify
+      assertUnit(fRead);
+      assertUnit(log.runs.size() == 3);
+      assertUnit(log.runs[0].delta == 0 && log.runs[0].count == 1);
+      assertUnit(log.runs[1].delta == 16667 && log.runs[1].count == 2);
+      assertUnit(log.runs[2].delta == 50000 && log.runs[2].count == 1);
+      assertUnit(log.runs[2].keys == INPUT_UP);
+   }  // teardown
+
+   /*********************************************
+    * name:    READ not a log
+    * input:   some text
+    * output:  false, not an input log
+    *********************************************/
+   void read_notALog()
+   {  // setup
+      std::istringstream in("index,elevation,muzzleVelocity\n");
+      InputLog log;
+      std::string error;
+      // exercise
+      bool fRead = readInputLog(in, log, error);
+      // verify
+      assertUnit(!fRead);
+      assertUnit(error == "not an input log");
+   }  // teardown
+
+   /*********************************************
+    * name:    READ cut short
+    * input:   a log whose last run stops in the middle of its count
+    * output:  false
+    *********************************************/
+   void read_cutShort()
+   {  // setup
+      std::ostringstream out;
+      {
+         InputRecorder recorder(out, 1, View());
+         for (int i = 0; i < 1000; i++)
+            recorder.record(INPUT_LEFT, 1.0 / 30.0);
+      }
+      std::string bytes = out.str();
+      std::istringstream in(bytes.substr(0, bytes.size() - 1));
+      InputLog log;
+      std::string error;
+      // exercise
+      bool fRead = readInputLog(in, log, error);
+      // verify
+      assertUnit(!fRead);
+      assertUnit(!error.empty());
+   }  // teardown
+
+   /*********************************************
+    * name:    READ version 1
+    *          A log from before the frame time was kept
+    * input:   version 1, up for 300 frames, then nothing for 2
+    * output:  two runs, each frame INPUT_FRAME_DELTA
+    *********************************************/
+   void read_version1()
+   {  // setup
+      std::ostringstream out;
+      out.write("M777INPT", 8);
+      writeU32(out, 1);
+      writeU32(out, 9);
+      writeF64(out, 40.0);
+      writeU32(out, 700);
+      writeU32(out, 500);
+      out.put((char)INPUT_UP);
+      writeVarint(out, 300);
+      out.put((char)0);
+      writeVarint(out, 2);
+      std::istringstream in(out.str());
+      InputLog log;
+      std::string error;
+      // exercise
+      bool fRead = readInputLog(in, log, error);
+      // verify
+      assertUnit(fRead);
+      assertUnit(log.seed == 9);
+      assertUnit(log.runs.size() == 2);
+      assertUnit(log.runs[0].keys == INPUT_UP && log.runs[0].count == 300);
+      assertUnit(log.runs[1].keys == 0 && log.runs[1].count == 2);
+      assertUnit(log.runs[0].delta == INPUT_FRAME_DELTA);
+      assertUnit(log.runs[1].delta == INPUT_FRAME_DELTA);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * PLAYING IT BACK
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    SCRIPT INPUT cycles
+    * input:   two cycles and 3 frames
+    * output:  right 5, space, wait, left 10, space, wait, right 3
+    *********************************************/
+   void scriptInput_cycles()
+   {  // setup
+      View view(40.0, 700, 500);
+      // exercise
+      InputLog log = scriptInput(2 * SCRIPT_CYCLE + 3, 7, view);
+      // verify
+      assertUnit(log.seed == 7);
+      assertUnit(log.view.getWidth() == 700);
+      assertUnit(log.getNumFrames() == 2 * SCRIPT_CYCLE + 3);
+      assertUnit(log.runs.size() == 7);
+      assertUnit(log.runs[0].keys == INPUT_RIGHT && log.runs[0].count == 5);
+      assertUnit(log.runs[1].keys == INPUT_SPACE && log.runs[1].count == 1);
+      assertUnit(log.runs[2].keys == 0 && log.runs[2].count == SCRIPT_CYCLE - 6);
+      assertUnit(log.runs[3].keys == INPUT_LEFT && log.runs[3].count == 10);
+      assertUnit(log.runs[4].keys == INPUT_SPACE);
+      assertUnit(log.runs[6].keys == INPUT_RIGHT && log.runs[6].count == 3);
+   }  // teardown
+
+   /*********************************************
+    * name:    REPLAY INPUT frames
+    *          The callback sees the keys as it would from the window
+    * input:   nothing 2 frames, up 3 frames, space 1 frame
+    * output:  6 calls. Up counts 1 2 3 while held
+    *********************************************/
+   void replayInput_frames()
+   {  // setup
+      InputLog log;
+      log.runs.push_back(InputRun { 0, INPUT_FRAME_DELTA, 2 });
+      log.runs.push_back(InputRun { INPUT_UP, INPUT_FRAME_DELTA, 3 });
+      log.runs.push_back(InputRun { INPUT_SPACE, INPUT_FRAME_DELTA, 1 });
+      std::vector<int> seen;
+      // exercise
+      long long numFrames = replayInput(log, callBack, (void*)&seen);
+      // verify
+      assertUnit(numFrames == 6);
+      assertUnit(seen.size() == 6);
+      assertUnit(seen[0] == 0);
+      assertUnit(seen[1] == 0);
+      assertUnit(seen[2] == 1);
+      assertUnit(seen[3] == 2);
+      assertUnit(seen[4] == 3);
+      assertUnit(seen[5] == -1);
+      Interface().setInput(0);
+   }  // teardown
+
+   /*********************************************
+    * name:    REPLAY INPUT delta
+    *          Each frame is as long as the session's was
+    * input:   1 frame of 0us, 2 of 16667us, 1 of 50000us
+    * output:  the callback sees 0, 16667, 16667, 50000us
+    *********************************************/
+   void replayInput_delta()
+   {  // setup
+      InputLog log;
+      log.runs.push_back(InputRun { 0, 0, 1 });
+      log.runs.push_back(InputRun { 0, 16667, 2 });
+      log.runs.push_back(InputRun { INPUT_UP, 50000, 1 });
+      std::vector<double> seen;
+      // exercise
+      replayInput(log, callBackDelta, (void*)&seen);
+      // verify
+      assertUnit(seen.size() == 4);
+      assertEquals(seen[0], 0.0);
+      assertEquals(seen[1], 0.016667);
+      assertEquals(seen[2], 0.016667);
+      assertEquals(seen[3], 0.05);
+      Interface().setInput(0);
+   }  // teardown
+
+   /*********************************************
+    * name:    REPLAY INPUT same
+    *          The whole game, drawn into memory, comes out the same
+    *          every time from the same seed and keys
+    * input:   200 scripted frames from seed 3, twice, then seed 4
+    * output:  the first two last frames match, the third does not
+    *********************************************/
+   void replayInput_same()
+   {  // setup
+      InputLog log = scriptInput(200, 3, View(40.0, 700, 500));
+      // exercise
+      unsigned int checksumFirst = playHeadless(log);
+      unsigned int checksumSecond = playHeadless(log);
+      log.seed = 4;
+      unsigned int checksumOther = playHeadless(log);
+      // verify
+      assertUnit(checksumFirst == checksumSecond);
+      assertUnit(checksumFirst != checksumOther);
+      Interface().setInput(0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * FIXTURE
+    *****************************************************************
+    *****************************************************************/
+
+   // note how long up has been held, or -1 for space
+   static void callBack(const Interface* pUI, void* p)
+   {
+      std::vector<int>* pSeen = (std::vector<int>*)p;
+      pSeen->push_back(pUI->isSpace() ? -1 : pUI->isUp());
+   }
+
+   // note each frame's time
+   static void callBackDelta(const Interface* pUI, void* p)
+   {
+      std::vector<double>* pSeen = (std::vector<double>*)p;
+      pSeen->push_back(pUI->getFrameDelta());
+   }
+
+   // the game's callback, drawing into memory
+   struct Headless
+   {
+      Simulator* pSim;
+      ogstreamRaster* pgout;
+   };
+   static void callBackHeadless(const Interface* pUI, void* p)
+   {
+      Headless* pHeadless = (Headless*)p;
+      pHeadless->pSim->update(pUI);
+      pHeadless->pSim->gameplay(pUI);
+      pHeadless->pgout->clear();
+      pHeadless->pSim->display(*pHeadless->pgout);
+   }
+
+   // play the log through a new game and return the last frame's checksum
+   unsigned int playHeadless(const InputLog& log)
+   {
+      srand(log.seed);
+      Simulator sim(log.view);
+      ogstreamRaster gout(log.view);
+      Headless headless = { &sim, &gout };
+      replayInput(log, callBackHeadless, (void*)&headless);
+      return gout.checksum();
+   }
+};
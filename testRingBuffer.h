@@ -0,0 +1,175 @@
+/***********************************************************************
+ * Header File:
+ *    TEST RING BUFFER
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    All the unit tests for the fixed size ring buffer
+ ************************************************************************/
+
+#pragma once
+
+#include "ringBuffer.h"
+#include "unitTest.h"
+#include <iterator>   // for next()
+
+/*******************************
+ * TEST RING BUFFER
+ * A friend class for RingBuffer which contains its unit tests
+ ********************************/
+class TestRingBuffer : public UnitTest
+{
+public:
+   void run()
+   {
+      constructor_default();
+      pushBack_one();
+      pushBack_full();
+      pushBack_wrap();
+      popFront_one();
+      clear_full();
+      iterate_wrapped();
+
+      report("RingBuffer");
+   }
+
+private:
+
+   /*********************************************
+    * name:    CONSTRUCTOR default
+    * input:   nothing
+    * output:  empty, room for 3
+    *********************************************/
+   void constructor_default()
+   {  // setup
+      // exercise
+      RingBuffer<int, 3> buffer;
+      // verify
+      assertUnit(buffer.empty());
+      assertUnit(buffer.size() == 0);
+      assertUnit(buffer.capacity() == 3);
+      assertUnit(buffer.cbegin() == buffer.cend());
+   }  // teardown
+
+   /*********************************************
+    * name:    PUSH BACK one
+    * input:   {}  push 7
+    * output:  {7}
+    *********************************************/
+   void pushBack_one()
+   {  // setup
+      RingBuffer<int, 3> buffer;
+      // exercise
+      buffer.push_back(7);
+      // verify
+      assertUnit(!buffer.empty());
+      assertUnit(buffer.size() == 1);
+      assertUnit(buffer.front() == 7);
+      assertUnit(buffer.back() == 7);
+   }  // teardown
+
+   /*********************************************
+    * name:    PUSH BACK until full
+    * input:   {}  push 1, 2, 3
+    * output:  {1, 2, 3}
+    *********************************************/
+   void pushBack_full()
+   {  // setup
+      RingBuffer<int, 3> buffer;
+      // exercise
+      buffer.push_back(1);
+      buffer.push_back(2);
+      buffer.push_back(3);
+      // verify
+      assertUnit(buffer.size() == 3);
+      assertUnit(buffer.front() == 1);
+      assertUnit(buffer.back() == 3);
+      assertUnit(buffer.head == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    PUSH BACK past full
+    *          The oldest makes room for the newest
+    * input:   {1, 2, 3}  push 4, 5
+    * output:  {3, 4, 5}
+    *********************************************/
+   void pushBack_wrap()
+   {  // setup
+      RingBuffer<int, 3> buffer;
+      buffer.push_back(1);
+      buffer.push_back(2);
+      buffer.push_back(3);
+      // exercise
+      buffer.push_back(4);
+      buffer.push_back(5);
+      // verify
+      assertUnit(buffer.size() == 3);
+      assertUnit(buffer.front() == 3);
+      assertUnit(buffer.back() == 5);
+      assertUnit(buffer.head == 2);
+   }  // teardown
+
+   /*********************************************
+    * name:    POP FRONT one
+    * input:   {1, 2, 3}
+    * output:  {2, 3}
+    *********************************************/
+   void popFront_one()
+   {  // setup
+      RingBuffer<int, 3> buffer;
+      buffer.push_back(1);
+      buffer.push_back(2);
+      buffer.push_back(3);
+      // exercise
+      buffer.pop_front();
+      // verify
+      assertUnit(buffer.size() == 2);
+      assertUnit(buffer.front() == 2);
+      assertUnit(buffer.back() == 3);
+   }  // teardown
+
+   /*********************************************
+    * name:    CLEAR a full buffer
+    * input:   {3, 4, 5}
+    * output:  {}
+    *********************************************/
+   void clear_full()
+   {  // setup
+      RingBuffer<int, 3> buffer;
+      for (int i = 1; i <= 5; i++)
+         buffer.push_back(i);
+      // exercise
+      buffer.clear();
+      // verify
+      assertUnit(buffer.empty());
+      assertUnit(buffer.size() == 0);
+      assertUnit(buffer.cbegin() == buffer.cend());
+   }  // teardown
+
+   /*********************************************
+    * name:    ITERATE a buffer that has wrapped
+    * input:   {3, 4, 5} stored as {4, 5, 3}
+    * output:  3, 4, 5 forward and 5, 4, 3 back
+    *********************************************/
+   void iterate_wrapped()
+   {  // setup
+      RingBuffer<int, 3> buffer;
+      for (int i = 1; i <= 5; i++)
+         buffer.push_back(i);
+      int forward[3] = { 0, 0, 0 };
+      int backward[3] = { 0, 0, 0 };
+      int numForward = 0;
+      int numBackward = 0;
+      // exercise
+      for (auto it = buffer.cbegin(); it != buffer.cend(); ++it)
+         forward[numForward++] = *it;
+      for (auto it = buffer.crbegin(); it != buffer.crend(); ++it)
+         backward[numBackward++] = *it;
+      // verify
+      assertUnit(numForward == 3);
+      assertUnit(forward[0] == 3 && forward[1] == 4 && forward[2] == 5);
+      assertUnit(numBackward == 3);
+      assertUnit(backward[0] == 5 && backward[1] == 4 && backward[2] == 3);
+      assertUnit(*std::next(buffer.crbegin()) == 4);
+   }  // teardown
+};
@@ -0,0 +1,287 @@
+/***********************************************************************
+ * Header File:
+ *    TEST SALVO
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    All the unit tests for the pool of shells in the air
+ ************************************************************************/
+
+#pragma once
+
+#include "salvo.h"
+#include "ground.h"
+#include "howitzer.h"
+#include "view.h"
+#include "unitTest.h"
+
+/*******************************
+ * TEST SALVO
+ * A friend class for Salvo which contains its unit tests
+ ********************************/
+class TestSalvo : public UnitTest
+{
+public:
+   void run()
+   {
+      constructor_capacity();
+      fire_one();
+      fire_full();
+      advance_flying();
+      advance_landed();
+      advance_fromMuzzle();
+      advance_fromHowitzer();
+      advance_keepsOrder();
+      advance_pastTrail();
+      fire_reusedSlot();
+      reset_all();
+
+      report("Salvo");
+   }
+
+private:
+
+   /*********************************************
+    * name:    CONSTRUCTOR capacity
+    * input:   3
+    * output:  room for 3, none flying
+    *********************************************/
+   void constructor_capacity()
+   {  // setup
+      // exercise
+      Salvo salvo(3);
+      // verify
+      assertUnit(salvo.getCapacity() == 3);
+      assertUnit(salvo.getNumFlying() == 0);
+      assertUnit(!salvo.isFlying());
+      assertUnit(salvo.shells.size() == 3);
+   }  // teardown
+
+   /*********************************************
+    * name:    FIRE one
+    * input:   empty pool of 3, fire straight up at 100 m/s
+    * output:  one flying, at the muzzle
+    *********************************************/
+   void fire_one()
+   {  // setup
+      Salvo salvo(3);
+      // exercise
+      bool fired = salvo.fire(Position(100.0, 200.0), 0.0, Angle(0.0), 100.0);
+      // verify
+      assertUnit(fired);
+      assertUnit(salvo.getNumFlying() == 1);
+      assertEquals(salvo[0].getPosition().getMetersX(), 100.0);
+      assertEquals(salvo[0].getPosition().getMetersY(), 200.0);
+      assertEquals(salvo[0].getVelocity().getDY(), 100.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    FIRE when full
+    * input:   pool of 2 with 2 flying
+    * output:  not fired, still 2 flying
+    *********************************************/
+   void fire_full()
+   {  // setup
+      Salvo salvo(2);
+      salvo.fire(Position(0.0, 0.0), 0.0, Angle(0.0), 100.0);
+      salvo.fire(Position(0.0, 0.0), 0.0, Angle(0.0), 100.0);
+      // exercise
+      bool fired = salvo.fire(Position(0.0, 0.0), 0.0, Angle(0.0), 100.0);
+      // verify
+      assertUnit(!fired);
+      assertUnit(salvo.getNumFlying() == 2);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADVANCE a shell above the ground
+    * input:   one shell at 90km, t=0
+    * output:  still flying, t=1
+    *********************************************/
+   void advance_flying()
+   {  // setup
+      Ground ground(View(100.0, 100, 100));
+      setupGround(ground);
+      Salvo salvo(3);
+      salvo.fire(Position(5000.0, 90000.0), 0.0, Angle(90.0), 100.0);
+      // exercise
+      int numLanded = salvo.advance(1.0, ground);
+      // verify
+      assertUnit(numLanded == 0);
+      assertUnit(salvo.getNumFlying() == 1);
+      assertEquals(salvo[0].getCurrentTime(), 1.0);
+      assertEquals(salvo[0].getPosition().getMetersX(), 5100.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADVANCE a shell below the ground
+    * input:   one shell at -10m
+    * output:  landed, none flying
+    *********************************************/
+   void advance_landed()
+   {  // setup
+      Ground ground(View(100.0, 100, 100));
+      setupGround(ground);
+      Salvo salvo(3);
+      salvo.fire(Position(5000.0, -10.0), 0.0, Angle(90.0), 100.0);
+      // exercise
+      int numLanded = salvo.advance(1.0, ground);
+      // verify
+      assertUnit(numLanded == 1);
+      assertUnit(salvo.getNumFlying() == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADVANCE a shell from the muzzle
+    *          The gun sits right on the ground, so a shell just
+    *          fired is neither above it nor below it
+    * input:   one shell at the howitzer, 45 degrees at 827 m/s
+    * output:  still flying, t=1
+    *********************************************/
+   void advance_fromMuzzle()
+   {  // setup
+      Ground ground(View(100.0, 100, 100));
+      Position posHowitzer(5000.0, 0.0);
+      ground.reset(posHowitzer);
+      Salvo salvo(3);
+      salvo.fire(posHowitzer, 0.0, Angle(45.0), 827.0);
+      // exercise
+      int numLanded = salvo.advance(1.0, ground);
+      // verify
+      assertEquals(ground.getElevationMeters(posHowitzer), posHowitzer.getMetersY());
+      assertUnit(numLanded == 0);
+      assertUnit(salvo.getNumFlying() == 1);
+      assertEquals(salvo[0].getCurrentTime(), 1.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADVANCE a shell from the howitzer
+    *          Fired the way the game fires it, from wherever the
+    *          howitzer was put on the random ground
+    * input:   ten grounds, a shell from the howitzer on each
+    * output:  every shell survives its first step
+    *********************************************/
+   void advance_fromHowitzer()
+   {  // setup
+      View view(40.0, 700, 500);
+      int numFlying = 0;
+      srand(5);
+      // exercise
+      for (int i = 0; i < 10; i++)
+      {
+         Howitzer howitzer;
+         howitzer.generatePosition(view);
+         Ground ground(view);
+         ground.reset(howitzer.getPosition());
+         Salvo salvo(1);
+         salvo.fire(howitzer.getPosition(), 0.5, howitzer.getElevation(),
+                    howitzer.getMuzzleVelocity());
+         salvo.advance(1.0, ground);
+         numFlying += salvo.getNumFlying();
+      }
+      // verify
+      assertUnit(numFlying == 10);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADVANCE keeps the firing order
+    * input:   at 90km, under ground, at 95km, under ground
+    * output:  the 90km and the 95km shells, in that order
+    *********************************************/
+   void advance_keepsOrder()
+   {  // setup
+      Ground ground(View(100.0, 100, 100));
+      setupGround(ground);
+      Salvo salvo(4);
+      salvo.fire(Position(5000.0, 90000.0), 0.0, Angle(90.0), 100.0);
+      salvo.fire(Position(5000.0,   -10.0), 0.0, Angle(90.0), 100.0);
+      salvo.fire(Position(6000.0, 95000.0), 0.0, Angle(90.0), 100.0);
+      salvo.fire(Position(6000.0,   -10.0), 0.0, Angle(90.0), 100.0);
+      // exercise
+      int numLanded = salvo.advance(1.0, ground);
+      // verify
+      assertUnit(numLanded == 2);
+      assertUnit(salvo.getNumFlying() == 2);
+      assertEquals(salvo[0].getPosition().getMetersX(), 5100.0);
+      assertEquals(salvo[1].getPosition().getMetersX(), 6100.0);
+      assertEquals(salvo.getNewest().getPosition().getMetersX(), 6100.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADVANCE longer than the trail remembers
+    *          The HUD's distance and time are from the muzzle, not
+    *          from the oldest step still in the shell's trail
+    * input:   one shell right at 100 m/s from (5000,90000), where
+    *          there is no air, 20 steps of 1s
+    * output:  flying for 20s, 2000m
+    *********************************************/
+   void advance_pastTrail()
+   {  // setup
+      Ground ground(View(100.0, 100, 100));
+      setupGround(ground);
+      Salvo salvo(1);
+      salvo.fire(Position(5000.0, 90000.0), 0.0, Angle(90.0), 100.0);
+      // exercise
+      for (int i = 0; i < 20; i++)
+         salvo.advance(1.0, ground);
+      // verify
+      assertUnit(20 > FLIGHT_PATH_LENGTH);
+      assertEquals(salvo[0].getFlightTime(), 20.0);
+      assertEquals(salvo[0].getFlightDistance(), 2000.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    FIRE from a slot a landed shell used
+    *          The new shell must not measure from where the old
+    *          one was fired
+    * input:   a pool of 1, a shell flown 20s from (5000,90000), then
+    *          another fired from (6000,90000) at 30s and stepped once
+    * output:  flying for 1s, 100m
+    *********************************************/
+   void fire_reusedSlot()
+   {  // setup
+      Ground ground(View(100.0, 100, 100));
+      setupGround(ground);
+      Salvo salvo(1);
+      salvo.fire(Position(5000.0, 90000.0), 0.0, Angle(90.0), 100.0);
+      for (int i = 0; i < 20; i++)
+         salvo.advance(1.0, ground);
+      salvo.reset();
+      // exercise
+      salvo.fire(Position(6000.0, 90000.0), 30.0, Angle(90.0), 100.0);
+      salvo.advance(1.0, ground);
+      // verify
+      assertEquals(salvo[0].getFlightTime(), 1.0);
+      assertEquals(salvo[0].getFlightDistance(), 100.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    RESET every shell
+    * input:   two flying
+    * output:  none flying, room for them again
+    *********************************************/
+   void reset_all()
+   {  // setup
+      Salvo salvo(2);
+      salvo.fire(Position(0.0, 0.0), 0.0, Angle(0.0), 100.0);
+      salvo.fire(Position(0.0, 0.0), 0.0, Angle(0.0), 100.0);
+      // exercise
+      salvo.reset();
+      // verify
+      assertUnit(salvo.getNumFlying() == 0);
+      assertUnit(salvo.fire(Position(0.0, 0.0), 0.0, Angle(0.0), 100.0));
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * FIXTURE
+    *****************************************************************
+    *****************************************************************/
+
+   // a 10km x 10km field with the howitzer in the middle. The ground
+   // itself is random, but never under 0m or over 10km
+   void setupGround(Ground& ground)
+   {
+      Position posHowitzer(5000.0, 0.0);
+      ground.reset(posHowitzer);
+   }
+};
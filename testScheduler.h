@@ -0,0 +1,241 @@
+/***********************************************************************
+ * Header File:
+ *    TEST SCHEDULER
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    All the unit tests for the time-on-target scheduler
+ ************************************************************************/
+
+#pragma once
+
+#include "scheduler.h"
+#include "unitTest.h"
+#include <cmath>       // for fabs()
+#include <algorithm>   // for min() and max()
+
+/*******************************
+ * TEST SCHEDULER
+ * The unit tests for scheduleTimeOnTarget()
+ ********************************/
+class TestScheduler : public UnitTest
+{
+public:
+   void run()
+   {
+      schedule_noCache();
+      schedule_fromTable();
+      schedule_tightWindow();
+      schedule_someCached();
+      schedule_outOfReach();
+      schedule_heights();
+
+      report("Scheduler");
+   }
+
+private:
+
+   /*********************************************
+    * name:    SCHEDULE with no cache
+    * input:   three guns 14km to 16km from the target, no cache
+    * output:  every gun solved, the same plan Battery::aim() makes
+    *********************************************/
+   void schedule_noCache()
+   {  // setup
+      Battery battery;
+      setupBattery(battery);
+      ShotSpec spec;
+      ScheduleStats stats;
+      // exercise
+      Volley volley = scheduleTimeOnTarget(battery, posTarget(), spec,
+                                           TOT_WINDOW, false, nullptr, 0, &stats);
+      // verify
+      assertUnit(stats.numSolved == 3);
+      assertUnit(stats.numFromTable == 0);
+      Volley aimed = battery.aim(posTarget(), spec);
+      assertUnit(volley.numValid == 3);
+      assertUnit(volley.impactTime == aimed.impactTime);
+      for (int i = 0; i < 3; i++)
+         assertUnit(volley.orders[i].solution.elevation == aimed.orders[i].solution.elevation);
+   }  // teardown
+
+   /*********************************************
+    * name:    SCHEDULE from the table
+    * input:   the same three guns, every table cached, a 0.5s window
+    * output:  nothing solved. Flying each gun's elevation after its
+    *          delay puts every shell on the target inside the window
+    *********************************************/
+   void schedule_fromTable()
+   {  // setup
+      Battery battery;
+      setupBattery(battery);
+      ShotSpec spec;
+      FiringTableCache cache;
+      warmCache(cache, battery, spec);
+      ScheduleStats stats;
+      // exercise
+      Volley volley = scheduleTimeOnTarget(battery, posTarget(), spec,
+                                           0.5, false, &cache, 0, &stats);
+      // verify
+      assertUnit(stats.numFromTable == 3);
+      assertUnit(stats.numSolved == 0);
+      assertUnit(volley.numValid == 3);
+      double earliest = 1e9;
+      double latest = 0.0;
+      for (int i = 0; i < 3; i++)
+      {
+         ShotSpec shot = spec;
+         shot.muzzleVelocity = battery[i].getMuzzleVelocity();
+         shot.elevation = volley.orders[i].solution.elevation;
+         Trajectory trajectory = computeTrajectory(shot);
+         double impactX = battery[i].getPosition().getMetersX() + trajectory.impactX;
+         double impactTime = volley.orders[i].fireDelay + trajectory.impactTime;
+         assertUnit(fabs(impactX - posTarget().getMetersX()) <= 2.0 * SOLVER_TOLERANCE);
+         earliest = std::min(earliest, impactTime);
+         latest = std::max(latest, impactTime);
+      }
+      assertUnit(latest - earliest <= 0.5);
+   }  // teardown
+
+   /*********************************************
+    * name:    SCHEDULE with a tight window
+    * input:   every table cached, but no room at all in the window
+    * output:  the table is never good enough, so every gun is solved
+    *********************************************/
+   void schedule_tightWindow()
+   {  // setup
+      Battery battery;
+      setupBattery(battery);
+      ShotSpec spec;
+      FiringTableCache cache;
+      warmCache(cache, battery, spec);
+      ScheduleStats stats;
+      // exercise
+      Volley volley = scheduleTimeOnTarget(battery, posTarget(), spec,
+                                           0.0, false, &cache, 0, &stats);
+      // verify
+      assertUnit(stats.numFromTable == 0);
+      assertUnit(stats.numSolved == 3);
+      assertUnit(volley.numValid == 3);
+   }  // teardown
+
+   /*********************************************
+    * name:    SCHEDULE with some guns cached
+    * input:   only the first gun's table is cached
+    * output:  one read from the table, two solved
+    *********************************************/
+   void schedule_someCached()
+   {  // setup
+      Battery battery;
+      setupBattery(battery);
+      ShotSpec spec;
+      spec.muzzleVelocity = battery[0].getMuzzleVelocity();
+      FiringTableCache cache;
+      cache.get(spec);
+      ScheduleStats stats;
+      // exercise
+      Volley volley = scheduleTimeOnTarget(battery, posTarget(), spec,
+                                           TOT_WINDOW, false, &cache, 0, &stats);
+      // verify
+      assertUnit(stats.numFromTable == 1);
+      assertUnit(stats.numSolved == 2);
+      assertUnit(volley.numValid == 3);
+      assertUnit(volley.orders[0].solution.numEvaluations == 0);
+      assertUnit(volley.orders[1].solution.numEvaluations > 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    SCHEDULE out of reach
+    * input:   every table cached, a target 60km away
+    * output:  the table says no for every gun without solving any
+    *********************************************/
+   void schedule_outOfReach()
+   {  // setup
+      Battery battery;
+      setupBattery(battery);
+      ShotSpec spec;
+      FiringTableCache cache;
+      warmCache(cache, battery, spec);
+      ScheduleStats stats;
+      // exercise
+      Volley volley = scheduleTimeOnTarget(battery, Position(60000.0, 0.0), spec,
+                                           TOT_WINDOW, false, &cache, 0, &stats);
+      // verify
+      assertUnit(stats.numFromTable == 3);
+      assertUnit(stats.numSolved == 0);
+      assertUnit(volley.numValid == 0);
+      assertEquals(volley.impactTime, 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    SCHEDULE on different heights
+    * input:   the three guns at 0m, 300m and 800m, every table cached,
+    *          a target at 500m
+    * output:  every gun read from its table. Flying each one to the
+    *          target's height above it lands on the target inside the
+    *          window
+    *********************************************/
+   void schedule_heights()
+   {  // setup
+      Battery battery;
+      battery.add(Position(0.0, 0.0), 827.0);
+      battery.add(Position(1000.0, 300.0), 810.0);
+      battery.add(Position(2000.0, 800.0), 790.0);
+      Position posTarget(16000.0, 500.0);
+      ShotSpec spec;
+      FiringTableCache cache;
+      warmCache(cache, battery, spec);
+      ScheduleStats stats;
+      // exercise
+      Volley volley = scheduleTimeOnTarget(battery, posTarget, spec,
+                                           0.5, false, &cache, 0, &stats);
+      // verify
+      assertUnit(stats.numFromTable == 3);
+      assertUnit(volley.numValid == 3);
+      double earliest = 1e9;
+      double latest = 0.0;
+      for (int i = 0; i < 3; i++)
+      {
+         ShotSpec shot = spec;
+         shot.muzzleVelocity = battery[i].getMuzzleVelocity();
+         shot.elevation = volley.orders[i].solution.elevation;
+         shot.impactHeight = posTarget.getMetersY() - battery[i].getPosition().getMetersY();
+         Trajectory trajectory = computeTrajectory(shot);
+         double impactX = battery[i].getPosition().getMetersX() + trajectory.impactX;
+         double impactTime = volley.orders[i].fireDelay + trajectory.impactTime;
+         assertUnit(trajectory.fReached);
+         assertUnit(fabs(impactX - posTarget.getMetersX()) <= 2.0 * SOLVER_TOLERANCE);
+         earliest = std::min(earliest, impactTime);
+         latest = std::max(latest, impactTime);
+      }
+      assertUnit(latest - earliest <= 0.5);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * FIXTURE
+    *****************************************************************
+    *****************************************************************/
+
+   // three guns with different muzzle velocities, 14km to 16km short
+   // of the target
+   void setupBattery(Battery& battery)
+   {
+      battery.add(Position(0.0, 0.0), 827.0);
+      battery.add(Position(1000.0, 0.0), 810.0);
+      battery.add(Position(2000.0, 0.0), 790.0);
+   }
+
+   Position posTarget() const { return Position(16000.0, 0.0); }
+
+   // a table for every gun in the battery
+   void warmCache(FiringTableCache& cache, const Battery& battery, const ShotSpec& spec)
+   {
+      for (int i = 0; i < battery.size(); i++)
+      {
+         ShotSpec shot = spec;
+         shot.muzzleVelocity = battery[i].getMuzzleVelocity();
+         cache.get(shot);
+      }
+   }
+};
@@ -0,0 +1,313 @@
+/***********************************************************************
+ * Header File:
+ *    TEST SERVER
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    All the unit tests for the firing server
+ ************************************************************************/
+
+#pragma once
+
+#include "server.h"
+#include "profile.h"
+#include "unitTest.h"
+#include <sstream>     // for istringstream
+#include <string>
+#include <limits>      // for quiet_NaN()
+
+/*******************************
+ * TEST SERVER
+ * The unit tests for the messages and the answers. The socket
+ * itself lives in serverMain.cpp
+ ********************************/
+class TestServer : public UnitTest
+{
+public:
+   void run()
+   {
+      // messages
+      encode_request();
+      encode_response();
+
+      // answers
+      answer_solve();
+      answer_solveWarm();
+      answer_outOfReach();
+      answer_simulate();
+      answer_bad();
+      answer_stats();
+      answer_group();
+
+      report("Server");
+   }
+
+private:
+
+   /*****************************************************************
+    *****************************************************************
+    * MESSAGES
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    ENCODE REQUEST
+    * input:   a solve for 12345.5m at 600m/s, high angle, id 258
+    * output:  little-endian bytes that decode to the same request
+    *********************************************/
+   void encode_request()
+   {  // setup
+      ServerRequest request;
+      request.type = SERVER_SOLVE;
+      request.id = 258;
+      request.a = 12345.5;
+      request.b = 600.0;
+      request.flags = SERVER_FLAG_HIGH;
+      unsigned char bytes[SERVER_REQUEST_SIZE];
+      ServerRequest decoded;
+      // exercise
+      encodeRequest(request, bytes);
+      decodeRequest(bytes, decoded);
+      // verify
+      assertUnit(bytes[0] == SERVER_SOLVE);
+      assertUnit(bytes[4] == 2 && bytes[5] == 1);
+      assertUnit(decoded.type == SERVER_SOLVE);
+      assertUnit(decoded.id == 258);
+      assertUnit(decoded.a == 12345.5);
+      assertUnit(decoded.b == 600.0);
+      assertUnit(decoded.flags == SERVER_FLAG_HIGH);
+   }  // teardown
+
+   /*********************************************
+    * name:    ENCODE RESPONSE
+    * input:   id 7, out of reach, values 1 -2 3.25 1e6
+    * output:  decodes to the same response
+    *********************************************/
+   void encode_response()
+   {  // setup
+      ServerResponse response;
+      response.id = 7;
+      response.status = SERVER_OUT_OF_REACH;
+      response.values[0] = 1.0;
+      response.values[1] = -2.0;
+      response.values[2] = 3.25;
+      response.values[3] = 1e6;
+      unsigned char bytes[SERVER_RESPONSE_SIZE];
+      ServerResponse decoded;
+      // exercise
+      encodeResponse(response, bytes);
+      decodeResponse(bytes, decoded);
+      // verify
+      assertUnit(decoded.id == 7);
+      assertUnit(decoded.status == SERVER_OUT_OF_REACH);
+      assertUnit(decoded.values[0] == 1.0);
+      assertUnit(decoded.values[1] == -2.0);
+      assertUnit(decoded.values[2] == 3.25);
+      assertUnit(decoded.values[3] == 1e6);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * ANSWERS
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    ANSWER SOLVE
+    *          The ground there is about 1km below the gun
+    * input:   a target 10km down range at the scenario's velocity,
+    *          high angle
+    * output:  lands within the solver's tolerance on the lob. Flying
+    *          that elevation over the ground lands on the target.
+    *          No table is built
+    *********************************************/
+   void answer_solve()
+   {  // setup
+      FiringServer server(getScenario());
+      double targetX = server.posHowitzer.getMetersX() + 10000.0;
+      ServerRequest request = getRequest(SERVER_SOLVE, 1, targetX);
+      request.flags = SERVER_FLAG_HIGH;
+      // exercise
+      ServerResponse response = server.answer(request);
+      // verify
+      assertUnit(server.isReady());
+      assertUnit(response.id == 1);
+      assertUnit(response.status == SERVER_OK);
+      assertUnit(response.values[0] > 0.0 && response.values[0] < 45.0);
+      assertUnit(response.values[1] > 0.0);
+      assertUnit(fabs(response.values[2] - targetX) <= SOLVER_TOLERANCE);
+      ServerResponse flown = server.answer(getRequest(SERVER_SIMULATE, 2, response.values[0]));
+      assertUnit(fabs(flown.values[0] - targetX) <= 10.0);
+      assertUnit(server.cache.size() == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ANSWER SOLVE WARM
+    * input:   the same target after warm(), then again at 700m/s
+    * output:  the same elevation as the solver gives to within a
+    *          hundredth of a degree. The other velocity is solved
+    *          without building a second table
+    *********************************************/
+   void answer_solveWarm()
+   {  // setup
+      FiringServer server(getScenario());
+      double targetX = server.posHowitzer.getMetersX() + 10000.0;
+      ServerRequest request = getRequest(SERVER_SOLVE, 1, targetX);
+      request.flags = SERVER_FLAG_HIGH;
+      ServerResponse cold = server.answer(request);
+      ServerRequest other = request;
+      other.b = 700.0;
+      server.warm();
+      // exercise
+      ServerResponse warm = server.answer(request);
+      ServerResponse otherResponse = server.answer(other);
+      // verify
+      assertUnit(server.cache.size() == 1);
+      assertUnit(warm.status == SERVER_OK);
+      assertUnit(fabs(warm.values[0] - cold.values[0]) < 0.01);
+      assertUnit(fabs(warm.values[2] - targetX) <= SOLVER_TOLERANCE);
+      assertUnit(otherResponse.status == SERVER_OK);
+      assertUnit(fabs(otherResponse.values[2] - targetX) <= SOLVER_TOLERANCE);
+   }  // teardown
+
+   /*********************************************
+    * name:    ANSWER OUT OF REACH
+    * input:   a target 1000km down range
+    * output:  out of reach
+    *********************************************/
+   void answer_outOfReach()
+   {  // setup
+      FiringServer server(getScenario());
+      ServerRequest request = getRequest(SERVER_SOLVE, 2,
+                                         server.posHowitzer.getMetersX() + 1e6);
+      // exercise
+      ServerResponse response = server.answer(request);
+      // verify
+      assertUnit(response.id == 2);
+      assertUnit(response.status == SERVER_OUT_OF_REACH);
+   }  // teardown
+
+   /*********************************************
+    * name:    ANSWER SIMULATE
+    * input:   60 degrees at 500m/s over the scenario's ground
+    * output:  exactly what flyOverGround() gives
+    *********************************************/
+   void answer_simulate()
+   {  // setup
+      FiringServer server(getScenario());
+      ServerRequest request = getRequest(SERVER_SIMULATE, 3, 60.0);
+      request.b = 500.0;
+      ShotSpec spec = server.spec;
+      spec.elevation = 60.0;
+      spec.muzzleVelocity = 500.0;
+      BatchResult expected = flyOverGround(spec, server.posHowitzer, server.ground);
+      // exercise
+      ServerResponse response = server.answer(request);
+      // verify
+      assertUnit(response.status == SERVER_OK);
+      assertUnit(response.values[0] == expected.impactX);
+      assertUnit(response.values[1] == expected.impactY);
+      assertUnit(response.values[2] == expected.impactTime);
+      assertUnit(response.values[3] == expected.maxAltitude);
+   }  // teardown
+
+   /*********************************************
+    * name:    ANSWER BAD
+    * input:   an unknown type, a NaN target, a negative velocity
+    * output:  all three are bad requests
+    *********************************************/
+   void answer_bad()
+   {  // setup
+      FiringServer server(getScenario());
+      ServerRequest unknown = getRequest(99, 4, 0.0);
+      ServerRequest notANumber = getRequest(SERVER_SOLVE, 5,
+                                            std::numeric_limits<double>::quiet_NaN());
+      ServerRequest backwards = getRequest(SERVER_SIMULATE, 6, 45.0);
+      backwards.b = -100.0;
+      // exercise
+      ServerResponse responseUnknown = server.answer(unknown);
+      ServerResponse responseNaN = server.answer(notANumber);
+      ServerResponse responseBackwards = server.answer(backwards);
+      // verify
+      assertUnit(responseUnknown.status == SERVER_BAD_REQUEST);
+      assertUnit(responseNaN.status == SERVER_BAD_REQUEST);
+      assertUnit(responseBackwards.status == SERVER_BAD_REQUEST);
+      assertUnit(responseBackwards.id == 6);
+   }  // teardown
+
+   /*********************************************
+    * name:    ANSWER STATS
+    * input:   three requests recorded at 10us, 20us and 30us
+    * output:  a count of 3 and a p50 of about 20us
+    *********************************************/
+   void answer_stats()
+   {  // setup
+      FiringServer server(getScenario());
+      profileReset();
+      std::chrono::steady_clock::time_point begin;
+      profileRecord(PROFILE_SERVER_REQUEST, begin, begin + std::chrono::microseconds(10));
+      profileRecord(PROFILE_SERVER_REQUEST, begin, begin + std::chrono::microseconds(20));
+      profileRecord(PROFILE_SERVER_REQUEST, begin, begin + std::chrono::microseconds(30));
+      // exercise
+      ServerResponse response = server.answer(getRequest(SERVER_STATS, 7, 0.0));
+      // verify
+      assertUnit(response.status == SERVER_OK);
+      assertEquals(response.values[0], 3.0);
+      assertUnit(response.values[1] >= 15.0 && response.values[1] <= 25.0);
+      assertUnit(response.values[3] >= response.values[1]);
+      profileReset();
+   }  // teardown
+
+   /*********************************************
+    * name:    ANSWER GROUP
+    *          Answers come back in the order the requests went in,
+    *          whichever thread answered them
+    * input:   a group of SERVER_GROUP simulations on 4 threads
+    * output:  the same answers as one at a time, in order
+    *********************************************/
+   void answer_group()
+   {  // setup
+      FiringServer server(getScenario());
+      std::vector<ServerRequest> requests;
+      for (int i = 0; i < SERVER_GROUP; i++)
+         requests.push_back(getRequest(SERVER_SIMULATE, 100 + i, 10.0 + 5.0 * i));
+      std::vector<ServerResponse> responses;
+      // exercise
+      server.answer(requests, responses, 4);
+      // verify
+      assertUnit(responses.size() == SERVER_GROUP);
+      for (int i = 0; i < SERVER_GROUP; i++)
+      {
+         ServerResponse expected = server.answer(requests[i]);
+         assertUnit(responses[i].id == (uint32_t)(100 + i));
+         assertUnit(responses[i].values[0] == expected.values[0]);
+         assertUnit(responses[i].values[2] == expected.values[2]);
+      }
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * FIXTURE
+    *****************************************************************
+    *****************************************************************/
+
+   // the default field with random ground from seed 1, without drag so
+   // the firing table builds quickly
+   Scenario getScenario()
+   {
+      std::istringstream in("drag off\n");
+      Scenario scenario;
+      std::string error;
+      readScenario(in, scenario, error);
+      return scenario;
+   }
+
+   ServerRequest getRequest(uint32_t type, uint32_t id, double a)
+   {
+      ServerRequest request;
+      request.type = type;
+      request.id = id;
+      request.a = a;
+      return request;
+   }
+};
@@ -0,0 +1,192 @@
+/***********************************************************************
+ * Header File:
+ *    TEST SOLVER
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    All the unit tests for the firing solver
+ ************************************************************************/
+
+#pragma once
+
+#include "solver.h"
+#include "unitTest.h"
+#include <cmath>     // for fabs()
+
+/*******************************
+ * TEST SOLVER
+ * The unit tests for solveElevation()
+ ********************************/
+class TestSolver : public UnitTest
+{
+public:
+   void run()
+   {
+      // no drag: the first guess is the answer
+      solve_vacuumRight();
+      solve_vacuumLeft();
+      solve_outOfReach();
+
+      // with drag: refine the first guess
+      solve_dragFlat();
+      solve_dragHigh();
+
+      // a target above or below the gun
+      solve_dragAbove();
+      solve_dragBelow();
+      solve_onTheWayUp();
+
+      report("Solver");
+   }
+
+private:
+
+   /*********************************************
+    * name:    SOLVE in a vacuum, to the right
+    * input:   10000m, 827m/s, no drag
+    * output:  lands within 1m after one trajectory
+    *********************************************/
+   void solve_vacuumRight()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      spec.fDrag = false;
+      // exercise
+      FiringSolution solution = solveElevation(10000.0, 0.0, spec);
+      // verify
+      assertUnit(solution.fValid);
+      assertUnit(solution.numEvaluations == 1);
+      assertUnit(fabs(solution.impactX - 10000.0) <= 1.0);
+      assertUnit(solution.elevation > 45.0 && solution.elevation < 90.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    SOLVE in a vacuum, to the left
+    * input:   -10000m, 827m/s, no drag
+    * output:  a negative elevation that lands within 1m
+    *********************************************/
+   void solve_vacuumLeft()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      spec.fDrag = false;
+      // exercise
+      FiringSolution solution = solveElevation(-10000.0, 0.0, spec);
+      // verify
+      assertUnit(solution.fValid);
+      assertUnit(fabs(solution.impactX + 10000.0) <= 1.0);
+      assertUnit(solution.elevation < -45.0 && solution.elevation > -90.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    SOLVE beyond the vacuum range
+    * input:   100000m, 827m/s (vacuum range is about 69.7km)
+    * output:  not valid, no trajectories flown
+    *********************************************/
+   void solve_outOfReach()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      // exercise
+      FiringSolution solution = solveElevation(100000.0, 0.0, spec);
+      // verify
+      assertUnit(!solution.fValid);
+      assertUnit(solution.numEvaluations == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    SOLVE with drag, the flat shot
+    * input:   15000m, 827m/s, 1s steps
+    * output:  lands within 1m in a handful of trajectories
+    *********************************************/
+   void solve_dragFlat()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      // exercise
+      FiringSolution solution = solveElevation(15000.0, 0.0, spec);
+      // verify
+      assertUnit(solution.fValid);
+      assertUnit(fabs(solution.impactX - 15000.0) <= 1.0);
+      assertUnit(solution.elevation > 45.0);
+      assertUnit(solution.numEvaluations <= 8);
+   }  // teardown
+
+   /*********************************************
+    * name:    SOLVE with drag, the lob
+    * input:   15000m, 827m/s, 1s steps, high angle
+    * output:  lands within 1m, steeper than 45 degrees
+    *********************************************/
+   void solve_dragHigh()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      // exercise
+      FiringSolution solution = solveElevation(15000.0, 0.0, spec, true /*fHighAngle*/);
+      // verify
+      assertUnit(solution.fValid);
+      assertUnit(fabs(solution.impactX - 15000.0) <= 1.0);
+      assertUnit(solution.elevation < 45.0);
+      assertUnit(solution.numEvaluations <= 8);
+      assertUnit(solution.timeOfFlight > 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    SOLVE with drag, above the gun
+    * input:   15000m out and 1000m up, 827m/s, high angle
+    * output:  a shell flown at that elevation comes down through
+    *          1000m within 1m of the target
+    *********************************************/
+   void solve_dragAbove()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      // exercise
+      FiringSolution solution = solveElevation(15000.0, 1000.0, spec, true /*fHighAngle*/);
+      // verify
+      assertUnit(solution.fValid);
+      assertUnit(solution.elevation < 45.0);
+      spec.elevation = solution.elevation;
+      spec.impactHeight = 1000.0;
+      Trajectory trajectory = computeTrajectory(spec);
+      assertUnit(trajectory.fReached);
+      assertUnit(fabs(trajectory.impactX - 15000.0) <= 1.0);
+      assertEquals(trajectory.impactTime, solution.timeOfFlight);
+   }  // teardown
+
+   /*********************************************
+    * name:    SOLVE with drag, below the gun
+    * input:   15000m out and 1000m down, 827m/s
+    * output:  lands within 1m of the target, on a flatter shot than
+    *          the same distance on level ground
+    *********************************************/
+   void solve_dragBelow()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      FiringSolution level = solveElevation(15000.0, 0.0, spec);
+      // exercise
+      FiringSolution solution = solveElevation(15000.0, -1000.0, spec);
+      // verify
+      assertUnit(solution.fValid);
+      assertUnit(solution.elevation > level.elevation);
+      spec.elevation = solution.elevation;
+      spec.impactHeight = -1000.0;
+      Trajectory trajectory = computeTrajectory(spec);
+      assertUnit(fabs(trajectory.impactX - 15000.0) <= 1.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    SOLVE a target only the way up passes
+    *          The flat vacuum path to (10000,1000) goes through it
+    *          before the top, and a shell has to come down on its
+    *          target
+    * input:   10000m out and 1000m up, 827m/s, no drag, flat and high
+    * output:  no flat shot; the lob lands within 1m
+    *********************************************/
+   void solve_onTheWayUp()
+   {  // setup
+      ShotSpec spec(0.0, 827.0);
+      spec.fDrag = false;
+      // exercise
+      FiringSolution flat = solveElevation(10000.0, 1000.0, spec);
+      FiringSolution high = solveElevation(10000.0, 1000.0, spec, true /*fHighAngle*/);
+      // verify
+      assertUnit(!flat.fValid);
+      assertUnit(high.fValid);
+      assertUnit(fabs(high.impactX - 10000.0) <= 1.0);
+   }  // teardown
+};
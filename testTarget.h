@@ -0,0 +1,152 @@
+/***********************************************************************
+ * Header File:
+ *    TEST TARGET
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    All the unit tests for hitting the target
+ ************************************************************************/
+
+#pragma once
+
+#include "target.h"
+#include "unitTest.h"
+
+/*******************************
+ * TEST TARGET
+ * The unit tests for the closest approach of a shell to the target
+ ********************************/
+class TestTarget : public UnitTest
+{
+public:
+   void run()
+   {
+      closestApproach_middle();
+      closestApproach_before();
+      closestApproach_after();
+      closestApproach_stopped();
+      closestApproach_throughTarget();
+      isHit_radius();
+
+      report("Target");
+   }
+
+private:
+
+   /*********************************************
+    * name:    CLOSEST APPROACH middle
+    * input:   (0,0) at 10s to (1000,0) at 11s, target at (250,300)
+    * output:  (250,0) at 10.25s, 300m off
+    *********************************************/
+   void closestApproach_middle()
+   {  // setup
+      Position posBegin(0.0, 0.0);
+      Position posEnd(1000.0, 0.0);
+      Position posTarget(250.0, 300.0);
+      // exercise
+      ClosestApproach approach = closestApproach(posBegin, 10.0, posEnd, 11.0, posTarget);
+      // verify
+      assertEquals(approach.time, 10.25);
+      assertEquals(approach.pos.getMetersX(), 250.0);
+      assertEquals(approach.pos.getMetersY(), 0.0);
+      assertEquals(approach.distance, 300.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    CLOSEST APPROACH before
+    *          The target is behind where the step began
+    * input:   (0,0) at 10s to (1000,0) at 11s, target at (-300,400)
+    * output:  (0,0) at 10s, 500m off
+    *********************************************/
+   void closestApproach_before()
+   {  // setup
+      Position posBegin(0.0, 0.0);
+      Position posEnd(1000.0, 0.0);
+      Position posTarget(-300.0, 400.0);
+      // exercise
+      ClosestApproach approach = closestApproach(posBegin, 10.0, posEnd, 11.0, posTarget);
+      // verify
+      assertEquals(approach.time, 10.0);
+      assertEquals(approach.pos.getMetersX(), 0.0);
+      assertEquals(approach.distance, 500.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    CLOSEST APPROACH after
+    *          The target is past where the step ended
+    * input:   (0,0) at 10s to (1000,1000) at 11s, target at (1300,1400)
+    * output:  (1000,1000) at 11s, 500m off
+    *********************************************/
+   void closestApproach_after()
+   {  // setup
+      Position posBegin(0.0, 0.0);
+      Position posEnd(1000.0, 1000.0);
+      Position posTarget(1300.0, 1400.0);
+      // exercise
+      ClosestApproach approach = closestApproach(posBegin, 10.0, posEnd, 11.0, posTarget);
+      // verify
+      assertEquals(approach.time, 11.0);
+      assertEquals(approach.pos.getMetersX(), 1000.0);
+      assertEquals(approach.pos.getMetersY(), 1000.0);
+      assertEquals(approach.distance, 500.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    CLOSEST APPROACH stopped
+    *          A shell that did not move
+    * input:   (100,100) at 5s to (100,100) at 5s, target at (130,140)
+    * output:  (100,100) at 5s, 50m off
+    *********************************************/
+   void closestApproach_stopped()
+   {  // setup
+      Position pos(100.0, 100.0);
+      Position posTarget(130.0, 140.0);
+      // exercise
+      ClosestApproach approach = closestApproach(pos, 5.0, pos, 5.0, posTarget);
+      // verify
+      assertEquals(approach.time, 5.0);
+      assertEquals(approach.pos.getMetersX(), 100.0);
+      assertEquals(approach.distance, 50.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    CLOSEST APPROACH through the target
+    *          A fast shell that is well clear of the target at both
+    *          ends of the step, but flew right through it in between
+    * input:   (0,2000) to (4000,0) over 1s, target at (2000,1000)
+    * output:  0m off at 0.5s, a hit
+    *********************************************/
+   void closestApproach_throughTarget()
+   {  // setup
+      Position posBegin(0.0, 2000.0);
+      Position posEnd(4000.0, 0.0);
+      Position posTarget(2000.0, 1000.0);
+      // exercise
+      ClosestApproach approach = closestApproach(posBegin, 0.0, posEnd, 1.0, posTarget);
+      // verify
+      assertEquals(approach.time, 0.5);
+      assertEquals(approach.distance, 0.0);
+      assertUnit(isHit(approach));
+   }  // teardown
+
+   /*********************************************
+    * name:    IS HIT radius
+    * input:   just inside, on, and just outside the radius
+    * output:  hit, hit, miss
+    *********************************************/
+   void isHit_radius()
+   {  // setup
+      ClosestApproach inside;
+      ClosestApproach edge;
+      ClosestApproach outside;
+      inside.distance = TARGET_RADIUS - 1.0;
+      edge.distance = TARGET_RADIUS;
+      outside.distance = TARGET_RADIUS + 1.0;
+      // exercise
+      // verify
+      assertUnit(isHit(inside));
+      assertUnit(isHit(edge));
+      assertUnit(!isHit(outside));
+      assertUnit(isHit(outside, TARGET_RADIUS + 2.0));
+   }  // teardown
+};
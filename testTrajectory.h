@@ -0,0 +1,249 @@
+/***********************************************************************
+ * Header File:
+ *    TEST TRAJECTORY
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    All the unit tests for the headless trajectory engine
+ ************************************************************************/
+
+#pragma once
+
+#include "trajectory.h"
+#include "unitTest.h"
+#include <cmath>     // for nextafter() and fabs()
+
+/*******************************
+ * TEST TRAJECTORY
+ * The unit tests for computeTrajectory() and ulpDistance()
+ ********************************/
+class TestTrajectory : public UnitTest
+{
+public:
+   void run()
+   {
+      computeTrajectory_dropped();
+      computeTrajectory_straightUp();
+      computeTrajectory_samples();
+      computeTrajectory_cubic();
+      computeTrajectory_height();
+      computeTrajectory_heightVacuum();
+      computeTrajectory_tooHigh();
+
+      ulpDistance_same();
+      ulpDistance_neighbor();
+      ulpDistance_signedZero();
+      ulpDistance_acrossZero();
+
+      report("Trajectory");
+   }
+
+private:
+
+   /*****************************************************************
+    *****************************************************************
+    * COMPUTE TRAJECTORY
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    COMPUTE TRAJECTORY dropped at the muzzle
+    * input:   horizontal, 0m/s
+    * output:  lands where it started after one step
+    *********************************************/
+   void computeTrajectory_dropped()
+   {  // setup
+      ShotSpec spec(90.0, 0.0);
+      // exercise
+      Trajectory trajectory = computeTrajectory(spec);
+      // verify
+      assertEquals(trajectory.impactX, 0.0);
+      assertEquals(trajectory.impactTime, 0.0);
+      assertUnit(trajectory.numSteps == 1);
+      assertUnit(trajectory.samples.empty());
+   }  // teardown
+
+   /*********************************************
+    * name:    COMPUTE TRAJECTORY straight up with no drag to speak of
+    * input:   up, 19.6128m/s, 1e12kg, 1s steps
+    *          t=1 y=14.7096  t=2 y=19.6128  t=3 y=14.7096  t=4 y=0
+    * output:  lands back at x=0 at t=4
+    *********************************************/
+   void computeTrajectory_straightUp()
+   {  // setup
+      ShotSpec spec(0.0, 19.6128);
+      spec.mass = 1e12;
+      // exercise
+      Trajectory trajectory = computeTrajectory(spec);
+      // verify
+      assertEquals(trajectory.impactX, 0.0);
+      assertEquals(trajectory.impactTime, 4.0);
+      assertUnit(trajectory.numSteps == 4 || trajectory.numSteps == 5);
+   }  // teardown
+
+   /*********************************************
+    * name:    COMPUTE TRAJECTORY keeping every other step
+    * input:   the straight up shot, sampleEvery=2
+    * output:  samples at t=0, t=2 (the top) and t=4
+    *********************************************/
+   void computeTrajectory_samples()
+   {  // setup
+      ShotSpec spec(0.0, 19.6128);
+      spec.mass = 1e12;
+      spec.sampleEvery = 2;
+      // exercise
+      Trajectory trajectory = computeTrajectory(spec);
+      // verify
+      assertUnit(trajectory.samples.size() >= 3);
+      if (trajectory.samples.size() >= 3)
+      {
+         assertEquals(trajectory.samples[0].t, 0.0);
+         assertEquals(trajectory.samples[0].dy, 19.6128);
+         assertEquals(trajectory.samples[1].t, 2.0);
+         assertEquals(trajectory.samples[1].x, 0.0);
+         assertEquals(trajectory.samples[1].y, 19.6128);
+         assertEquals(trajectory.samples[1].dy, 0.0);
+         assertEquals(trajectory.samples[2].t, 4.0);
+      }
+   }  // teardown
+
+   /*********************************************
+    * name:    COMPUTE TRAJECTORY reading the tables smoothly
+    * input:   45 degrees, 827m/s, cubic interpolation
+    * output:  within 2% of the linear range, but not the same. The
+    *          cubic follows the thinning air more closely, so it flies
+    *          about 1.2% farther
+    *********************************************/
+   void computeTrajectory_cubic()
+   {  // setup
+      ShotSpec spec(45.0, 827.0);
+      double linear = computeTrajectory(spec).impactX;
+      spec.interpolation = INTERPOLATE_CUBIC;
+      // exercise
+      double cubic = computeTrajectory(spec).impactX;
+      // verify
+      assertUnit(fabs(cubic - linear) < 0.02 * linear);
+      assertUnit(cubic != linear);
+   }  // teardown
+
+   /*********************************************
+    * name:    COMPUTE TRAJECTORY to a height
+    * input:   the straight up shot, impact height 14.7096m
+    * output:  comes down through it at t=3, not on the way up at t=1
+    *********************************************/
+   void computeTrajectory_height()
+   {  // setup
+      ShotSpec spec(0.0, 19.6128);
+      spec.mass = 1e12;
+      spec.impactHeight = 14.7096;
+      // exercise
+      Trajectory trajectory = computeTrajectory(spec);
+      // verify
+      assertUnit(trajectory.fReached);
+      assertEquals(trajectory.impactX, 0.0);
+      assertEquals(trajectory.impactTime, 3.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    COMPUTE TRAJECTORY to a height with no drag
+    * input:   the straight up shot, no drag, impact height 14.7096m
+    * output:  the later root of the equation of motion, t=3
+    *********************************************/
+   void computeTrajectory_heightVacuum()
+   {  // setup
+      ShotSpec spec(0.0, 19.6128);
+      spec.fDrag = false;
+      spec.impactHeight = 14.7096;
+      // exercise
+      Trajectory trajectory = computeTrajectory(spec);
+      // verify
+      assertUnit(trajectory.fReached);
+      assertEquals(trajectory.impactTime, 3.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    COMPUTE TRAJECTORY higher than it climbs
+    * input:   the straight up shot, impact height 20m, with drag and
+    *          without
+    * output:  not reached either way, stopped at the top at t=2
+    *********************************************/
+   void computeTrajectory_tooHigh()
+   {  // setup
+      ShotSpec spec(0.0, 19.6128);
+      spec.mass = 1e12;
+      spec.impactHeight = 20.0;
+      ShotSpec vacuum = spec;
+      vacuum.fDrag = false;
+      // exercise
+      Trajectory trajectory = computeTrajectory(spec);
+      Trajectory trajectoryVacuum = computeTrajectory(vacuum);
+      // verify
+      assertUnit(!trajectory.fReached);
+      assertEquals(trajectory.impactTime, 2.0);
+      assertUnit(!trajectoryVacuum.fReached);
+      assertEquals(trajectoryVacuum.impactTime, 2.0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * ULP DISTANCE
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    ULP DISTANCE between equal values
+    * input:   1.5, 1.5
+    * output:  0
+    *********************************************/
+   void ulpDistance_same()
+   {  // setup
+      // exercise
+      uint64_t ulps = ulpDistance(1.5, 1.5);
+      // verify
+      assertUnit(ulps == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ULP DISTANCE between neighbors
+    * input:   1.0 and the next double up, in both orders
+    * output:  1
+    *********************************************/
+   void ulpDistance_neighbor()
+   {  // setup
+      double next = std::nextafter(1.0, 2.0);
+      // exercise
+      uint64_t ulpsUp = ulpDistance(1.0, next);
+      uint64_t ulpsDown = ulpDistance(next, 1.0);
+      // verify
+      assertUnit(ulpsUp == 1);
+      assertUnit(ulpsDown == 1);
+   }  // teardown
+
+   /*********************************************
+    * name:    ULP DISTANCE between the two zeros
+    * input:   0.0, -0.0
+    * output:  0
+    *********************************************/
+   void ulpDistance_signedZero()
+   {  // setup
+      // exercise
+      uint64_t ulps = ulpDistance(0.0, -0.0);
+      // verify
+      assertUnit(ulps == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ULP DISTANCE across zero
+    * input:   the smallest positive and negative doubles
+    * output:  2
+    *********************************************/
+   void ulpDistance_acrossZero()
+   {  // setup
+      double positive = std::nextafter(0.0, 1.0);
+      double negative = std::nextafter(0.0, -1.0);
+      // exercise
+      uint64_t ulps = ulpDistance(positive, negative);
+      // verify
+      assertUnit(ulps == 2);
+   }  // teardown
+};
@@ -0,0 +1,387 @@
+/***********************************************************************
+ * Header File:
+ *    TEST TRAJECTORY CODEC
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    All the unit tests for storing trajectories in a few bits a sample
+ ************************************************************************/
+
+#pragma once
+
+#include "trajectoryCodec.h"
+#include "velocity.h"
+#include "unitTest.h"
+#include <sstream>     // for istringstream and ostringstream
+#include <string>
+#include <vector>
+#include <cmath>       // for fabs()
+
+/*******************************
+ * TEST TRAJECTORY CODEC
+ * The unit tests for writing, streaming and seeking trajectory files
+ ********************************/
+class TestTrajectoryCodec : public UnitTest
+{
+public:
+   void run()
+   {
+      // writing
+      write_withinTolerance();
+      write_smaller();
+      write_chunks();
+      write_newShot();
+
+      // reading
+      open_notAFile();
+      readChunk_stream();
+      readChunk_unfinished();
+      sampleAt_between();
+      sampleAt_acrossChunks();
+      sampleAt_outside();
+
+      report("TrajectoryCodec");
+   }
+
+private:
+
+   /*****************************************************************
+    *****************************************************************
+    * WRITING
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    WRITE within tolerance
+    * input:   every half second of a shot at 30 degrees, in a vacuum
+    * output:  every value of every sample comes back within tolerance
+    *********************************************/
+   void write_withinTolerance()
+   {  // setup
+      Trajectory trajectory = vacuum(30.0);
+      CodecTolerance tolerance;
+      std::ostringstream out;
+      std::vector<TrajectorySample> samples;
+      std::string error;
+      // exercise
+      {
+         TrajectoryEncoder encoder(out, tolerance);
+         encoder.write(0, trajectory);
+      }
+      std::istringstream in(out.str());
+      TrajectoryDecoder decoder(in);
+      assertUnit(decoder.open(error));
+      assertUnit(decoder.readIndex(error));
+      bool fRead = decoder.readShot(0, samples, error);
+      // verify
+      assertUnit(fRead);
+      assertUnit(samples.size() == trajectory.samples.size());
+      assertUnit(isWithin(trajectory.samples, samples, tolerance));
+      assertEquals(decoder.getTolerance().position, tolerance.position);
+   }  // teardown
+
+   /*********************************************
+    * name:    WRITE smaller
+    * input:   every tenth of a second of a shot at 30 degrees, with drag
+    * output:  at least ten times smaller than 40 bytes a sample
+    *********************************************/
+   void write_smaller()
+   {  // setup
+      ShotSpec spec(30.0, 827.0);
+      spec.timeStep = 0.1;
+      spec.sampleEvery = 1;
+      Trajectory trajectory = computeTrajectory(spec);
+      std::ostringstream out;
+      // exercise
+      {
+         TrajectoryEncoder encoder(out);
+         encoder.write(0, trajectory);
+         assertUnit(encoder.getNumSamples() == (long long)trajectory.samples.size());
+      }
+      // verify
+      assertUnit(trajectory.samples.size() > 500);
+      assertUnit(out.str().size() * 10 < trajectory.samples.size() * 40);
+   }  // teardown
+
+   /*********************************************
+    * name:    WRITE chunks
+    * input:   one shot of 100 and more samples, chunks of 100
+    * output:  chunks of 100, 100 and the rest, each after the last
+    *********************************************/
+   void write_chunks()
+   {  // setup
+      Trajectory trajectory = vacuum(30.0);
+      size_t numSamples = trajectory.samples.size();
+      std::ostringstream out;
+      std::string error;
+      // exercise
+      {
+         TrajectoryEncoder encoder(out, CodecTolerance(), 100);
+         encoder.write(3, trajectory);
+      }
+      std::istringstream in(out.str());
+      TrajectoryDecoder decoder(in);
+      assertUnit(decoder.open(error));
+      bool fRead = decoder.readIndex(error);
+      // verify
+      assertUnit(fRead);
+      assertUnit(numSamples > 200 && numSamples <= 300);
+      const std::vector<TrajectoryChunkInfo>& index = decoder.getIndex();
+      assertUnit(index.size() == 3);
+      assertUnit(index[0].shot == 3);
+      assertUnit(index[0].numSamples == 100);
+      assertUnit(index[1].numSamples == 100);
+      assertUnit(index[2].numSamples == numSamples - 200);
+      assertEquals(index[0].timeBegin, 0.0);
+      assertEquals(index[1].timeBegin, 50.0);
+      assertUnit(index[0].offset == 36);
+      assertUnit(index[0].offset < index[1].offset);
+      assertUnit(index[1].offset < index[2].offset);
+   }  // teardown
+
+   /*********************************************
+    * name:    WRITE new shot
+    * input:   3 samples of shot 1, 2 of shot 2, then 1 more of shot 1
+    * output:  three chunks. Shot 1 reads back with 4 samples
+    *********************************************/
+   void write_newShot()
+   {  // setup
+      Trajectory trajectory = vacuum(30.0);
+      std::ostringstream out;
+      std::vector<TrajectorySample> samples;
+      std::string error;
+      // exercise
+      {
+         TrajectoryEncoder encoder(out);
+         encoder.write(1, trajectory.samples[0]);
+         encoder.write(1, trajectory.samples[1]);
+         encoder.write(1, trajectory.samples[2]);
+         encoder.write(2, trajectory.samples[0]);
+         encoder.write(2, trajectory.samples[1]);
+         encoder.write(1, trajectory.samples[3]);
+      }
+      std::istringstream in(out.str());
+      TrajectoryDecoder decoder(in);
+      assertUnit(decoder.open(error));
+      assertUnit(decoder.readIndex(error));
+      bool fRead = decoder.readShot(1, samples, error);
+      // verify
+      assertUnit(fRead);
+      assertUnit(decoder.getIndex().size() == 3);
+      assertUnit(samples.size() == 4);
+      assertEquals(samples[3].t, trajectory.samples[3].t);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * READING
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    OPEN not a file
+    * input:   some text
+    * output:  false, not a trajectory file
+    *********************************************/
+   void open_notAFile()
+   {  // setup
+      std::istringstream in("index,elevation,muzzleVelocity\n");
+      TrajectoryDecoder decoder(in);
+      std::string error;
+      // exercise
+      bool fOpen = decoder.open(error);
+      // verify
+      assertUnit(!fOpen);
+      assertUnit(error == "not a trajectory file");
+   }  // teardown
+
+   /*********************************************
+    * name:    READ CHUNK stream
+    *          Reading from the front without the index
+    * input:   one shot in chunks of 100
+    * output:  three chunks with all the samples, then the end
+    *********************************************/
+   void readChunk_stream()
+   {  // setup
+      Trajectory trajectory = vacuum(30.0);
+      std::ostringstream out;
+      {
+         TrajectoryEncoder encoder(out, CodecTolerance(), 100);
+         encoder.write(0, trajectory);
+      }
+      std::istringstream in(out.str());
+      TrajectoryDecoder decoder(in);
+      std::string error;
+      assertUnit(decoder.open(error));
+      TrajectoryChunk chunk;
+      std::vector<TrajectorySample> samples;
+      int numChunks = 0;
+      // exercise
+      while (decoder.readChunk(chunk, error))
+      {
+         samples.insert(samples.end(), chunk.samples.begin(), chunk.samples.end());
+         numChunks++;
+      }
+      // verify
+      assertUnit(error.empty());
+      assertUnit(numChunks == 3);
+      assertUnit(samples.size() == trajectory.samples.size());
+      assertUnit(isWithin(trajectory.samples, samples, CodecTolerance()));
+   }  // teardown
+
+   /*********************************************
+    * name:    READ CHUNK unfinished
+    *          The program writing the file died before finishing it
+    * input:   250 samples in chunks of 100, never finished
+    * output:  the two whole chunks stream back. There is no index
+    *********************************************/
+   void readChunk_unfinished()
+   {  // setup
+      Trajectory trajectory = vacuum(30.0);
+      std::ostringstream out;
+      std::string bytes;
+      {
+         TrajectoryEncoder encoder(out, CodecTolerance(), 100);
+         for (int i = 0; i < 250; i++)
+            encoder.write(0, trajectory.samples[i]);
+         bytes = out.str();
+      }
+      std::istringstream in(bytes);
+      TrajectoryDecoder decoder(in);
+      std::string error;
+      assertUnit(decoder.open(error));
+      TrajectoryChunk chunk;
+      int numChunks = 0;
+      // exercise
+      while (decoder.readChunk(chunk, error))
+         numChunks++;
+      // verify
+      assertUnit(error.empty());
+      assertUnit(numChunks == 2);
+      assertUnit(!decoder.readIndex(error));
+      assertUnit(!error.empty());
+   }  // teardown
+
+   /*********************************************
+    * name:    SAMPLE AT between
+    * input:   10.25s into a vacuum shot sampled every half second
+    * output:  x, dx and dy, which change steadily, are where they should be
+    *********************************************/
+   void sampleAt_between()
+   {  // setup
+      Trajectory trajectory = vacuum(30.0);
+      Velocity v;
+      v.set(Angle(30.0), 827.0);
+      std::istringstream in(encode(trajectory, 100));
+      TrajectoryDecoder decoder(in);
+      std::string error;
+      assertUnit(decoder.open(error));
+      assertUnit(decoder.readIndex(error));
+      TrajectorySample sample;
+      // exercise
+      bool fFound = decoder.sampleAt(0, 10.25, sample, error);
+      // verify
+      assertUnit(fFound);
+      assertEquals(sample.t, 10.25);
+      assertUnit(fabs(sample.x - v.getDX() * 10.25) <= 0.01 * 1.000001);
+      assertUnit(fabs(sample.dx - v.getDX()) <= 0.001 * 1.000001);
+      assertUnit(fabs(sample.dy - (v.getDY() + GRAVITY * 10.25)) <= 0.001 * 1.000001);
+   }  // teardown
+
+   /*********************************************
+    * name:    SAMPLE AT across chunks
+    * input:   49.75s, between the last sample of the first chunk of
+    *          100 and the first of the second
+    * output:  x is where it should be
+    *********************************************/
+   void sampleAt_acrossChunks()
+   {  // setup
+      Trajectory trajectory = vacuum(30.0);
+      Velocity v;
+      v.set(Angle(30.0), 827.0);
+      std::istringstream in(encode(trajectory, 100));
+      TrajectoryDecoder decoder(in);
+      std::string error;
+      assertUnit(decoder.open(error));
+      assertUnit(decoder.readIndex(error));
+      TrajectorySample sample;
+      // exercise
+      bool fFound = decoder.sampleAt(0, 49.75, sample, error);
+      // verify
+      assertUnit(fFound);
+      assertUnit(fabs(sample.x - v.getDX() * 49.75) <= 0.01 * 1.000001);
+   }  // teardown
+
+   /*********************************************
+    * name:    SAMPLE AT outside
+    * input:   before firing, after landing, and a shot never written
+    * output:  false each time
+    *********************************************/
+   void sampleAt_outside()
+   {  // setup
+      Trajectory trajectory = vacuum(30.0);
+      std::istringstream in(encode(trajectory, 100));
+      TrajectoryDecoder decoder(in);
+      std::string error;
+      assertUnit(decoder.open(error));
+      assertUnit(decoder.readIndex(error));
+      TrajectorySample sample;
+      double timeLast = trajectory.samples.back().t;
+      // exercise
+      bool fBefore = decoder.sampleAt(0, -1.0, sample, error);
+      bool fAfter = decoder.sampleAt(0, timeLast + 1.0, sample, error);
+      bool fOther = decoder.sampleAt(5, 10.0, sample, error);
+      bool fLast = decoder.sampleAt(0, timeLast, sample, error);
+      // verify
+      assertUnit(!fBefore);
+      assertUnit(!fAfter);
+      assertUnit(!fOther);
+      assertUnit(error == "there is no shot 5");
+      assertUnit(fLast);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * FIXTURE
+    *****************************************************************
+    *****************************************************************/
+
+   // every half second of a shot in a vacuum
+   Trajectory vacuum(double elevation)
+   {
+      ShotSpec spec(elevation, 827.0);
+      spec.fDrag = false;
+      spec.timeStep = 0.5;
+      spec.sampleEvery = 1;
+      return computeTrajectory(spec);
+   }
+
+   // a finished file with one shot, number 0
+   std::string encode(const Trajectory& trajectory, int chunk)
+   {
+      std::ostringstream out;
+      {
+         TrajectoryEncoder encoder(out, CodecTolerance(), chunk);
+         encoder.write(0, trajectory);
+      }
+      return out.str();
+   }
+
+   // every value of every sample no further off than the tolerance
+   bool isWithin(const std::vector<TrajectorySample>& expected,
+                 const std::vector<TrajectorySample>& actual,
+                 const CodecTolerance& tolerance)
+   {
+      const double slack = 1.000001;   // for the rounding of the rounding
+      if (expected.size() != actual.size())
+         return false;
+      for (size_t i = 0; i < expected.size(); i++)
+         if (fabs(expected[i].t  - actual[i].t)  > tolerance.time     * slack ||
+             fabs(expected[i].x  - actual[i].x)  > tolerance.position * slack ||
+             fabs(expected[i].y  - actual[i].y)  > tolerance.position * slack ||
+             fabs(expected[i].dx - actual[i].dx) > tolerance.velocity * slack ||
+             fabs(expected[i].dy - actual[i].dy) > tolerance.velocity * slack)
+            return false;
+      return true;
+   }
+};
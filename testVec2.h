@@ -0,0 +1,183 @@
+/***********************************************************************
+ * Header File:
+ *    TEST VEC2
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    All the unit tests for the two dimensional vector
+ ************************************************************************/
+
+#pragma once
+
+#include "vec2.h"
+#include "position.h"
+#include "velocity.h"
+#include "acceleration.h"
+#include "unitTest.h"
+
+/*******************************
+ * TEST VEC2
+ * The unit tests for Vec2, in double (SSE2 where there is one)
+ ********************************/
+class TestVec2 : public UnitTest
+{
+public:
+   void run()
+   {
+      constructor_default();
+      set_xy();
+
+      add_sub();
+      multiply_scalar();
+      multiply_componentwise();
+      divide_negate();
+      length_threeFourFive();
+
+      position_step();
+
+      report("Vec2");
+   }
+
+private:
+
+   /*********************************************
+    * name:    CONSTRUCTOR default
+    * input:   nothing
+    * output:  (0, 0)
+    *********************************************/
+   void constructor_default()
+   {  // setup
+      // exercise
+      Vec2d d;
+      // verify
+      assertEquals(d.getX(), 0.0);
+      assertEquals(d.getY(), 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    SET X and Y one at a time
+    * input:   (1, 2), then x=3, then y=4
+    * output:  (3, 2) then (3, 4), the other half untouched
+    *********************************************/
+   void set_xy()
+   {  // setup
+      Vec2d v(1.0, 2.0);
+      // exercise
+      v.setX(3.0);
+      double y = v.getY();
+      v.setY(4.0);
+      // verify
+      assertEquals(y, 2.0);
+      assertEquals(v.getX(), 3.0);
+      assertEquals(v.getY(), 4.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADD and SUBTRACT
+    * input:   (1, 2) + (10, 20), then -= (0.5, 0.25)
+    * output:  (11, 22), then (10.5, 21.75)
+    *********************************************/
+   void add_sub()
+   {  // setup
+      Vec2d lhs(1.0, 2.0);
+      Vec2d rhs(10.0, 20.0);
+      // exercise
+      Vec2d sum = lhs + rhs;
+      Vec2d difference = sum;
+      difference -= Vec2d(0.5, 0.25);
+      // verify
+      assertEquals(sum.getX(), 11.0);
+      assertEquals(sum.getY(), 22.0);
+      assertEquals(difference.getX(), 10.5);
+      assertEquals(difference.getY(), 21.75);
+      assertUnit(sum - rhs == lhs);
+   }  // teardown
+
+   /*********************************************
+    * name:    MULTIPLY by a scalar
+    * input:   (3, -4) * 2.5
+    * output:  (7.5, -10)
+    *********************************************/
+   void multiply_scalar()
+   {  // setup
+      Vec2d v(3.0, -4.0);
+      // exercise
+      Vec2d product = v * 2.5;
+      v *= 2.0;
+      // verify
+      assertEquals(product.getX(), 7.5);
+      assertEquals(product.getY(), -10.0);
+      assertEquals(v.getX(), 6.0);
+      assertEquals(v.getY(), -8.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    MULTIPLY component by component
+    * input:   (3, -4) * (2, 0.5)
+    * output:  (6, -2)
+    *********************************************/
+   void multiply_componentwise()
+   {  // setup
+      Vec2d lhs(3.0, -4.0);
+      Vec2d rhs(2.0, 0.5);
+      // exercise
+      Vec2d product = lhs * rhs;
+      // verify
+      assertEquals(product.getX(), 6.0);
+      assertEquals(product.getY(), -2.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    DIVIDE by a scalar and NEGATE
+    * input:   (3, -4) / 2, then -(3, -4)
+    * output:  (1.5, -2) and (-3, 4)
+    *********************************************/
+   void divide_negate()
+   {  // setup
+      Vec2d v(3.0, -4.0);
+      // exercise
+      Vec2d quotient = v / 2.0;
+      Vec2d negative = -v;
+      // verify
+      assertEquals(quotient.getX(), 1.5);
+      assertEquals(quotient.getY(), -2.0);
+      assertEquals(negative.getX(), -3.0);
+      assertEquals(negative.getY(), 4.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    LENGTH and DOT of a 3-4-5 triangle
+    * input:   (3, 4)
+    * output:  length 5, dot with itself 25
+    *********************************************/
+   void length_threeFourFive()
+   {  // setup
+      Vec2d v(3.0, 4.0);
+      // exercise
+      double length = v.length();
+      double dot = v.dot(v);
+      // verify
+      assertEquals(length, 5.0);
+      assertEquals(dot, 25.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    POSITION step on top of the vectors
+    * input:   (100, 200) + (10, 20) 2s + 1/2 (1, -2) 2^2
+    * output:  (122, 236), and the same as the hand written step
+    *********************************************/
+   void position_step()
+   {  // setup
+      Position pos(100.0, 200.0);
+      Velocity v(10.0, 20.0);
+      Acceleration a(1.0, -2.0);
+      double t = 2.0;
+      // exercise
+      pos.add(a, v, t);
+      // verify
+      assertEquals(pos.getMetersX(), 122.0);
+      assertEquals(pos.getMetersY(), 236.0);
+      assertUnit(pos.getMeters() == Vec2d(100.0 + (10.0 * t) + (0.5 * 1.0 * (t * t)),
+                                          200.0 + (20.0 * t) + (0.5 * -2.0 * (t * t))));
+   }  // teardown
+};
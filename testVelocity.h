@@ -339,7 +339,7 @@ private:
       v.dx = -99.9;
       v.dy = -88.8;
       Angle angle;
-      angle.radians = 0.0; // up
+      angle.setRadians(0.0); // up
       double magnitude = 3.3;
 
       // exercise
@@ -363,7 +363,7 @@ private:
       v.dx = -99.9;
       v.dy = -88.8;
       Angle angle;
-      angle.radians = M_PI; // DOWN
+      angle.setRadians(M_PI); // DOWN
       double magnitude = 3.3;
 
       // exercise
@@ -387,7 +387,7 @@ private:
       v.dx = -99.9;
       v.dy = -88.8;
       Angle angle;
-      angle.radians = M_PI_2; // RIGHT
+      angle.setRadians(M_PI_2); // RIGHT
       double magnitude = 3.3;
 
       // exercise
@@ -411,7 +411,7 @@ private:
       v.dx = -99.9;
       v.dy = -88.8;
       Angle angle;
-      angle.radians = M_PI_2 + M_PI; // LEFT
+      angle.setRadians(M_PI_2 + M_PI); // LEFT
       double magnitude = 3.3;
 
       // exercise
@@ -435,7 +435,7 @@ private:
       v.dx = -99.9;
       v.dy = -88.8;
       Angle angle;
-      angle.radians = 1.0; // up and right somewhat
+      angle.setRadians(1.0); // up and right somewhat
       double magnitude = 1.0;
 
       // exercise
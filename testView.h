@@ -0,0 +1,275 @@
+/***********************************************************************
+ * Header File:
+ *    TEST VIEW
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Unit tests for the View class.
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+#include "view.h"
+
+using namespace std;
+
+/*******************************
+ * TEST VIEW
+ * A friend class for View which contains the View unit tests
+ ********************************/
+class TestView : public UnitTest
+{
+public:
+   void run()
+   {
+      // constructors
+      construct_default();
+      construct_nonDefault();
+
+      // meters to pixels
+      getPixelsX_noZoom();
+      getPixelsX_zoom();
+      getPixelsY_noZoom();
+      getPixelsY_zoom();
+      getUpperRight();
+
+      // pixels to meters
+      fromPixels_noZoom();
+      fromPixels_zoom();
+      offset_noZoom();
+      offset_zoom();
+
+      // every view has its own zoom
+      zoom_independent();
+
+      report("View");
+   }
+
+private:
+
+   /*****************************************************************
+    *****************************************************************
+    * CONSTRUCTOR
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    DEFAULT CONSTRUCTOR
+    * input:   nothing
+    * output:  40m per pixel, no size
+    *********************************************/
+   void construct_default()
+   {  // setup
+      // exercise
+      View view;
+      // verify
+      assertEquals(view.metersFromPixels, 40.0);
+      assertUnit(view.width == 0);
+      assertUnit(view.height == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    NON-DEFAULT CONSTRUCTOR
+    * input:   zoom=99.9 700 x 500
+    * output:  zoom=99.9 700 x 500
+    *********************************************/
+   void construct_nonDefault()
+   {  // setup
+      // exercise
+      View view(99.9, 700, 500);
+      // verify
+      assertEquals(view.getZoom(), 99.9);
+      assertUnit(view.getWidth() == 700);
+      assertUnit(view.getHeight() == 500);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * METERS TO PIXELS
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    GET PIXELS X NO ZOOM
+    *          When metersFromPixels == 1, pixels and meters are the same
+    * input:   pos=(123.4, 567.8) metersFromPixels=1
+    * output:  x=123.4
+    *********************************************/
+   void getPixelsX_noZoom()
+   {  // setup
+      View view(1.0, 10, 10);
+      Position pos(123.4, 567.8);
+      // exercise
+      double pixelsX = view.getPixelsX(pos);
+      // verify
+      assertEquals(pixelsX, 123.4);
+      assertEquals(pos.getMetersX(), 123.4);
+      assertEquals(pos.getMetersY(), 567.8);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET PIXELS X ZOOM
+    *          pixels = meters / metersFromPixels
+    * input:   pos=(123.4, 567.8) metersFromPixels=100
+    * output:  x=1.234
+    *********************************************/
+   void getPixelsX_zoom()
+   {  // setup
+      View view(100.0, 10, 10);
+      Position pos(123.4, 567.8);
+      // exercise
+      double pixelsX = view.getPixelsX(pos);
+      // verify
+      assertEquals(pixelsX, 1.234);
+      assertEquals(pos.getMetersX(), 123.4);
+      assertEquals(pos.getMetersY(), 567.8);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET PIXELS Y NO ZOOM
+    * input:   pos=(123.4, 567.8) metersFromPixels=1
+    * output:  y=567.8
+    *********************************************/
+   void getPixelsY_noZoom()
+   {  // setup
+      View view(1.0, 10, 10);
+      Position pos(123.4, 567.8);
+      // exercise
+      double pixelsY = view.getPixelsY(pos);
+      // verify
+      assertEquals(pixelsY, 567.8);
+      assertEquals(pos.getMetersX(), 123.4);
+      assertEquals(pos.getMetersY(), 567.8);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET PIXELS Y ZOOM
+    * input:   pos=(123.4, 567.8) metersFromPixels=100
+    * output:  y=5.678
+    *********************************************/
+   void getPixelsY_zoom()
+   {  // setup
+      View view(100.0, 10, 10);
+      Position pos(123.4, 567.8);
+      // exercise
+      double pixelsY = view.getPixelsY(pos);
+      // verify
+      assertEquals(pixelsY, 5.678);
+      assertEquals(pos.getMetersX(), 123.4);
+      assertEquals(pos.getMetersY(), 567.8);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET UPPER RIGHT
+    * input:   zoom=40 700 x 500
+    * output:  (28000, 20000)
+    *********************************************/
+   void getUpperRight()
+   {  // setup
+      View view(40.0, 700, 500);
+      // exercise
+      Position pos = view.getUpperRight();
+      // verify
+      assertEquals(pos.getMetersX(), 28000.0);
+      assertEquals(pos.getMetersY(), 20000.0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * PIXELS TO METERS
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    FROM PIXELS NO ZOOM
+    * input:   (123.4px, 567.8px) metersFromPixels=1
+    * output:  pos=(123.4, 567.8)
+    *********************************************/
+   void fromPixels_noZoom()
+   {  // setup
+      View view(1.0, 10, 10);
+      // exercise
+      Position pos = view.fromPixels(123.4, 567.8);
+      // verify
+      assertEquals(pos.getMetersX(), 123.4);
+      assertEquals(pos.getMetersY(), 567.8);
+   }  // teardown
+
+   /*********************************************
+    * name:    FROM PIXELS ZOOM
+    *          meters = pixels * metersFromPixels
+    * input:   (123.4px, 567.8px) metersFromPixels=100
+    * output:  pos=(12340, 56780)
+    *********************************************/
+   void fromPixels_zoom()
+   {  // setup
+      View view(100.0, 10, 10);
+      // exercise
+      Position pos = view.fromPixels(123.4, 567.8);
+      // verify
+      assertEquals(pos.getMetersX(), 12340.0);
+      assertEquals(pos.getMetersY(), 56780.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    OFFSET NO ZOOM
+    * input:   pos=(4500,2500) 3px right, 2px down metersFromPixels=1
+    * output:  (4503,2498)
+    *********************************************/
+   void offset_noZoom()
+   {  // setup
+      View view(1.0, 10, 10);
+      Position pos(4500.0, 2500.0);
+      // exercise
+      Position posOffset = view.offset(pos, 3.0, -2.0);
+      // verify
+      assertEquals(posOffset.getMetersX(), 4503.0);
+      assertEquals(posOffset.getMetersY(), 2498.0);
+      assertEquals(pos.getMetersX(), 4500.0);
+      assertEquals(pos.getMetersY(), 2500.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    OFFSET ZOOM
+    * input:   pos=(4500,2500) 3px right, 2px down metersFromPixels=50
+    * output:  (4650,2400)
+    *********************************************/
+   void offset_zoom()
+   {  // setup
+      View view(50.0, 10, 10);
+      Position pos(4500.0, 2500.0);
+      // exercise
+      Position posOffset = view.offset(pos, 3.0, -2.0);
+      // verify
+      assertEquals(posOffset.getMetersX(), 4650.0);
+      assertEquals(posOffset.getMetersY(), 2400.0);
+      assertEquals(pos.getMetersX(), 4500.0);
+      assertEquals(pos.getMetersY(), 2500.0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * INDEPENDENCE
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    ZOOM INDEPENDENT
+    *          Setting up one view does not change another
+    * input:   view1 zoom=1  view2 zoom=100  pos=(500, 500)
+    * output:  view1 500px  view2 5px
+    *********************************************/
+   void zoom_independent()
+   {  // setup
+      View view1(1.0, 10, 10);
+      Position pos(500.0, 500.0);
+      // exercise
+      View view2(100.0, 10, 10);
+      // verify
+      assertEquals(view1.getPixelsX(pos), 500.0);
+      assertEquals(view2.getPixelsX(pos), 5.0);
+      assertEquals(view1.metersFromPixels, 1.0);
+      assertEquals(view2.metersFromPixels, 100.0);
+   }  // teardown
+};
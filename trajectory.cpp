@@ -0,0 +1,161 @@
+/***********************************************************************
+ * Source File:
+ *    TRAJECTORY
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Fly one shot from the muzzle to the ground without any graphics
+ ************************************************************************/
+
+#include "trajectory.h"
+#include "projectile.h"
+#include "angle.h"
+#include <cstring>     // for memcpy()
+#include <limits>      // for numeric_limits
+#include <cmath>       // for floor()
+using namespace std;
+
+ShotSpec::ShotSpec() :
+   elevation(45.0), muzzleVelocity(827.0),
+   mass(DEFAULT_PROJECTILE_WEIGHT), radius(DEFAULT_PROJECTILE_RADIUS),
+   timeStep(1.0), impactHeight(0.0), sampleEvery(0), fDrag(true),
+   interpolation(INTERPOLATE_LINEAR), pDragTable(nullptr),
+   pAtmosphere(nullptr)
+{
+}
+
+ShotSpec::ShotSpec(double elevation, double muzzleVelocity) :
+   elevation(elevation), muzzleVelocity(muzzleVelocity),
+   mass(DEFAULT_PROJECTILE_WEIGHT), radius(DEFAULT_PROJECTILE_RADIUS),
+   timeStep(1.0), impactHeight(0.0), sampleEvery(0), fDrag(true),
+   interpolation(INTERPOLATE_LINEAR), pDragTable(nullptr),
+   pAtmosphere(nullptr)
+{
+}
+
+/*********************************************
+ * SAMPLE FROM PROJECTILE
+ *********************************************/
+static TrajectorySample sampleFromProjectile(const Projectile& projectile)
+{
+   Position pos = projectile.getPosition();
+   Velocity v = projectile.getVelocity();
+   TrajectorySample sample;
+   sample.t = projectile.getCurrentTime();
+   sample.x = pos.getMetersX();
+   sample.y = pos.getMetersY();
+   sample.dx = v.getDX();
+   sample.dy = v.getDY();
+   return sample;
+}
+
+/*********************************************
+ * COMPUTE VACUUM TRAJECTORY
+ * The same steps and samples computeTrajectory() would give, but
+ * each one evaluated directly rather than integrated
+ *********************************************/
+static Trajectory computeVacuumTrajectory(const ShotSpec& spec)
+{
+   Trajectory trajectory;
+
+   Velocity v;
+   v.set(Angle(spec.elevation), spec.muzzleVelocity);
+   trajectory.fReached = v.getDY() * v.getDY() + 2.0 * GRAVITY * spec.impactHeight >= 0.0;
+   trajectory.impactTime = trajectory.fReached ?
+      impactTimeFromVacuum(-spec.impactHeight, v.getDY(), GRAVITY) :
+      v.getDY() / -GRAVITY;
+   trajectory.impactX = v.getDX() * trajectory.impactTime;
+   trajectory.numSteps = (int)floor(trajectory.impactTime / spec.timeStep) + 1;
+
+   if (spec.sampleEvery > 0)
+      for (int step = 0; step <= trajectory.numSteps; step += spec.sampleEvery)
+      {
+         TrajectorySample sample;
+         sample.t = step * spec.timeStep;
+         sample.x = v.getDX() * sample.t;
+         sample.y = v.getDY() * sample.t + 0.5 * GRAVITY * sample.t * sample.t;
+         sample.dx = v.getDX();
+         sample.dy = v.getDY() + GRAVITY * sample.t;
+         trajectory.samples.push_back(sample);
+      }
+
+   return trajectory;
+}
+
+/*********************************************
+ * COMPUTE TRAJECTORY
+ * Step the projectile until it is on its way down and below the
+ * impact height, then find where the last step crossed it
+ *********************************************/
+Trajectory computeTrajectory(const ShotSpec& spec)
+{
+   if (!spec.fDrag)
+      return computeVacuumTrajectory(spec);
+
+   Trajectory trajectory;
+
+   Projectile projectile;
+   projectile.setMass(spec.mass);
+   projectile.setRadius(spec.radius);
+   projectile.setInterpolation(spec.interpolation);
+   projectile.setDragTable(spec.pDragTable);
+   projectile.setAtmosphere(spec.pAtmosphere);
+   projectile.fire(Position(0.0, 0.0), 0.0, Angle(spec.elevation), spec.muzzleVelocity);
+   if (spec.sampleEvery > 0)
+      trajectory.samples.push_back(sampleFromProjectile(projectile));
+
+   TrajectorySample previous = sampleFromProjectile(projectile);
+   TrajectorySample current = previous;
+   do
+   {
+      previous = current;
+      projectile.advance(spec.timeStep);
+      current = sampleFromProjectile(projectile);
+      trajectory.numSteps++;
+
+      if (spec.sampleEvery > 0 && trajectory.numSteps % spec.sampleEvery == 0)
+         trajectory.samples.push_back(current);
+   }
+   while ((current.y >= spec.impactHeight || current.dy > 0.0) &&
+          trajectory.numSteps < MAX_TRAJECTORY_STEPS);
+
+   // it turned back down short of the height: stop at the top
+   if (previous.y < spec.impactHeight)
+   {
+      const TrajectorySample& top = previous.y > current.y ? previous : current;
+      trajectory.fReached = false;
+      trajectory.impactX = top.x;
+      trajectory.impactTime = top.t;
+      return trajectory;
+   }
+
+   // where between the last two steps did we cross the impact height?
+   double fraction = (previous.y == current.y) ? 1.0 :
+      (previous.y - spec.impactHeight) / (previous.y - current.y);
+   trajectory.impactX = previous.x + fraction * (current.x - previous.x);
+   trajectory.impactTime = previous.t + fraction * (current.t - previous.t);
+
+   return trajectory;
+}
+
+/*********************************************
+ * ULP DISTANCE
+ * Map each double onto a line of integers where neighbors differ by
+ * one, then subtract. +0 and -0 are the same place.
+ *********************************************/
+uint64_t ulpDistance(double lhs, double rhs)
+{
+   if (lhs != lhs || rhs != rhs)
+      return numeric_limits<uint64_t>::max();
+
+   int64_t iLHS;
+   int64_t iRHS;
+   memcpy(&iLHS, &lhs, sizeof(double));
+   memcpy(&iRHS, &rhs, sizeof(double));
+   if (iLHS < 0)
+      iLHS = numeric_limits<int64_t>::min() - iLHS;
+   if (iRHS < 0)
+      iRHS = numeric_limits<int64_t>::min() - iRHS;
+
+   return iLHS > iRHS ? (uint64_t)iLHS - (uint64_t)iRHS : (uint64_t)iRHS - (uint64_t)iLHS;
+}
@@ -0,0 +1,81 @@
+/***********************************************************************
+ * Header File:
+ *    TRAJECTORY
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Fly one shot from the muzzle to the ground without any graphics.
+ *    This is the headless engine the regression corpus, the firing
+ *    solver and the batch tools are built on.
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <cstdint>     // for uint64_t
+#include "physics.h"   // for InterpolationMode
+
+class DragTable;
+class AtmosphereProfile;
+
+/*********************************************
+ * SHOT SPEC
+ * Everything that decides where a shot lands
+ *********************************************/
+struct ShotSpec
+{
+   ShotSpec();
+   ShotSpec(double elevation, double muzzleVelocity);
+
+   double elevation;       // degrees from straight up, positive to the right
+   double muzzleVelocity;  // m/s
+   double mass;            // kg
+   double radius;          // m
+   double timeStep;        // s per call to Projectile::advance()
+   double impactHeight;    // m above the muzzle where the shot comes down
+   int    sampleEvery;     // keep every nth step. 0 keeps none
+   bool   fDrag;           // false solves the flight in closed form
+   InterpolationMode interpolation;  // how the tables are read
+   const DragTable* pDragTable;  // optional, built for this mass and radius
+   const AtmosphereProfile* pAtmosphere;  // optional, calm air if not set
+};
+
+/*********************************************
+ * TRAJECTORY SAMPLE
+ * One moment of the flight, in meters and seconds
+ *********************************************/
+struct TrajectorySample
+{
+   double t;
+   double x;
+   double y;
+   double dx;
+   double dy;
+};
+
+/*********************************************
+ * TRAJECTORY
+ * Where and when the shell came down, and the states along the way.
+ * The impact is interpolated to exactly y = impactHeight on the way
+ * down. A shell that never climbs that high stops at the top instead
+ *********************************************/
+struct Trajectory
+{
+   Trajectory() : impactX(0.0), impactTime(0.0), numSteps(0), fReached(true) {}
+
+   double impactX;      // m from the muzzle
+   double impactTime;   // s from firing
+   int    numSteps;     // calls to advance() it took
+   bool   fReached;     // false if it never got up to the impact height
+   std::vector<TrajectorySample> samples;
+};
+
+#define MAX_TRAJECTORY_STEPS 1000000   // give up on a shell that never lands
+
+// fly a shot from (0,0) until it falls below the impact height. Without drag
+// there is nothing to integrate: the samples and the impact come
+// straight from the equations of motion
+Trajectory computeTrajectory(const ShotSpec& spec);
+
+// how many representable doubles lie between two values. 0 means identical
+uint64_t ulpDistance(double lhs, double rhs);
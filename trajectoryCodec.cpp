@@ -0,0 +1,669 @@
+/***********************************************************************
+ * Source File:
+ *    TRAJECTORY CODEC
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Store trajectories in a few bits a sample, no further off than
+ *    the tolerance, and read them back
+ ************************************************************************/
+
+#include "trajectoryCodec.h"
+#include "littleEndian.h"
+#include <cstring>     // for memcmp()
+#include <cmath>       // for llround() and fabs()
+#include <algorithm>   // for min(), stable_sort(), lower_bound() and upper_bound()
+#include <cassert>
+using namespace std;
+
+const char     TRAJ_MAGIC[8]  = { 'M', '7', '7', '7', 'T', 'R', 'A', 'J' };
+const char     INDEX_MAGIC[8] = { 'M', '7', '7', '7', 'T', 'I', 'D', 'X' };
+const uint32_t TRAJ_VERSION   = 1;
+const char     TAG_CHUNK      = 'C';
+const char     TAG_INDEX      = 'I';
+
+#define NUM_CHANNELS    5
+#define MAX_QUANTA      1.0e15   // beyond this the differences could overflow
+
+// the parts of a sample, in the order they are stored
+static double TrajectorySample::* const CHANNELS[NUM_CHANNELS] =
+{
+   &TrajectorySample::t,
+   &TrajectorySample::x,
+   &TrajectorySample::y,
+   &TrajectorySample::dx,
+   &TrajectorySample::dy
+};
+
+/*********************************************
+ * STEP
+ * The size of one quantum of a channel. Rounding to the nearest one is
+ * never off by more than half of it
+ *********************************************/
+static double getStep(const CodecTolerance& tolerance, int channel)
+{
+   double value = (channel == 0) ? tolerance.time     :
+                  (channel <= 2) ? tolerance.position :
+                                   tolerance.velocity;
+   return 2.0 * value;
+}
+
+/*********************************************
+ * ZIGZAG
+ * Small negative numbers become small positive ones: 0 -1 1 -2 2 ...
+ * become 0 1 2 3 4 ...
+ *********************************************/
+static uint64_t zigzag(int64_t value)
+{
+   return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static int64_t unzigzag(uint64_t value)
+{
+   return (int64_t)((value >> 1) ^ (0 - (value & 1)));
+}
+
+// how many bits it takes to hold value
+static int bitsFor(uint64_t value)
+{
+   int bits = 0;
+   for (; value != 0; value >>= 1)
+      bits++;
+   return bits;
+}
+
+// how many bytes the varint of value takes
+static int varintSize(uint64_t value)
+{
+   int size = 1;
+   for (; value >= 0x80; value >>= 7)
+      size++;
+   return size;
+}
+
+/*********************************************
+ * PREDICT
+ * Where sample i should be if the last order differences held steady:
+ * the same value, the same velocity, or the same acceleration
+ *********************************************/
+static int64_t predict(const vector<int64_t>& quanta, size_t i, int order)
+{
+   switch (order)
+   {
+      case 1:
+         return quanta[i - 1];
+      case 2:
+         return 2 * quanta[i - 1] - quanta[i - 2];
+      default:
+         assert(order == 3);
+         return 3 * quanta[i - 1] - 3 * quanta[i - 2] + quanta[i - 3];
+   }
+}
+
+/*********************************************
+ * BIT WRITER
+ * Low bits first, into whole bytes
+ *********************************************/
+class BitWriter
+{
+public:
+   BitWriter(vector<char>& buffer) : buffer(buffer), bits(0), numBits(0) {}
+
+   void put(uint64_t value, int width)
+   {
+      // no more than 32 at a time so the shifts stay in range
+      while (width > 0)
+      {
+         int piece = min(width, 32);
+         bits |= (value & ((1ull << piece) - 1)) << numBits;
+         numBits += piece;
+         for (; numBits >= 8; numBits -= 8, bits >>= 8)
+            buffer.push_back((char)bits);
+         value >>= piece;
+         width -= piece;
+      }
+   }
+
+   void flush()
+   {
+      if (numBits > 0)
+         buffer.push_back((char)bits);
+      bits = 0;
+      numBits = 0;
+   }
+
+private:
+   vector<char>& buffer;
+   uint64_t bits;    // not yet a whole byte
+   int numBits;
+};
+
+/*********************************************
+ * BYTE READER
+ * Walk a chunk's bytes, never past the end
+ *********************************************/
+class ByteReader
+{
+public:
+   ByteReader(const vector<unsigned char>& bytes) :
+      bytes(bytes), pos(0), bits(0), numBits(0), fBad(false) {}
+
+   unsigned int getByte()
+   {
+      if (pos >= bytes.size())
+      {
+         fBad = true;
+         return 0;
+      }
+      return bytes[pos++];
+   }
+
+   uint64_t getVarint()
+   {
+      uint64_t value = 0;
+      unsigned int byte;
+      int shift = 0;
+      do
+      {
+         byte = getByte();
+         if (shift > 63)
+            fBad = true;
+         else
+            value |= (uint64_t)(byte & 0x7f) << shift;
+         shift += 7;
+      }
+      while ((byte & 0x80) && !fBad);
+      return value;
+   }
+
+   uint64_t getBits(int width)
+   {
+      uint64_t value = 0;
+      for (int shift = 0; width > 0 && !fBad; )
+      {
+         int piece = min(width, 32);
+         while (numBits < piece)
+         {
+            bits |= (uint64_t)getByte() << numBits;
+            numBits += 8;
+         }
+         value |= (bits & ((1ull << piece) - 1)) << shift;
+         bits >>= piece;
+         numBits -= piece;
+         shift += piece;
+         width -= piece;
+      }
+      return value;
+   }
+
+   // the rest of the bits of a byte are never used
+   void alignToByte()
+   {
+      bits = 0;
+      numBits = 0;
+   }
+
+   bool isBad()  const { return fBad; }
+   bool isDone() const { return pos == bytes.size(); }
+
+private:
+   const vector<unsigned char>& bytes;
+   size_t pos;
+   uint64_t bits;    // read but not yet used
+   int numBits;
+   bool fBad;        // tried to read past the end
+};
+
+/*********************************************
+ * ENCODE CHANNEL
+ * Try each order of prediction and keep whichever takes the fewest
+ * bits. The first order samples are kept whole, the rest as the
+ * difference from the prediction
+ *********************************************/
+static void encodeChannel(vector<char>& buffer, const vector<int64_t>& quanta)
+{
+   size_t num = quanta.size();
+   int orderBest = 1;
+   int widthBest = 0;
+   uint64_t costBest = UINT64_MAX;
+   for (int order = 1; order <= CODEC_MAX_ORDER && (size_t)order <= num; order++)
+   {
+      uint64_t cost = 0;
+      for (int i = 0; i < order; i++)
+         cost += 8 * varintSize(zigzag(quanta[i]));
+
+      int width = 0;
+      for (size_t i = order; i < num; i++)
+         width = max(width, bitsFor(zigzag(quanta[i] - predict(quanta, i, order))));
+      cost += (uint64_t)width * (num - order);
+
+      if (cost < costBest)
+      {
+         orderBest = order;
+         widthBest = width;
+         costBest = cost;
+      }
+   }
+
+   buffer.push_back((char)orderBest);
+   buffer.push_back((char)widthBest);
+   for (int i = 0; i < orderBest; i++)
+      putVarint(buffer, zigzag(quanta[i]));
+
+   BitWriter writer(buffer);
+   for (size_t i = orderBest; i < num; i++)
+      writer.put(zigzag(quanta[i] - predict(quanta, i, orderBest)), widthBest);
+   writer.flush();
+}
+
+/*********************************************
+ * DECODE CHANNEL
+ * The opposite of encodeChannel()
+ *********************************************/
+static bool decodeChannel(ByteReader& reader, vector<int64_t>& quanta)
+{
+   size_t num = quanta.size();
+   int order = (int)reader.getByte();
+   int width = (int)reader.getByte();
+   if (order < 1 || order > CODEC_MAX_ORDER || (size_t)order > num || width > 64)
+      return false;
+
+   for (int i = 0; i < order; i++)
+      quanta[i] = unzigzag(reader.getVarint());
+   for (size_t i = order; i < num; i++)
+      quanta[i] = predict(quanta, i, order) + unzigzag(reader.getBits(width));
+   reader.alignToByte();
+   return !reader.isBad();
+}
+
+/*********************************************
+ * TRAJECTORY ENCODER : CONSTRUCTOR
+ *********************************************/
+TrajectoryEncoder::TrajectoryEncoder(ostream& out, const CodecTolerance& tolerance,
+                                     int chunk) :
+   out(out), tolerance(tolerance), chunk(chunk), shot(0),
+   numSamples(0), numBytes(0), fFinished(false)
+{
+   assert(tolerance.time > 0.0 && tolerance.position > 0.0 && tolerance.velocity > 0.0);
+   assert(chunk > 0);
+   pending.reserve(chunk);
+
+   vector<char> buffer(TRAJ_MAGIC, TRAJ_MAGIC + 8);
+   putU32(buffer, TRAJ_VERSION);
+   putF64(buffer, tolerance.time);
+   putF64(buffer, tolerance.position);
+   putF64(buffer, tolerance.velocity);
+   put(buffer);
+}
+
+/*********************************************
+ * TRAJECTORY ENCODER : WRITE
+ *********************************************/
+void TrajectoryEncoder::write(int shot, const TrajectorySample& sample)
+{
+   assert(!fFinished);
+   assert(shot >= 0);
+   if (!pending.empty() && shot != this->shot)
+      writeChunk();
+   assert(pending.empty() || sample.t >= pending.back().t);
+
+   this->shot = shot;
+   pending.push_back(sample);
+   numSamples++;
+   if ((int)pending.size() == chunk)
+      writeChunk();
+}
+
+void TrajectoryEncoder::write(int shot, const Trajectory& trajectory)
+{
+   for (const TrajectorySample& sample : trajectory.samples)
+      write(shot, sample);
+}
+
+/*********************************************
+ * TRAJECTORY ENCODER : WRITE CHUNK
+ *********************************************/
+void TrajectoryEncoder::writeChunk()
+{
+   if (pending.empty())
+      return;
+
+   // round every value to its quantum
+   vector<int64_t> quanta[NUM_CHANNELS];
+   for (int channel = 0; channel < NUM_CHANNELS; channel++)
+   {
+      double step = getStep(tolerance, channel);
+      quanta[channel].resize(pending.size());
+      for (size_t i = 0; i < pending.size(); i++)
+      {
+         double value = pending[i].*CHANNELS[channel] / step;
+         assert(fabs(value) < MAX_QUANTA);
+         quanta[channel][i] = llround(value);
+      }
+   }
+
+   vector<char> body;
+   for (int channel = 0; channel < NUM_CHANNELS; channel++)
+      encodeChannel(body, quanta[channel]);
+
+   // the times are kept as they will be read back, so the index and
+   // the samples always agree
+   TrajectoryChunkInfo info;
+   info.shot = (uint32_t)shot;
+   info.numSamples = (uint32_t)pending.size();
+   info.timeBegin = (double)quanta[0].front() * getStep(tolerance, 0);
+   info.timeEnd = (double)quanta[0].back() * getStep(tolerance, 0);
+   info.offset = numBytes;
+   index.push_back(info);
+
+   vector<char> buffer;
+   buffer.push_back(TAG_CHUNK);
+   putU32(buffer, info.shot);
+   putU32(buffer, info.numSamples);
+   putF64(buffer, info.timeBegin);
+   putF64(buffer, info.timeEnd);
+   putU32(buffer, (uint32_t)body.size());
+   buffer.insert(buffer.end(), body.begin(), body.end());
+   put(buffer);
+
+   pending.clear();
+}
+
+/*********************************************
+ * TRAJECTORY ENCODER : FINISH
+ *********************************************/
+void TrajectoryEncoder::finish()
+{
+   if (fFinished)
+      return;
+   writeChunk();
+
+   uint64_t offsetIndex = numBytes;
+   vector<char> buffer;
+   buffer.push_back(TAG_INDEX);
+   putU32(buffer, (uint32_t)index.size());
+   for (const TrajectoryChunkInfo& info : index)
+   {
+      putU32(buffer, info.shot);
+      putU32(buffer, info.numSamples);
+      putF64(buffer, info.timeBegin);
+      putF64(buffer, info.timeEnd);
+      putU64(buffer, info.offset);
+   }
+   putU64(buffer, offsetIndex);
+   buffer.insert(buffer.end(), INDEX_MAGIC, INDEX_MAGIC + 8);
+   put(buffer);
+
+   out.flush();
+   fFinished = true;
+}
+
+/*********************************************
+ * TRAJECTORY ENCODER : PUT
+ *********************************************/
+void TrajectoryEncoder::put(const vector<char>& buffer)
+{
+   out.write(buffer.data(), buffer.size());
+   numBytes += buffer.size();
+}
+
+/*********************************************
+ * READ CHUNK BODY
+ * Everything in a chunk after its tag
+ *********************************************/
+static bool readChunkBody(istream& in, const CodecTolerance& tolerance,
+                          TrajectoryChunk& chunk, string& error)
+{
+   uint32_t shot;
+   uint32_t numSamples;
+   double timeBegin;
+   double timeEnd;
+   uint32_t size;
+   if (!readU32(in, shot) || !readU32(in, numSamples) ||
+       !readF64(in, timeBegin) || !readF64(in, timeEnd) || !readU32(in, size))
+   {
+      error = "the file ends in the middle of a chunk";
+      return false;
+   }
+
+   // a chunk never takes more than two whole varints a value
+   if (numSamples == 0 || shot > INT32_MAX ||
+       size > (uint64_t)numSamples * NUM_CHANNELS * 2 * 10 + NUM_CHANNELS * 2)
+   {
+      error = "chunk of shot " + to_string(shot) + " is corrupt";
+      return false;
+   }
+
+   vector<unsigned char> bytes(size);
+   if (!in.read((char*)bytes.data(), size))
+   {
+      error = "the file ends in the middle of a chunk";
+      return false;
+   }
+
+   ByteReader reader(bytes);
+   vector<int64_t> quanta(numSamples);
+   chunk.shot = (int)shot;
+   chunk.samples.resize(numSamples);
+   for (int channel = 0; channel < NUM_CHANNELS; channel++)
+   {
+      if (!decodeChannel(reader, quanta))
+      {
+         error = "chunk of shot " + to_string(shot) + " is corrupt";
+         return false;
+      }
+      double step = getStep(tolerance, channel);
+      for (uint32_t i = 0; i < numSamples; i++)
+         chunk.samples[i].*CHANNELS[channel] = (double)quanta[i] * step;
+   }
+   if (!reader.isDone())
+   {
+      error = "chunk of shot " + to_string(shot) + " is corrupt";
+      return false;
+   }
+   return true;
+}
+
+/*********************************************
+ * TRAJECTORY DECODER : OPEN
+ *********************************************/
+bool TrajectoryDecoder::open(string& error)
+{
+   char magic[8];
+   uint32_t version;
+   if (!in.read(magic, 8) || memcmp(magic, TRAJ_MAGIC, 8) != 0 || !readU32(in, version))
+   {
+      error = "not a trajectory file";
+      return false;
+   }
+   if (version != TRAJ_VERSION)
+   {
+      error = "version " + to_string(version) + " is not supported";
+      return false;
+   }
+   if (!readF64(in, tolerance.time) || !readF64(in, tolerance.position) ||
+       !readF64(in, tolerance.velocity) ||
+       !(tolerance.time > 0.0 && tolerance.position > 0.0 && tolerance.velocity > 0.0))
+   {
+      error = "the header is cut short";
+      return false;
+   }
+   return true;
+}
+
+/*********************************************
+ * TRAJECTORY DECODER : READ CHUNK
+ *********************************************/
+bool TrajectoryDecoder::readChunk(TrajectoryChunk& chunk, string& error)
+{
+   error.clear();
+   int tag = in.get();
+   if (tag == EOF || tag == TAG_INDEX)
+      return false;
+   if (tag != TAG_CHUNK)
+   {
+      error = "not a chunk";
+      return false;
+   }
+   return readChunkBody(in, tolerance, chunk, error);
+}
+
+/*********************************************
+ * TRAJECTORY DECODER : READ CHUNK AT
+ *********************************************/
+bool TrajectoryDecoder::readChunkAt(const TrajectoryChunkInfo& info,
+                                    TrajectoryChunk& chunk, string& error)
+{
+   in.clear();
+   in.seekg((streamoff)info.offset);
+   if (in.get() != TAG_CHUNK)
+   {
+      error = "the index does not point at a chunk";
+      return false;
+   }
+   return readChunkBody(in, tolerance, chunk, error);
+}
+
+/*********************************************
+ * TRAJECTORY DECODER : READ INDEX
+ * The last 16 bytes say where it starts
+ *********************************************/
+bool TrajectoryDecoder::readIndex(string& error)
+{
+   uint64_t offsetIndex;
+   char magic[8];
+   uint32_t numChunks;
+   in.clear();
+   in.seekg(-16, ios::end);
+   if (!readU64(in, offsetIndex) || !in.read(magic, 8) ||
+       memcmp(magic, INDEX_MAGIC, 8) != 0)
+   {
+      error = "the file has no index. Was it finished?";
+      return false;
+   }
+
+   in.seekg((streamoff)offsetIndex);
+   if (in.get() != TAG_INDEX || !readU32(in, numChunks))
+   {
+      error = "the index is corrupt";
+      return false;
+   }
+
+   index.clear();
+   for (uint32_t i = 0; i < numChunks; i++)
+   {
+      TrajectoryChunkInfo info;
+      if (!readU32(in, info.shot) || !readU32(in, info.numSamples) ||
+          !readF64(in, info.timeBegin) || !readF64(in, info.timeEnd) ||
+          !readU64(in, info.offset) || info.offset >= offsetIndex)
+      {
+         error = "the index is corrupt";
+         return false;
+      }
+      index.push_back(info);
+   }
+
+   // by shot, then time. Chunks of a shot stay in the order written
+   stable_sort(index.begin(), index.end(),
+               [](const TrajectoryChunkInfo& lhs, const TrajectoryChunkInfo& rhs)
+               {
+                  return lhs.shot < rhs.shot ||
+                         (lhs.shot == rhs.shot && lhs.timeBegin < rhs.timeBegin);
+               });
+   fIndexed = true;
+   return true;
+}
+
+/*********************************************
+ * TRAJECTORY DECODER : READ SHOT
+ *********************************************/
+bool TrajectoryDecoder::readShot(int shot, vector<TrajectorySample>& samples,
+                                 string& error)
+{
+   assert(fIndexed);
+   samples.clear();
+   bool fFound = false;
+   auto it = lower_bound(index.begin(), index.end(), (uint32_t)shot,
+                         [](const TrajectoryChunkInfo& info, uint32_t shot)
+                         {
+                            return info.shot < shot;
+                         });
+   for (; it != index.end() && it->shot == (uint32_t)shot; ++it)
+   {
+      TrajectoryChunk chunk;
+      if (!readChunkAt(*it, chunk, error))
+         return false;
+      samples.insert(samples.end(), chunk.samples.begin(), chunk.samples.end());
+      fFound = true;
+   }
+   if (!fFound)
+      error = "there is no shot " + to_string(shot);
+   return fFound;
+}
+
+/*********************************************
+ * TRAJECTORY DECODER : SAMPLE AT
+ * Only the chunk holding the time is read, and the next one when the
+ * time falls between the two
+ *********************************************/
+bool TrajectoryDecoder::sampleAt(int shot, double time, TrajectorySample& sample,
+                                 string& error)
+{
+   assert(fIndexed);
+   auto itBegin = lower_bound(index.begin(), index.end(), (uint32_t)shot,
+                              [](const TrajectoryChunkInfo& info, uint32_t shot)
+                              {
+                                 return info.shot < shot;
+                              });
+   auto itEnd = upper_bound(itBegin, index.end(), (uint32_t)shot,
+                            [](uint32_t shot, const TrajectoryChunkInfo& info)
+                            {
+                               return shot < info.shot;
+                            });
+   if (itBegin == itEnd)
+   {
+      error = "there is no shot " + to_string(shot);
+      return false;
+   }
+
+   // the first chunk starting after the time, and the one before it
+   auto itNext = upper_bound(itBegin, itEnd, time,
+                             [](double time, const TrajectoryChunkInfo& info)
+                             {
+                                return time < info.timeBegin;
+                             });
+   if (itNext == itBegin || (itNext == itEnd && time > prev(itNext)->timeEnd))
+   {
+      error = "shot " + to_string(shot) + " was not flying at " + to_string(time) + "s";
+      return false;
+   }
+
+   TrajectoryChunk chunk;
+   if (!readChunkAt(*prev(itNext), chunk, error))
+      return false;
+
+   // the samples on either side
+   auto itAfter = upper_bound(chunk.samples.begin(), chunk.samples.end(), time,
+                              [](double time, const TrajectorySample& sample)
+                              {
+                                 return time < sample.t;
+                              });
+   TrajectorySample before = *prev(itAfter);
+   TrajectorySample after = before;
+   if (itAfter != chunk.samples.end())
+      after = *itAfter;
+   else if (time > before.t)
+   {
+      TrajectoryChunk chunkNext;
+      if (!readChunkAt(*itNext, chunkNext, error))
+         return false;
+      after = chunkNext.samples.front();
+   }
+
+   double fraction = (after.t > before.t) ? (time - before.t) / (after.t - before.t) : 0.0;
+   for (int channel = 0; channel < NUM_CHANNELS; channel++)
+      sample.*CHANNELS[channel] = before.*CHANNELS[channel] +
+         fraction * (after.*CHANNELS[channel] - before.*CHANNELS[channel]);
+   sample.t = time;
+   return true;
+}
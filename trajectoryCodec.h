@@ -0,0 +1,169 @@
+/***********************************************************************
+ * Header File:
+ *    TRAJECTORY CODEC
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    Store whole trajectories, thousands of shots of them, in a small
+ *    fraction of the 40 bytes a sample takes as doubles. Every value is
+ *    rounded to a multiple of twice its tolerance, so it comes back no
+ *    further off than the tolerance. A shell's path is smooth, so each
+ *    rounded value is predicted from the ones before it and only the
+ *    small difference is kept, packed into as few bits as the chunk
+ *    needs.
+ *
+ *    The samples go into chunks of up to CODEC_CHUNK from one shot.
+ *    A chunk starts over from its own first samples, so any one can be
+ *    decoded without the others, and an index at the end of the file
+ *    says where each one is. The file can be read a chunk at a time
+ *    from the front, or jumped into with the index.
+ *
+ *    A trajectory file is little-endian:
+ *       "M777TRAJ"  u32 version  f64 tolerance for t, x and y, dx and dy
+ *    then chunks:
+ *       'C'  u32 shot  u32 samples  f64 first t  f64 last t  u32 bytes
+ *       then for each of t, x, y, dx, dy:
+ *          u8 order  u8 bits  order zigzag varints for the first samples
+ *          then a bits wide difference for each of the rest
+ *    then the index:
+ *       'I'  u32 chunks
+ *       u32 shot  u32 samples  f64 first t  f64 last t  u64 offset  (each)
+ *       u64 offset of the index  "M777TIDX"
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <cstdint>        // for uint32_t and uint64_t
+#include "trajectory.h"   // for TrajectorySample
+
+#define CODEC_CHUNK     256   // samples in a chunk, at most
+#define CODEC_MAX_ORDER 3     // up to the change in acceleration
+
+/*********************************************
+ * CODEC TOLERANCE
+ * How far off a value may come back
+ *********************************************/
+struct CodecTolerance
+{
+   CodecTolerance() : time(1.0e-6), position(0.01), velocity(0.001) {}
+   CodecTolerance(double time, double position, double velocity) :
+      time(time), position(position), velocity(velocity) {}
+
+   double time;       // s
+   double position;   // m, for x and y
+   double velocity;   // m/s, for dx and dy
+};
+
+/*********************************************
+ * TRAJECTORY CHUNK
+ * Samples from one shot, in order of time
+ *********************************************/
+struct TrajectoryChunk
+{
+   TrajectoryChunk() : shot(0) {}
+
+   int shot;
+   std::vector<TrajectorySample> samples;
+};
+
+/*********************************************
+ * TRAJECTORY CHUNK INFO
+ * One line of the index
+ *********************************************/
+struct TrajectoryChunkInfo
+{
+   uint32_t shot;
+   uint32_t numSamples;
+   double timeBegin;   // s, of the first sample
+   double timeEnd;     // s, of the last
+   uint64_t offset;    // bytes from the start of the file
+};
+
+/*********************************************
+ * TRAJECTORY ENCODER
+ * Write samples as they come. A chunk is written when it fills or the
+ * shot changes, so memory holds no more than one chunk, and a crash
+ * loses no more than the chunk in progress and the index
+ *********************************************/
+class TrajectoryEncoder
+{
+public:
+   // writes the header right away
+   TrajectoryEncoder(std::ostream& out,
+                     const CodecTolerance& tolerance = CodecTolerance(),
+                     int chunk = CODEC_CHUNK);
+   ~TrajectoryEncoder() { finish(); }
+
+   // one more sample of a shot, later than the last one of that shot
+   void write(int shot, const TrajectorySample& sample);
+
+   // every sample of a shot
+   void write(int shot, const Trajectory& trajectory);
+
+   // write the chunk in progress, the index and the end of the file.
+   // Nothing more can be written after
+   void finish();
+
+   long long getNumSamples() const { return numSamples; }
+   uint64_t  getNumBytes()   const { return numBytes;   }
+
+private:
+   void writeChunk();
+   void put(const std::vector<char>& buffer);
+
+   std::ostream& out;
+   CodecTolerance tolerance;
+   int chunk;                                // samples in a full chunk
+   int shot;                                 // of the chunk in progress
+   std::vector<TrajectorySample> pending;    // the chunk in progress
+   std::vector<TrajectoryChunkInfo> index;   // of every chunk written
+   long long numSamples;
+   uint64_t numBytes;                        // written so far
+   bool fFinished;
+};
+
+/*********************************************
+ * TRAJECTORY DECODER
+ * Read a trajectory file from the front a chunk at a time, or read its
+ * index and go straight to a shot at a time
+ *********************************************/
+class TrajectoryDecoder
+{
+public:
+   TrajectoryDecoder(std::istream& in) : in(in), fIndexed(false) {}
+
+   // the header. Call this first
+   bool open(std::string& error);
+
+   // the next chunk in the file. False at the index, or at the end of a
+   // file that was never finished, with error empty. False with error
+   // set if the chunk is not all there
+   bool readChunk(TrajectoryChunk& chunk, std::string& error);
+
+   // the index from the end of the file. The stream must be able to seek
+   bool readIndex(std::string& error);
+
+   // every sample of a shot. Needs the index
+   bool readShot(int shot, std::vector<TrajectorySample>& samples,
+                 std::string& error);
+
+   // where a shot was at a time, in a straight line between the samples
+   // on either side. Needs the index
+   bool sampleAt(int shot, double time, TrajectorySample& sample,
+                 std::string& error);
+
+   const CodecTolerance& getTolerance() const { return tolerance; }
+   const std::vector<TrajectoryChunkInfo>& getIndex() const { return index; }
+
+private:
+   bool readChunkAt(const TrajectoryChunkInfo& info, TrajectoryChunk& chunk,
+                    std::string& error);
+
+   std::istream& in;
+   CodecTolerance tolerance;
+   std::vector<TrajectoryChunkInfo> index;   // by shot, then by time
+   bool fIndexed;
+};
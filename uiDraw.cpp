@@ -14,6 +14,7 @@
 #include <sstream>    // convert an integer into text
 #include <cassert>    // I feel the need... the need for asserts
 #include <time.h>     // for clock
+#include <cstring>    // for memmove
 
 
 #ifdef __APPLE__
@@ -39,11 +40,13 @@
 #endif // _WIN32
 
 #include "position.h"
+#include "angle.h"
 #include "uiDraw.h"
 
 using namespace std;
 
-Position rotatePosition(const Position& origin, double x, double y, double rotation);
+Position rotatePosition(const View& view, const Position& origin,
+                        double x, double y, double sinA, double cosA);
 
 
 /*************************************************************************
@@ -75,9 +78,9 @@ inline void glResetColor()
  * GL VERTEXT POINT
  * Just a more convenient format of glVertext2f
  *************************************************************************/
-inline void glVertexPoint(const Position & pos)
+inline void glVertexPoint(const View & view, const Position & pos)
 {
-   glVertex2f((GLfloat)pos.getPixelsX(), (GLfloat)pos.getPixelsY());
+   glVertex2f((GLfloat)view.getPixelsX(pos), (GLfloat)view.getPixelsY(pos));
 }
 
 /*************************************************************************
@@ -85,31 +88,76 @@ inline void glVertexPoint(const Position & pos)
  *************************************************************************/
 void ogstream :: flush()
 {
-   string sOut;
-   string sIn = str();
+   drawLines(true /*fPartial*/);
+}
+
+/*************************************************************************
+ * DRAW LINES
+ * Each line is drawn straight out of the arena: the newline is replaced
+ * with a null so drawText() can read it in place. No copies are made.
+ *    INPUT  fPartial  Draw the trailing text that has no newline yet?
+ *************************************************************************/
+void ogstream :: drawLines(bool fPartial)
+{
+   char * pEnd  = buffer.end();
+   char * pLine = buffer.begin();
 
-   // copy everything but the newlines
-   for (string::iterator it = sIn.begin(); it != sIn.end(); ++it)
-      // newline triggers an buffer flush and a move down
-      if (*it == '\n')
+   // newline triggers a draw and a move down
+   for (char * p = pLine; p != pEnd; ++p)
+      if (*p == '\n')
       {
-         drawText(pos, sOut.c_str());
-         sOut.clear();
-         pos.addPixelsY(-18);
+         *p = '\0';
+         drawText(pos, pLine);
+         pos = view.offset(pos, 0.0, -18.0);
+         pLine = p + 1;
       }
-      // othewise append
-      else
-         sOut += *it;
 
-   // put the text on the screen
-   if (!sOut.empty())
+   // a line longer than the arena has to be drawn in pieces
+   if (pLine == buffer.begin())
+      fPartial = true;
+
+   // put the remaining text on the screen
+   if (fPartial && pLine != pEnd)
    {
-      drawText(pos, sOut.c_str());
-      pos.addPixelsY(-18);
+      *pEnd = '\0';
+      drawText(pos, pLine);
+      pos = view.offset(pos, 0.0, -18.0);
+      pLine = pEnd;
    }
    
-   // reset the buffer
-   str("");
+   // reset the buffer, keeping any text still waiting for its newline
+   buffer.reset(pLine, pEnd);
+}
+
+/*************************************************************************
+ * TEXT ARENA : RESET
+ * Start over, moving the text in [begin, end) to the front of the arena
+ *************************************************************************/
+void ogstreambuf :: reset(const char * begin, const char * end)
+{
+   assert(arena <= begin && begin <= end && end <= arena + sizeof(arena));
+   std::ptrdiff_t length = end - begin;
+   std::memmove(arena, begin, length);
+   reset();
+   pbump((int)length);
+}
+
+/*************************************************************************
+ * TEXT ARENA : OVERFLOW
+ * The arena is full. Draw the lines we have so far and make room.
+ *************************************************************************/
+ogstreambuf::int_type ogstreambuf :: overflow(int_type ch)
+{
+   assert(pOwner != nullptr);
+   pOwner->drawLines(false /*fPartial*/);
+   assert(pptr() < epptr());
+
+   if (!traits_type::eq_int_type(ch, traits_type::eof()))
+   {
+      *pptr() = traits_type::to_char_type(ch);
+      pbump(1);
+   }
+   return traits_type::not_eof(ch);
 }
 
 /*************************************************************************
@@ -123,7 +171,7 @@ void ogstream :: drawText(const Position & topLeft, const char * text)
    void *pFont = GLUT_TEXT;
 
    // prepare to draw the text from the top-left corner
-   glRasterPos2f((GLfloat)topLeft.getPixelsX(), (GLfloat)topLeft.getPixelsY());
+   glRasterPos2f((GLfloat)view.getPixelsX(topLeft), (GLfloat)view.getPixelsY(topLeft));
 
    // loop through the text
    for (const char *p = text; *p; p++)
@@ -142,12 +190,8 @@ void ogstream :: drawProjectile(const Position& pos, double age)
 
    GLfloat color = (GLfloat)(age / tailLength);
    
-   Position posBegin;
-   Position posEnd;
-   posBegin.setPixelsX(pos.getPixelsX() - 1.5);
-   posBegin.setPixelsY(pos.getPixelsY() - 1.5);
-   posEnd.setPixelsX(pos.getPixelsX() + 1.5);
-   posEnd.setPixelsY(pos.getPixelsY() + 1.5);
+   Position posBegin = view.fromPixels(view.getPixelsX(pos) - 1.5, view.getPixelsY(pos) - 1.5);
+   Position posEnd   = view.fromPixels(view.getPixelsX(pos) + 1.5, view.getPixelsY(pos) + 1.5);
    drawRectangle(posBegin, posEnd, color /* red % */, color /* green % */, color /* blue % */);
 }
 
@@ -166,8 +210,8 @@ void ogstream :: drawLine(const Position & begin, const Position & end,
    glColor3f((GLfloat)red, (GLfloat)green, (GLfloat)blue);
 
    // Draw the actual line
-   glVertexPoint(begin);
-   glVertexPoint(end);
+   glVertexPoint(view, begin);
+   glVertexPoint(view, end);
 
    // Complete drawing
    glResetColor();
@@ -198,22 +242,43 @@ void drawQuad(const Quad & quad)
 
 /************************************************************************
 * DRAW QUAD
-* Draw a quad on the screen from the beginning to the end.
-*   INPUT QUAD
+* Draw a quad rotated around a point using whichever backend gout is.
+*   INPUT gout
+*         QUAD
 *         posRotate
-*         angle
+*         sinA, cosA   of the angle to rotate by
 *************************************************************************/
-void drawQuad(const Quad& quad, const Position posRotate, double angle)
+void drawQuad(ogstream & gout, const Quad& quad, const Position posRotate,
+              double sinA, double cosA)
+{
+   Position points[4] =
+   {
+      rotatePosition(gout.getView(), posRotate, quad.pt1.x, quad.pt1.y, sinA, cosA),
+      rotatePosition(gout.getView(), posRotate, quad.pt2.x, quad.pt2.y, sinA, cosA),
+      rotatePosition(gout.getView(), posRotate, quad.pt3.x, quad.pt3.y, sinA, cosA),
+      rotatePosition(gout.getView(), posRotate, quad.pt4.x, quad.pt4.y, sinA, cosA)
+   };
+
+   gout.drawPolygon(points, 4, quad.r, quad.g, quad.b);
+}
+
+/************************************************************************
+* DRAW POLYGON
+* Draw a filled convex polygon on the screen.
+*   INPUT  points    The corners, in order
+*          num       How many corners there are
+*          r/g/b     The color of the polygon
+*************************************************************************/
+void ogstream :: drawPolygon(const Position points[], int num,
+                             double red, double green, double blue)
 {
    // Get ready...
-   glBegin(GL_QUADS);
-   glColor3f(quad.r, quad.g, quad.b);
+   glBegin(GL_POLYGON);
+   glColor3f((GLfloat)red, (GLfloat)green, (GLfloat)blue);
 
-   // Draw the actual line
-   glVertexPoint(rotatePosition(posRotate, quad.pt1.x, quad.pt1.y, angle));
-   glVertexPoint(rotatePosition(posRotate, quad.pt2.x, quad.pt2.y, angle));
-   glVertexPoint(rotatePosition(posRotate, quad.pt3.x, quad.pt3.y, angle));
-   glVertexPoint(rotatePosition(posRotate, quad.pt4.x, quad.pt4.y, angle));
+   // Draw the corners
+   for (int i = 0; i < num; i++)
+      glVertexPoint(view, points[i]);
 
    // Complete drawing
    glResetColor();
@@ -232,10 +297,10 @@ void ogstream :: drawRectangle(const Position & begin, const Position & end,
 {
    Quad quad =
    {
-      {(GLfloat)begin.getPixelsX(), (GLfloat)begin.getPixelsY()},
-      {(GLfloat)begin.getPixelsX(), (GLfloat)end.getPixelsY()},
-      {(GLfloat)end.getPixelsX(),   (GLfloat)end.getPixelsY()},
-      {(GLfloat)end.getPixelsX(),   (GLfloat)begin.getPixelsY()},
+      {(GLfloat)view.getPixelsX(begin), (GLfloat)view.getPixelsY(begin)},
+      {(GLfloat)view.getPixelsX(begin), (GLfloat)view.getPixelsY(end)},
+      {(GLfloat)view.getPixelsX(end),   (GLfloat)view.getPixelsY(end)},
+      {(GLfloat)view.getPixelsX(end),   (GLfloat)view.getPixelsY(begin)},
       (GLfloat)red, (GLfloat)green, (GLfloat)blue
    };
 
@@ -252,19 +317,14 @@ void ogstream :: drawTarget(const Position& pos)
 {
    double size = 10.0;
 
-   // set up to draw a solid rectangle
-   glBegin(GL_QUADS);
-   glColor3f((GLfloat)0.2 /* red % */, (GLfloat)0.75 /* green % */, (GLfloat)0.2 /* blue % */);
-
    // specify the corners
-   glVertex2f((GLfloat)(pos.getPixelsX() - size/2.0), (GLfloat)(pos.getPixelsY() - size/2.0));
-   glVertex2f((GLfloat)(pos.getPixelsX() - size/2.0), (GLfloat)(pos.getPixelsY() + size/2.0));
-   glVertex2f((GLfloat)(pos.getPixelsX() + size/2.0), (GLfloat)(pos.getPixelsY() + size/2.0));
-   glVertex2f((GLfloat)(pos.getPixelsX() + size/2.0), (GLfloat)(pos.getPixelsY() - size/2.0));
+   Position posBegin = view.fromPixels(view.getPixelsX(pos) - size / 2.0,
+                                       view.getPixelsY(pos) - size / 2.0);
+   Position posEnd   = view.fromPixels(view.getPixelsX(pos) + size / 2.0,
+                                       view.getPixelsY(pos) + size / 2.0);
 
-   // done
-   glResetColor();
-   glEnd();
+   // draw a solid rectangle
+   drawRectangle(posBegin, posEnd, 0.2 /* red % */, 0.75 /* green % */, 0.2 /* blue % */);
 }
 
 /***********************************************************************
@@ -319,62 +379,56 @@ void ogstream :: drawHowitzer(const Position & pos, double angle, double age)
       { { -2,20}, { 2,20} }      // most intense
    };
 
+   // one sine and cosine for every point of the barrel and the flash
+   Angle rotation;
+   rotation.setRadians(angle);
+   double sinA = rotation.getDx();
+   double cosA = rotation.getDy();
+
    // Draw the base
    for (int i = 0; i < sizeof(baseLeft) / sizeof(Quad); i++)
       if (angle <= 0.0)
-         drawQuad(baseLeft[i],  pos, 0.0);
+         drawQuad(*this, baseLeft[i],  pos, 0.0, 1.0);
       else
-         drawQuad(baseRight[i], pos, 0.0);
+         drawQuad(*this, baseRight[i], pos, 0.0, 1.0);
 
    // Draw the muzzle
    for (int i = 0; i < sizeof(muzzle) / sizeof(Quad); i++)
-      drawQuad(muzzle[i], pos, angle);
+      drawQuad(*this, muzzle[i], pos, sinA, cosA);
 
    // Now for the muzzle flash
    if (age >= 0.0 && age < 2.0) // flash duration in seconds
    { 
       // draw the muzzle flash
-      glBegin(GL_LINES);
-
       for (int i = 0; i < 10; i++)
       {
-         GLfloat color = (GLfloat)((10.0 - (double)i) / 10.0);
-         glColor3f(1.0 /* red % */, (GLfloat)color /* green % */, (GLfloat)color /* blue % */);
-         glVertexPoint(rotatePosition(pos, pointsMuzzleFlash[i][0].x,
-                                           pointsMuzzleFlash[i][0].y, angle));
-         glVertexPoint(rotatePosition(pos, pointsMuzzleFlash[i][1].x,
-                                           pointsMuzzleFlash[i][1].y, angle));
+         double color = (10.0 - (double)i) / 10.0;
+         drawLine(rotatePosition(view, pos, pointsMuzzleFlash[i][0].x,
+                                 pointsMuzzleFlash[i][0].y, sinA, cosA),
+                  rotatePosition(view, pos, pointsMuzzleFlash[i][1].x,
+                                 pointsMuzzleFlash[i][1].y, sinA, cosA),
+                  1.0 /* red % */, color /* green % */, color /* blue % */);
       }
-
-      // complete drawing of the muzzle flash
-      glResetColor();
-      glEnd();
    }
 }
 
 /************************************************************************
  * ROTATE
  * Rotate a given point (point) around a given origin (center) by a given
- * number of degrees (angle).
- *    INPUT  origin   The center point we will rotate around
+ * angle. Sine and cosine are expensive, so the caller works them out
+ * once for every point it rotates by the same angle.
+ *    INPUT  view     The zoom that x and y are measured in
+ *           origin   The center point we will rotate around
  *           x,y      Offset from center that we will be rotating
- *           rotation Rotation in degrees
+ *           sinA     Sine of the rotation
+ *           cosA     Cosine of the rotation
  *    OUTPUT point    The new position
  *************************************************************************/
-Position rotatePosition(const Position& origin, double x, double y, double rotation)
+Position rotatePosition(const View& view, const Position& origin,
+                        double x, double y, double sinA, double cosA)
 {
-   // because sine and cosine are expensive, we want to call them only once
-   double cosA = cos(rotation);
-   double sinA = sin(rotation);
-
-   // start with our original point
-   Position posReturn(origin);
-   
-   // find the new values
-   posReturn.addPixelsX(x * cosA + y * sinA);
-   posReturn.addPixelsY(y * cosA - x * sinA);
-
-   return posReturn;
+   // offset the original point by the rotated pixels
+   return view.offset(origin, x * cosA + y * sinA, y * cosA - x * sinA);
 }
 
 /******************************************************************
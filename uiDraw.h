@@ -16,31 +16,64 @@
 #include <cmath>      // for M_PI, sin() and cos()
 #include <algorithm>  // used for min() and max()
 #include "position.h" // Where things are drawn
+#include "view.h"     // How meters become pixels
 using std::string;
 using std::min;
 using std::max;
 
+#include <ostream>
+
+class ogstream;
+
+#define TEXT_ARENA_SIZE 256   // bytes of text an ogstream holds before drawing it
+
 /*************************************************************************
- * DRAW TEXT
- * Draw text using a simple bitmap font
- ************************************************************************/
+ * TEXT ARENA
+ * A fixed-size stream buffer holding the text for one ogstream. Nothing
+ * here touches the heap: when the arena fills up, the text so far is
+ * handed to the owning ogstream to be drawn and the arena starts over.
+ *************************************************************************/
+class ogstreambuf : public std::streambuf
+{
+public:
+   ogstreambuf(ogstream * pOwner) : pOwner(pOwner) { reset(); }
 
+   // discard whatever has been written
+   void reset() { setp(arena, arena + sizeof(arena) - 1); }
+   void reset(const char * begin, const char * end);
 
-#include <sstream>
+   // the text written since the last reset. There is always room
+   // for a null terminator after end()
+   char * begin() const { return pbase(); }
+   char * end()   const { return pptr();  }
+
+protected:
+   int_type overflow(int_type ch);
+
+private:
+   ogstream * pOwner;      // who draws the text when we run out of room
+   char arena[TEXT_ARENA_SIZE];   // room for every HUD message in a frame
+};
 
 /*************************************************************************
  * GRAPHICS STREAM
  * A graphics stream that behaves much like COUT except on a drawn screen
  *************************************************************************/
-class ogstream : public std::ostringstream
+class ogstream : public std::ostream
 {
 public:
-   ogstream()                    : pos()    {          }
-   ogstream(const Position& pos) : pos(pos) {          }
-   ~ogstream()                              { flush(); }
+   ogstream()                    : std::ostream(&buffer), view(),     buffer(this), pos() {          }
+   ogstream(const View& view)    : std::ostream(&buffer), view(view), buffer(this), pos() {          }
+   ogstream(const View& view, const Position& pos) :
+      std::ostream(&buffer), view(view), buffer(this), pos(pos)                           {          }
+   virtual ~ogstream()                                                                    { flush(); }
+
+   // the zoom and window size everything is drawn with
+   const View& getView() const { return view; }
    
    // Methods specific to drawing text on the screen
    virtual void flush();
+   void discard() { buffer.reset(); }
    void setPosition(const Position& pos) { flush(); this->pos = pos; }
    ogstream& operator = (const Position& pos)
    {
@@ -53,12 +86,20 @@ public:
                  double red = 0.0, double green = 0.0, double blue = 0.0);
    virtual void drawRectangle(const Position & begin, const Position & end,
                       double red = 0.0, double green = 0.0, double blue = 0.0);
+   virtual void drawPolygon(const Position points[], int num,
+                            double red = 0.0, double green = 0.0, double blue = 0.0);
    virtual void drawProjectile(const Position& pos, double age = 0.0);
    virtual void drawHowitzer(const Position & pos, double angle, double age);
    virtual void drawTarget(const Position& pos);
    virtual void drawText(const Position & topLeft, const char * text);
+protected:
+   View view;
+
 private:
-   
+   friend ogstreambuf;
+   void drawLines(bool fPartial);
+
+   ogstreambuf buffer;
    Position pos;
 };
 
@@ -75,6 +116,27 @@ double random(double min, double max);
 
 #include <cassert>
 
+/*************************************************************************
+ * GRAPHICS STREAM NULL
+ * Does all the work of drawing except putting anything anywhere. For
+ * running the game without a window
+ *************************************************************************/
+class ogstreamNull : public ogstream
+{
+public:
+   ogstreamNull(const View& view) : ogstream(view) {          }
+   ~ogstreamNull()                                 { flush(); }
+   using ogstream::operator =;
+
+   void drawLine(const Position& begin, const Position& end,
+      double red = 0.0, double green = 0.0, double blue = 0.0)               {          }
+   void drawRectangle(const Position& begin, const Position& end,
+      double red = 0.0, double green = 0.0, double blue = 0.0)               {          }
+   void drawPolygon(const Position points[], int num,
+      double red = 0.0, double green = 0.0, double blue = 0.0)               {          }
+   void drawText(const Position& topLeft, const char* text)                  {          }
+};
+
 /*************************************************************************
  * GRAPHICS STREAM DUMMY
  * A dummy graphics scream provided for the purpose of creating unit tests
@@ -83,12 +145,14 @@ class ogstreamDummy : public ogstream
 {
 public:
    ogstreamDummy()  {          }
-   ~ogstreamDummy() { str(""); }
+   ~ogstreamDummy() { discard(); }
    void flush()                                                              { assert(false); }
    void drawLine(const Position& begin, const Position& end,
       double red = 0.0, double green = 0.0, double blue = 0.0)               { assert(false); }
    void drawRectangle(const Position& begin, const Position& end,
       double red = 0.0, double green = 0.0, double blue = 0.0)               { assert(false); }
+   void drawPolygon(const Position points[], int num,
+      double red = 0.0, double green = 0.0, double blue = 0.0)               { assert(false); }
    void drawProjectile(const Position& pos, double age = 0.0)                { assert(false); }
    void drawHowitzer(const Position& pos, double angle, double age)          { assert(false); }
    void drawTarget(const Position& pos)                                      { assert(false); }
@@ -13,8 +13,11 @@
 #include <string>     // need you ask?
 #include <sstream>    // convert an integer into text
 #include <cassert>    // I feel the need... the need for asserts
-#include <time.h>     // for clock
+#include <time.h>     // for time
 #include <cstdlib>    // for rand()
+#include <chrono>     // for steady_clock
+#include <thread>     // for sleep_until()
+#include <cmath>      // for llround()
 
 
 #ifdef __APPLE__
@@ -32,7 +35,6 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <Gl/glut.h>           // OpenGL library we copied
-#include <ctime>            // for ::Sleep();
 #include <Windows.h>
 
 #define _USE_MATH_DEFINES
@@ -45,34 +47,6 @@
 using namespace std;
 
 
-/*********************************************************************
- * SLEEP
- * Pause for a while.  We want to put the program to sleep until it
- * is time to draw again.  Note that this requires us to tell the OS
- * that we are idle.  the nanosleep function performs this task for us
- *   INPUT: msSleep: sleep time in milliseconds
- *********************************************************************/
-void sleep(unsigned long msSleep)
-{
-   // Windows handles sleep one way
-#ifdef _WIN32
-   ::Sleep(msSleep + 35);
-
-   // Unix-based operating systems (OS-X, Linux) do it another
-#else // LINUX, XCODE
-   timespec req = {};
-   time_t sec = (int)(msSleep / 1000);
-   msSleep -= (sec * 1000);
-
-   req.tv_sec = sec;
-   req.tv_nsec = msSleep * 1000000L;
-
-   while (nanosleep(&req, &req) == -1)
-      ;
-#endif // LINUX, XCODE
-   return;
-}
-
 /************************************************************************
  * DRAW CALLBACK
  * This is the main callback from OpenGL. It gets called constantly by
@@ -87,6 +61,8 @@ void drawCallback()
 {
    // even though this is a local variable, all the members are static
    Interface ui;
+   ui.beginFrame();
+
    // Prepare the background buffer for drawing
    glClear(GL_COLOR_BUFFER_BIT); //clear the screen
    glColor3f((GLfloat)0.0 /* red % */, (GLfloat)0.0 /* green % */, (GLfloat)0.0 /* blue % */);
@@ -95,16 +71,20 @@ void drawCallback()
    assert(ui.callBack != NULL);
    ui.callBack(&ui, ui.p);
    
-   //loop until the timer runs out
+   // sleep until the deadline. Sleeping until an absolute time means
+   // oversleeping one frame does not push back every frame after it
+   chrono::steady_clock::time_point timeCallback = chrono::steady_clock::now();
    if (!ui.isTimeToDraw())
-      sleep((unsigned long)((ui.getNextTick() - clock()) / 1000));
-
-   // from this point, set the next draw time
-   ui.setNextDrawTime();
+      this_thread::sleep_until(ui.getNextDrawTime());
+   chrono::steady_clock::time_point timeSwap = chrono::steady_clock::now();
 
    // bring forth the background buffer
    glutSwapBuffers();
 
+   // from this point, set the next draw time
+   ui.endFrame(timeCallback, timeSwap);
+   ui.setNextDrawTime();
+
    // clear the space at the end
    ui.keyEvent();
 }
@@ -212,6 +192,37 @@ void Interface::keyEvent()
    isQPress = false;
 }
 
+/***************************************************************
+ * INTERFACE : GET INPUT
+ * The keys held right now as INPUT_ bits
+ ****************************************************************/
+unsigned int Interface::getInput() const
+{
+   return (isUpPress    ? INPUT_UP    : 0) |
+          (isDownPress  ? INPUT_DOWN  : 0) |
+          (isLeftPress  ? INPUT_LEFT  : 0) |
+          (isRightPress ? INPUT_RIGHT : 0) |
+          (isSpacePress ? INPUT_SPACE : 0) |
+          (isQPress     ? INPUT_Q     : 0);
+}
+
+/***************************************************************
+ * INTERFACE : SET INPUT
+ * Press and release keys to match the INPUT_ bits. An arrow that
+ * stays down keeps counting the frames it has been held, the same
+ * as when keyEvent() sees it from the keyboard
+ *   INPUT   keys    which keys are held
+ ****************************************************************/
+void Interface::setInput(unsigned int keys)
+{
+   isUpPress    = (keys & INPUT_UP)    ? max(isUpPress,    1) : 0;
+   isDownPress  = (keys & INPUT_DOWN)  ? max(isDownPress,  1) : 0;
+   isLeftPress  = (keys & INPUT_LEFT)  ? max(isLeftPress,  1) : 0;
+   isRightPress = (keys & INPUT_RIGHT) ? max(isRightPress, 1) : 0;
+   isSpacePress = (keys & INPUT_SPACE) != 0;
+   isQPress     = (keys & INPUT_Q)     != 0;
+}
+
 /************************************************************************
  * INTEFACE : IS TIME TO DRAW
  * Have we waited long enough to draw swap the background buffer with
@@ -219,17 +230,65 @@ void Interface::keyEvent()
  *************************************************************************/
 bool Interface::isTimeToDraw()
 {
-   return ((unsigned int)clock() >= nextTick);
+   return chrono::steady_clock::now() >= nextDraw;
 }
 
 /************************************************************************
  * INTERFACE : SET NEXT DRAW TIME
- * What time should we draw the buffer again?  This is a function of
- * the current time and the frames per second.
+ * What time should we draw the buffer again?  The deadlines are one time
+ * period apart on the wall clock. If we have fallen more than a whole
+ * period behind, we start again from now rather than racing to catch up.
  *************************************************************************/
 void Interface::setNextDrawTime()
 {
-   nextTick = (unsigned int)clock() + static_cast<unsigned int> (timePeriod * CLOCKS_PER_SEC);
+   chrono::steady_clock::duration period =
+      chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(timePeriod));
+   chrono::steady_clock::time_point now = chrono::steady_clock::now();
+
+   nextDraw += period;
+   if (nextDraw < now)
+      nextDraw = now + period;
+}
+
+/************************************************************************
+ * INTERFACE : BEGIN FRAME
+ * Note the time a frame begins
+ *************************************************************************/
+void Interface::beginFrame()
+{
+   chrono::steady_clock::time_point now = chrono::steady_clock::now();
+   stats.frame = stats.frames ? chrono::duration<double>(now - timeFrame).count() : 0.0;
+   stats.worstFrame = max(stats.worstFrame, stats.frame);
+   frameDelta = (double)llround(stats.frame * 1.0e6) / 1.0e6;   // as a replay has it
+   timeFrame = now;
+   timeDraw = now;
+}
+
+/************************************************************************
+ * INTERFACE : END FRAME
+ * The buffers have been swapped. Work out where the time went.
+ *    INPUT  timeCallback  When the client's callback returned
+ *           timeSwap      When we started swapping the buffers
+ *************************************************************************/
+void Interface::endFrame(chrono::steady_clock::time_point timeCallback,
+                         chrono::steady_clock::time_point timeSwap)
+{
+   chrono::steady_clock::time_point now = chrono::steady_clock::now();
+
+   // if the client never called beginDraw(), it was all update
+   if (timeDraw == timeFrame)
+      timeDraw = timeCallback;
+
+   stats.update = chrono::duration<double>(timeDraw     - timeFrame   ).count();
+   stats.draw   = chrono::duration<double>(timeCallback - timeDraw    ).count();
+   stats.sleep  = chrono::duration<double>(timeSwap     - timeCallback).count();
+   stats.swap   = chrono::duration<double>(now          - timeSwap    ).count();
+
+   // the client was still busy when the frame should have been shown.
+   // The first frame has no deadline to miss
+   if (stats.frames > 0 && timeCallback > nextDraw)
+      stats.missed++;
+   stats.frames++;
 }
 
 /************************************************************************
@@ -257,7 +316,12 @@ bool         Interface::isSpacePress = false;
 bool         Interface::isQPress     = false;
 bool         Interface::initialized  = false;
 double       Interface::timePeriod   = 1.0 / 30; // default to 30 frames/second
-unsigned int Interface::nextTick     = 0;        // redraw now please
+chrono::steady_clock::time_point Interface::nextDraw;    // redraw now please
+chrono::steady_clock::time_point Interface::timeFrame;
+chrono::steady_clock::time_point Interface::timeDraw;
+FrameStats   Interface::stats        = {};
+double       Interface::frameDelta   = 0.0;
+unsigned int Interface::seed         = 0;
 void *       Interface::p            = NULL;
 void (*Interface::callBack)(const Interface *, void *) = NULL;
 
@@ -269,20 +333,22 @@ void (*Interface::callBack)(const Interface *, void *) = NULL;
  *  INPUT    argc:       Count of command-line arguments from main
  *           argv:       The actual command-line parameters
  *           title:      The text for the titlebar of the window
+ *           view:       The size of the window in pixels
  *************************************************************************/
-void Interface::initialize(const char * title, const Position & posUpperRight)
+void Interface::initialize(const char * title, const View & view)
 {
    if (initialized)
       return;
    
    // set up the random number generator
-   srand((unsigned int)time(NULL));
+   seed = (unsigned int)time(NULL);
+   srand(seed);
 
    // create the window
    int argc = 0;
    glutInit(&argc, nullptr /*argv*/);
-   glutInitWindowSize((int)posUpperRight.getPixelsX()-1,
-                      (int)posUpperRight.getPixelsY()-1);   // size of the window
+   glutInitWindowSize(view.getWidth() - 1,
+                      view.getHeight() - 1);              // size of the window
             
    glutInitWindowPosition( 10, 10);                // initial position 
    glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGB);    // double buffering
@@ -291,9 +357,9 @@ void Interface::initialize(const char * title, const Position & posUpperRight)
    
    // set up the drawing style: B/W and 2D
    glClearColor(1.0, 1.0, 1.0, 0);            // White is the background color
-   gluOrtho2D(0, (int)posUpperRight.getPixelsX(),    // range of x values: (0, width)
-              0, (int)posUpperRight.getPixelsY());   // range of y values: (0, height)
-   glutReshapeWindow((int)posUpperRight.getPixelsX(), (int)posUpperRight.getPixelsY());
+   gluOrtho2D(0, view.getWidth(),              // range of x values: (0, width)
+              0, view.getHeight());            // range of y values: (0, height)
+   glutReshapeWindow(view.getWidth(), view.getHeight());
 
    // register the callbacks so OpenGL knows how to call us
    glutDisplayFunc(   drawCallback    );
@@ -327,6 +393,9 @@ void Interface::run(void (*callBack)(const Interface *, void *), void *p)
    this->p = p;
    this->callBack = callBack;
 
+   // the first frame is due right away
+   nextDraw = chrono::steady_clock::now();
+
    glutMainLoop();
 
    return;
@@ -17,10 +17,37 @@
 #pragma once
 
 #include "position.h"
+#include "view.h"    // for the size of the window
 #include <algorithm> // used for min() and max() (specifically required by Visual Studio)
+#include <chrono>    // for steady_clock
 using std::min;
 using std::max;
 
+// the keys held during a frame, one bit each, for recording and replay
+#define INPUT_UP     0x01
+#define INPUT_DOWN   0x02
+#define INPUT_LEFT   0x04
+#define INPUT_RIGHT  0x08
+#define INPUT_SPACE  0x10
+#define INPUT_Q      0x20
+
+/********************************************
+ * FRAME STATS
+ * How long the parts of the most recent frame took, in
+ * wall-clock seconds, plus running counts
+ ********************************************/
+struct FrameStats
+{
+   double update;           // client callback before beginDraw()
+   double draw;             // client callback after beginDraw()
+   double sleep;            // waiting for the frame's deadline
+   double swap;             // swapping the buffers
+   double frame;            // start of the previous frame to start of this one
+   double worstFrame;       // the longest frame so far
+   unsigned long frames;    // frames drawn so far
+   unsigned long missed;    // frames that finished after their deadline
+};
+
 /********************************************
  * INTERFACE
  * All the data necessary to keep our graphics
@@ -33,9 +60,9 @@ public:
 
    // Constructor if you want to set up the window with anything but
    // the default parameters
-   Interface(const char * title, const Position & posUpperRight)
+   Interface(const char * title, const View & view)
    {
-      initialize(title, posUpperRight);
+      initialize(title, view);
    }
    
    // This will set the game in motion
@@ -47,8 +74,21 @@ public:
    // Set the next draw time based on current time and time period
    void setNextDrawTime();
 
-   // Retrieve the next tick time... the time of the next draw.
-   unsigned int getNextTick() { return nextTick; };
+   // Retrieve the deadline for the next draw
+   std::chrono::steady_clock::time_point getNextDrawTime() const { return nextDraw; }
+
+   // The client calls this between updating and drawing so the frame
+   // stats can tell the two apart
+   void beginDraw() const { timeDraw = std::chrono::steady_clock::now(); }
+
+   // How long did the last frame take?
+   const FrameStats & getFrameStats() const { return stats; }
+
+   // Wall-clock seconds from the start of the last frame to the start
+   // of this one. This is how much time the client should move on by.
+   // Setting it stands in for the clock when there is no window
+   double getFrameDelta() const { return frameDelta; }
+   void setFrameDelta(double delta) { frameDelta = delta; }
 
    // How many frames per second are we configured for?
    void setFramesPerSecond(double value);
@@ -69,15 +109,33 @@ public:
    bool isSpace()     const { return isSpacePress; }
    bool isQ()         const { return isQPress;     }
 
+   // All the keys at once as INPUT_ bits. Setting them stands in for
+   // the keyboard, so a recorded session can be played back
+   unsigned int getInput() const;
+   void setInput(unsigned int keys);
+
+   // What srand() was given when the window opened
+   unsigned int getSeed() const { return seed; }
+
    static void *p;                   // for client
    static void (*callBack)(const Interface *, void *);
 
+   // The main loop uses these to time each frame
+   void beginFrame();
+   void endFrame(std::chrono::steady_clock::time_point timeCallback,
+                 std::chrono::steady_clock::time_point timeSwap);
+
 private:
-   void initialize(const char * title, const Position & posUpperRight);
+   void initialize(const char * title, const View & view);
 
    static bool         initialized;  // only run the constructor once!
    static double       timePeriod;   // interval between frame draws
-   static unsigned int nextTick;     // time (from clock()) of our next draw
+   static std::chrono::steady_clock::time_point nextDraw;   // deadline of our next draw
+   static std::chrono::steady_clock::time_point timeFrame;  // when this frame began
+   static std::chrono::steady_clock::time_point timeDraw;   // when the client began drawing
+   static FrameStats   stats;        // timing of the last frame
+   static double       frameDelta;   // s since the last frame began
+   static unsigned int seed;         // for the random number generator
 
    static int  isDownPress;          // is the down arrow currently pressed?
    static int  isUpPress;            //    "   up         "
@@ -0,0 +1,481 @@
+/***********************************************************************
+ * Source File:
+ *    USER INTERFACE RASTER
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    A graphics stream that draws into an in-memory RGBA framebuffer
+ *    instead of OpenGL. Everything is integer pixel work so a full frame
+ *    takes a fraction of a millisecond.
+ ************************************************************************/
+
+#include <cassert>    // for ASSERT
+#include <cmath>      // for floor() and ceil()
+#include <cstring>    // for memcpy()
+#include <cstdio>     // for FILE
+#include "uiRaster.h"
+
+using namespace std;
+
+const int GLYPH_WIDTH   = 5;   // columns in a glyph
+const int GLYPH_HEIGHT  = 7;   // rows in a glyph
+const int GLYPH_ADVANCE = 6;   // distance from one glyph to the next
+
+/*************************************************************************
+ * FONT
+ * A 5x7 bitmap font covering printable ASCII. Each row is five bits with
+ * the left-most column in bit 4, top row first.
+ *************************************************************************/
+static const unsigned char font[][GLYPH_HEIGHT] =
+{
+   { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // space
+   { 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04 },   // !
+   { 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00 },   // "
+   { 0x0A, 0x0A, 0x1F, 0x0A, 0x1F, 0x0A, 0x0A },   // #
+   { 0x04, 0x0F, 0x14, 0x0E, 0x05, 0x1E, 0x04 },   // $
+   { 0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03 },   // %
+   { 0x0C, 0x12, 0x14, 0x08, 0x15, 0x12, 0x0D },   // &
+   { 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '
+   { 0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02 },   // (
+   { 0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08 },   // )
+   { 0x00, 0x04, 0x15, 0x0E, 0x15, 0x04, 0x00 },   // *
+   { 0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00 },   // +
+   { 0x00, 0x00, 0x00, 0x00, 0x0C, 0x04, 0x08 },   // ,
+   { 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00 },   // -
+   { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C },   // .
+   { 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00 },   // /
+   { 0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E },   // 0
+   { 0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E },   // 1
+   { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F },   // 2
+   { 0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E },   // 3
+   { 0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02 },   // 4
+   { 0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E },   // 5
+   { 0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E },   // 6
+   { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08 },   // 7
+   { 0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E },   // 8
+   { 0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C },   // 9
+   { 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00 },   // :
+   { 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x04, 0x08 },   // ;
+   { 0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02 },   // <
+   { 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00 },   // =
+   { 0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08 },   // >
+   { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04 },   // ?
+   { 0x0E, 0x11, 0x01, 0x0D, 0x15, 0x15, 0x0E },   // @
+   { 0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 },   // A
+   { 0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E },   // B
+   { 0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E },   // C
+   { 0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C },   // D
+   { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F },   // E
+   { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10 },   // F
+   { 0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F },   // G
+   { 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 },   // H
+   { 0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E },   // I
+   { 0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C },   // J
+   { 0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11 },   // K
+   { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F },   // L
+   { 0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11 },   // M
+   { 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11 },   // N
+   { 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E },   // O
+   { 0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10 },   // P
+   { 0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D },   // Q
+   { 0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11 },   // R
+   { 0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E },   // S
+   { 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },   // T
+   { 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E },   // U
+   { 0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04 },   // V
+   { 0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A },   // W
+   { 0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11 },   // X
+   { 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04 },   // Y
+   { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F },   // Z
+   { 0x0E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0E },   // [
+   { 0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00 },   // backslash
+   { 0x0E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0E },   // ]
+   { 0x04, 0x0A, 0x11, 0x00, 0x00, 0x00, 0x00 },   // ^
+   { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F },   // _
+   { 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },   // `
+   { 0x00, 0x00, 0x0E, 0x01, 0x0F, 0x11, 0x0F },   // a
+   { 0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x1E },   // b
+   { 0x00, 0x00, 0x0E, 0x10, 0x10, 0x11, 0x0E },   // c
+   { 0x01, 0x01, 0x0D, 0x13, 0x11, 0x11, 0x0F },   // d
+   { 0x00, 0x00, 0x0E, 0x11, 0x1F, 0x10, 0x0E },   // e
+   { 0x06, 0x09, 0x08, 0x1C, 0x08, 0x08, 0x08 },   // f
+   { 0x00, 0x0F, 0x11, 0x11, 0x0F, 0x01, 0x0E },   // g
+   { 0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x11 },   // h
+   { 0x04, 0x00, 0x0C, 0x04, 0x04, 0x04, 0x0E },   // i
+   { 0x02, 0x00, 0x06, 0x02, 0x02, 0x12, 0x0C },   // j
+   { 0x10, 0x10, 0x12, 0x14, 0x18, 0x14, 0x12 },   // k
+   { 0x0C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E },   // l
+   { 0x00, 0x00, 0x1A, 0x15, 0x15, 0x11, 0x11 },   // m
+   { 0x00, 0x00, 0x16, 0x19, 0x11, 0x11, 0x11 },   // n
+   { 0x00, 0x00, 0x0E, 0x11, 0x11, 0x11, 0x0E },   // o
+   { 0x00, 0x00, 0x1E, 0x11, 0x1E, 0x10, 0x10 },   // p
+   { 0x00, 0x00, 0x0D, 0x13, 0x0F, 0x01, 0x01 },   // q
+   { 0x00, 0x00, 0x16, 0x19, 0x10, 0x10, 0x10 },   // r
+   { 0x00, 0x00, 0x0E, 0x10, 0x0E, 0x01, 0x1E },   // s
+   { 0x08, 0x08, 0x1C, 0x08, 0x08, 0x09, 0x06 },   // t
+   { 0x00, 0x00, 0x11, 0x11, 0x11, 0x13, 0x0D },   // u
+   { 0x00, 0x00, 0x11, 0x11, 0x11, 0x0A, 0x04 },   // v
+   { 0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0A },   // w
+   { 0x00, 0x00, 0x11, 0x0A, 0x04, 0x0A, 0x11 },   // x
+   { 0x00, 0x00, 0x11, 0x11, 0x0F, 0x01, 0x0E },   // y
+   { 0x00, 0x00, 0x1F, 0x02, 0x04, 0x08, 0x1F },   // z
+   { 0x02, 0x04, 0x04, 0x08, 0x04, 0x04, 0x02 },   // {
+   { 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },   // |
+   { 0x08, 0x04, 0x04, 0x02, 0x04, 0x04, 0x08 },   // }
+   { 0x00, 0x00, 0x08, 0x15, 0x02, 0x00, 0x00 },   // ~
+};
+
+/*************************************************************************
+ * PACK COLOR
+ * Turn a color into four bytes in R, G, B, A order in memory
+ *************************************************************************/
+static unsigned int packColor(double red, double green, double blue)
+{
+   unsigned char rgba[4] =
+   {
+      (unsigned char)(red   <= 0.0 ? 0 : red   >= 1.0 ? 255 : red   * 255.0 + 0.5),
+      (unsigned char)(green <= 0.0 ? 0 : green >= 1.0 ? 255 : green * 255.0 + 0.5),
+      (unsigned char)(blue  <= 0.0 ? 0 : blue  >= 1.0 ? 255 : blue  * 255.0 + 0.5),
+      255
+   };
+   unsigned int color;
+   memcpy(&color, rgba, sizeof(color));
+   return color;
+}
+
+/*************************************************************************
+ * CRC 32
+ * The checksum PNG uses. We use it for frame checksums too.
+ *************************************************************************/
+static unsigned int crc32(unsigned int crc, const unsigned char * p, size_t size)
+{
+   static const struct Table
+   {
+      Table()
+      {
+         for (unsigned int n = 0; n < 256; n++)
+         {
+            unsigned int c = n;
+            for (int k = 0; k < 8; k++)
+               c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            entries[n] = c;
+         }
+      }
+      unsigned int entries[256];
+   } table;
+
+   crc = ~crc;
+   for (size_t i = 0; i < size; i++)
+      crc = table.entries[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+   return ~crc;
+}
+
+/*************************************************************************
+ * RASTER : CONSTRUCTOR
+ *************************************************************************/
+ogstreamRaster::ogstreamRaster(const View & view) :
+   ogstream(view),
+   width(view.getWidth()), height(view.getHeight()),
+   pixels(view.getWidth() * view.getHeight())
+{
+   assert(width > 0 && height > 0);
+   clear();
+}
+
+/*************************************************************************
+ * RASTER : CLEAR
+ * Fill the whole frame with one color
+ *************************************************************************/
+void ogstreamRaster::clear(double red, double green, double blue)
+{
+   std::fill(pixels.begin(), pixels.end(), packColor(red, green, blue));
+}
+
+/*************************************************************************
+ * RASTER : GET PIXEL
+ * The color of one pixel as 0xRRGGBB. (0,0) is the bottom-left
+ *************************************************************************/
+unsigned int ogstreamRaster::getPixel(int x, int y) const
+{
+   assert(x >= 0 && x < width && y >= 0 && y < height);
+   unsigned char rgba[4];
+   memcpy(rgba, &pixels[(height - 1 - y) * width + x], sizeof(rgba));
+   return (rgba[0] << 16) | (rgba[1] << 8) | rgba[2];
+}
+
+/*************************************************************************
+ * RASTER : CHECKSUM
+ * A CRC-32 of the frame, handy for comparing against a known-good render
+ *************************************************************************/
+unsigned int ogstreamRaster::checksum() const
+{
+   return crc32(0, (const unsigned char *)pixels.data(),
+                pixels.size() * sizeof(pixels[0]));
+}
+
+/*************************************************************************
+ * RASTER : FILL RECT
+ * Fill every pixel whose center is inside [min, max)
+ *************************************************************************/
+void ogstreamRaster::fillRect(double xMin, double yMin, double xMax, double yMax,
+                              unsigned int color)
+{
+   int iBegin = max(0,      (int)ceil(xMin - 0.5));
+   int iEnd   = min(width,  (int)ceil(xMax - 0.5));
+   int jBegin = max(0,      (int)ceil(yMin - 0.5));
+   int jEnd   = min(height, (int)ceil(yMax - 0.5));
+
+   for (int j = jBegin; j < jEnd; j++)
+   {
+      unsigned int * pRow = &pixels[(height - 1 - j) * width];
+      std::fill(pRow + iBegin, pRow + max(iBegin, iEnd), color);
+   }
+}
+
+/*************************************************************************
+ * RASTER : DRAW LINE
+ * Bresenham's line from the beginning to the end, both ends included
+ *************************************************************************/
+void ogstreamRaster::drawLine(const Position & begin, const Position & end,
+                              double red, double green, double blue)
+{
+   unsigned int color = packColor(red, green, blue);
+   int x0 = (int)floor(view.getPixelsX(begin));
+   int y0 = (int)floor(view.getPixelsY(begin));
+   int x1 = (int)floor(view.getPixelsX(end));
+   int y1 = (int)floor(view.getPixelsY(end));
+
+   int dx =  abs(x1 - x0);
+   int dy = -abs(y1 - y0);
+   int sx = x0 < x1 ? 1 : -1;
+   int sy = y0 < y1 ? 1 : -1;
+   int error = dx + dy;
+
+   for (;;)
+   {
+      plot(x0, y0, color);
+      if (x0 == x1 && y0 == y1)
+         break;
+      int e2 = 2 * error;
+      if (e2 >= dy)
+      {
+         error += dy;
+         x0 += sx;
+      }
+      if (e2 <= dx)
+      {
+         error += dx;
+         y0 += sy;
+      }
+   }
+}
+
+/*************************************************************************
+ * RASTER : DRAW RECTANGLE
+ * An axis-aligned filled rectangle. The corners can come in any order
+ *************************************************************************/
+void ogstreamRaster::drawRectangle(const Position & begin, const Position & end,
+                                   double red, double green, double blue)
+{
+   fillRect(min(view.getPixelsX(begin), view.getPixelsX(end)),
+            min(view.getPixelsY(begin), view.getPixelsY(end)),
+            max(view.getPixelsX(begin), view.getPixelsX(end)),
+            max(view.getPixelsY(begin), view.getPixelsY(end)),
+            packColor(red, green, blue));
+}
+
+/*************************************************************************
+ * RASTER : DRAW POLYGON
+ * A filled convex polygon in either winding. A pixel is filled when its
+ * center is on the inside of every edge.
+ *************************************************************************/
+void ogstreamRaster::drawPolygon(const Position points[], int num,
+                                 double red, double green, double blue)
+{
+   assert(num >= 3 && num <= 8);
+   unsigned int color = packColor(red, green, blue);
+
+   // convert to pixels once and find the bounding box
+   double x[8];
+   double y[8];
+   double xMin = 1e99, yMin = 1e99, xMax = -1e99, yMax = -1e99;
+   for (int i = 0; i < num; i++)
+   {
+      x[i] = view.getPixelsX(points[i]);
+      y[i] = view.getPixelsY(points[i]);
+      xMin = min(xMin, x[i]);
+      xMax = max(xMax, x[i]);
+      yMin = min(yMin, y[i]);
+      yMax = max(yMax, y[i]);
+   }
+
+   // which way do the corners wind? Degenerate polygons cover nothing.
+   double area = 0.0;
+   for (int i = 0; i < num; i++)
+   {
+      int k = (i + 1) % num;
+      area += x[i] * y[k] - x[k] * y[i];
+   }
+   if (area == 0.0)
+      return;
+   double sign = area > 0.0 ? 1.0 : -1.0;
+
+   int iBegin = max(0,      (int)ceil(xMin - 0.5));
+   int iEnd   = min(width,  (int)ceil(xMax - 0.5));
+   int jBegin = max(0,      (int)ceil(yMin - 0.5));
+   int jEnd   = min(height, (int)ceil(yMax - 0.5));
+   for (int j = jBegin; j < jEnd; j++)
+      for (int i = iBegin; i < iEnd; i++)
+      {
+         double px = (double)i + 0.5;
+         double py = (double)j + 0.5;
+         bool inside = true;
+         for (int e = 0; inside && e < num; e++)
+         {
+            int k = (e + 1) % num;
+            double cross = (x[k] - x[e]) * (py - y[e]) - (y[k] - y[e]) * (px - x[e]);
+            inside = cross * sign >= 0.0;
+         }
+         if (inside)
+            plot(i, j, color);
+      }
+}
+
+/*************************************************************************
+ * RASTER : DRAW TEXT
+ * Draw black text with the bitmap font. Like GLUT, the position is the
+ * left end of the baseline.
+ *************************************************************************/
+void ogstreamRaster::drawText(const Position & topLeft, const char * text)
+{
+   unsigned int color = packColor(0.0, 0.0, 0.0);
+   int x = (int)floor(view.getPixelsX(topLeft));
+   int y = (int)floor(view.getPixelsY(topLeft));
+
+   for (const char * p = text; *p; p++, x += GLYPH_ADVANCE)
+   {
+      // anything we have no glyph for shows up as a question mark
+      int c = (unsigned char)*p;
+      if (c < ' ' || c > '~')
+         c = '?';
+      const unsigned char * glyph = font[c - ' '];
+
+      for (int row = 0; row < GLYPH_HEIGHT; row++)
+         for (int col = 0; col < GLYPH_WIDTH; col++)
+            if (glyph[row] & (0x10 >> col))
+               plot(x + col, y + GLYPH_HEIGHT - 1 - row, color);
+   }
+}
+
+/*************************************************************************
+ * RASTER : SAVE PPM
+ * Binary PPM (P6): about the simplest image format there is
+ *************************************************************************/
+bool ogstreamRaster::savePPM(const char * fileName) const
+{
+   FILE * file = fopen(fileName, "wb");
+   if (file == nullptr)
+      return false;
+
+   fprintf(file, "P6\n%d %d\n255\n", width, height);
+
+   vector<unsigned char> row(width * 3);
+   for (int j = 0; j < height; j++)
+   {
+      const unsigned char * pIn = (const unsigned char *)&pixels[j * width];
+      for (int i = 0; i < width; i++)
+      {
+         row[i * 3 + 0] = pIn[i * 4 + 0];
+         row[i * 3 + 1] = pIn[i * 4 + 1];
+         row[i * 3 + 2] = pIn[i * 4 + 2];
+      }
+      fwrite(row.data(), 1, row.size(), file);
+   }
+
+   return fclose(file) == 0;
+}
+
+/*************************************************************************
+ * RASTER : SAVE PNG
+ * An RGBA PNG. The image data is stored without compression so we need
+ * nothing beyond CRC-32 and Adler-32.
+ *************************************************************************/
+bool ogstreamRaster::savePNG(const char * fileName) const
+{
+   FILE * file = fopen(fileName, "wb");
+   if (file == nullptr)
+      return false;
+
+   // big-endian helpers
+   auto put32 = [](vector<unsigned char> & out, unsigned int value)
+   {
+      out.push_back((unsigned char)(value >> 24));
+      out.push_back((unsigned char)(value >> 16));
+      out.push_back((unsigned char)(value >>  8));
+      out.push_back((unsigned char)(value >>  0));
+   };
+   auto writeChunk = [&](const char * type, const vector<unsigned char> & data)
+   {
+      vector<unsigned char> chunk;
+      put32(chunk, (unsigned int)data.size());
+      chunk.insert(chunk.end(), type, type + 4);
+      chunk.insert(chunk.end(), data.begin(), data.end());
+      put32(chunk, crc32(0, chunk.data() + 4, chunk.size() - 4));
+      fwrite(chunk.data(), 1, chunk.size(), file);
+   };
+
+   // signature
+   const unsigned char signature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+   fwrite(signature, 1, sizeof(signature), file);
+
+   // header: 8 bits per channel, RGBA, no interlace
+   vector<unsigned char> header;
+   put32(header, width);
+   put32(header, height);
+   header.push_back(8);
+   header.push_back(6);
+   header.push_back(0);
+   header.push_back(0);
+   header.push_back(0);
+   writeChunk("IHDR", header);
+
+   // each scanline starts with filter type 0 (none)
+   size_t rowBytes = width * 4 + 1;
+   vector<unsigned char> raw(rowBytes * height);
+   for (int j = 0; j < height; j++)
+   {
+      raw[j * rowBytes] = 0;
+      memcpy(&raw[j * rowBytes + 1], &pixels[j * width], width * 4);
+   }
+
+   // wrap it in a zlib stream made of stored blocks
+   vector<unsigned char> data;
+   data.push_back(0x78);
+   data.push_back(0x01);
+   bool fLast = false;
+   for (size_t offset = 0; !fLast; )
+   {
+      size_t size = min(raw.size() - offset, (size_t)65535);
+      fLast = offset + size == raw.size();
+      data.push_back(fLast ? 1 : 0);
+      data.push_back((unsigned char)(size & 0xFF));
+      data.push_back((unsigned char)(size >> 8));
+      data.push_back((unsigned char)(~size & 0xFF));
+      data.push_back((unsigned char)((~size >> 8) & 0xFF));
+      data.insert(data.end(), raw.begin() + offset, raw.begin() + offset + size);
+      offset += size;
+   }
+   unsigned int a = 1;
+   unsigned int b = 0;
+   for (size_t i = 0; i < raw.size(); i++)
+   {
+      a = (a + raw[i]) % 65521;
+      b = (b + a) % 65521;
+   }
+   put32(data, (b << 16) | a);
+   writeChunk("IDAT", data);
+
+   writeChunk("IEND", vector<unsigned char>());
+
+   return fclose(file) == 0;
+}
@@ -0,0 +1,69 @@
+/***********************************************************************
+ * Header File:
+ *    USER INTERFACE RASTER
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    A graphics stream that draws into an in-memory RGBA framebuffer
+ *    instead of OpenGL. This lets us render frames on machines without
+ *    a display and compare them pixel for pixel.
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>       // for the framebuffer
+#include "uiDraw.h"     // for ogstream
+#include "position.h"   // Where things are drawn
+
+class TestRaster;
+
+/*************************************************************************
+ * GRAPHICS STREAM RASTER
+ * An ogstream that rasterizes into memory. Pixel (0,0) is the bottom-left
+ * corner of the screen, just like the OpenGL backend. The frame is the
+ * size of the view.
+ *************************************************************************/
+class ogstreamRaster : public ogstream
+{
+   friend ::TestRaster;
+
+public:
+   ogstreamRaster(const View & view);
+   ~ogstreamRaster() { flush(); }
+   using ogstream::operator =;
+
+   // start a new frame, white like the OpenGL window
+   void clear(double red = 1.0, double green = 1.0, double blue = 1.0);
+
+   // the primitives everything else is built from
+   void drawLine(const Position & begin, const Position & end,
+                 double red = 0.0, double green = 0.0, double blue = 0.0);
+   void drawRectangle(const Position & begin, const Position & end,
+                      double red = 0.0, double green = 0.0, double blue = 0.0);
+   void drawPolygon(const Position points[], int num,
+                    double red = 0.0, double green = 0.0, double blue = 0.0);
+   void drawText(const Position & topLeft, const char * text);
+
+   // what got drawn
+   int getWidth()  const { return width;  }
+   int getHeight() const { return height; }
+   unsigned int getPixel(int x, int y) const;   // 0xRRGGBB
+   unsigned int checksum() const;               // CRC-32 of the frame
+
+   // write the frame to disk. Returns false if the file cannot be written
+   bool savePPM(const char * fileName) const;
+   bool savePNG(const char * fileName) const;
+
+private:
+   void fillRect(double xMin, double yMin, double xMax, double yMax,
+                 unsigned int color);
+   void plot(int x, int y, unsigned int color)
+   {
+      if (x >= 0 && x < width && y >= 0 && y < height)
+         pixels[(height - 1 - y) * width + x] = color;
+   }
+
+   int width;                         // in pixels
+   int height;                        // in pixels
+   std::vector<unsigned int> pixels;  // RGBA bytes, top row first
+};
@@ -29,7 +29,13 @@
 class UnitTest
 {
 public:
-   UnitTest() { reset(); }
+   UnitTest() : pOut(&std::cout), numFailed(0) { reset(); }
+
+   // where report() writes. Each runner thread gives its tests their own
+   void setOutput(std::ostream& out) { pOut = &out; }
+
+   // how many tests failed in the last report()
+   int getNumFailed() const { return numFailed; }
 
 private:
    // a test failure is a failure string and a line number
@@ -42,6 +48,9 @@ private:
    // each test has a name (the key) and the list of failures(value).
    std::map<std::string, std::vector<Failure>> tests;
 
+   std::ostream* pOut;   // where the report goes
+   int numFailed;        // failures in the last report
+
 protected:
 
    // for closeEnough() and assertEquals(), what is the tolerance?
@@ -69,23 +78,25 @@ protected:
     *************************************************************/
    void report(const char* name)
    {
+      std::ostream& out = *pOut;
+
       // enumerate the failures, if there are any
       for (auto& test : tests)
          if (!test.second.empty())
          {
-            std::cout << "\t" << test.first << "()\n";
+            out << "\t" << test.first << "()\n";
             for (auto& failure : test.second)
-               std::cout << "\t\tline:" << failure.lineNumber
+               out << "\t\tline:" << failure.lineNumber
                << " condition:" << failure.failure << "\n";
          }
 
       // name the test case
-      std::cout << std::left << std::setw(15) << name << ":\t";
+      out << std::left << std::setw(15) << name << ":\t";
 
       // handle the no test case
       if (tests.empty())
       {
-         std::cout << "There were no tests]\n";
+         out << "There were no tests]\n";
          return;
       }
 
@@ -93,12 +104,13 @@ protected:
       int numSuccess = 0;
       for (auto& test : tests)
          numSuccess += (test.second.empty() ? 1 : 0);
+      numFailed = (int)tests.size() - numSuccess;
       double successRate = (double)numSuccess / (double)tests.size();
 
       // display the summary
-      std::cout.setf(std::ios::fixed | std::ios::showpoint);
-      std::cout.precision(1);
-      std::cout << "There were "
+      out.setf(std::ios::fixed | std::ios::showpoint);
+      out.precision(1);
+      out << "There were "
          << tests.size()
          << " tests run for a success rate of: "
          << (successRate * 100.0) << "%\n";
@@ -0,0 +1,113 @@
+/***********************************************************************
+ * Header File:
+ *    VEC2
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    A two dimensional vector over any scalar type. Position, Velocity
+ *    and Acceleration keep their own names and units on top of it;
+ *    this is only the arithmetic.
+ ************************************************************************/
+
+#pragma once
+
+#include <cmath>       // for sqrt()
+
+// Pack x and y into one SSE2 register for doubles. Only on 64 bit
+// builds, where the heap is sure to give us 16 byte alignment.
+// Define VEC2_NO_SIMD to use the plain template everywhere.
+#if !defined(VEC2_NO_SIMD) && \
+    ((defined(__SSE2__) && defined(__x86_64__)) || defined(_M_X64))
+#define VEC2_SSE2
+#include <emmintrin.h>
+#endif
+
+/*********************************************
+ * VEC2
+ * Every operation works on x and y in the same order a hand written
+ * pair of lines would, so swapping one in gives the same bits:
+ *    p + v * t + a * 0.5 * t * t
+ * is x + dx t + ((1/2 ddx) t) t, and likewise for y.
+ *********************************************/
+template <class T>
+class Vec2
+{
+public:
+   Vec2() : x(0), y(0) {}
+   Vec2(T x, T y) : x(x), y(y) {}
+
+   T getX() const { return x; }
+   T getY() const { return y; }
+   void setX(T x) { this->x = x; }
+   void setY(T y) { this->y = y; }
+
+   Vec2 operator + (const Vec2& rhs) const { return Vec2(x + rhs.x, y + rhs.y); }
+   Vec2 operator - (const Vec2& rhs) const { return Vec2(x - rhs.x, y - rhs.y); }
+   Vec2 operator * (const Vec2& rhs) const { return Vec2(x * rhs.x, y * rhs.y); }
+   Vec2 operator * (T s)             const { return Vec2(x * s, y * s); }
+   Vec2 operator / (T s)             const { return Vec2(x / s, y / s); }
+   Vec2 operator - ()                const { return Vec2(-x, -y); }
+
+   Vec2& operator += (const Vec2& rhs) { return *this = *this + rhs; }
+   Vec2& operator -= (const Vec2& rhs) { return *this = *this - rhs; }
+   Vec2& operator *= (T s)             { return *this = *this * s; }
+
+   bool operator == (const Vec2& rhs) const { return x == rhs.x && y == rhs.y; }
+   bool operator != (const Vec2& rhs) const { return !(*this == rhs); }
+
+   T dot(const Vec2& rhs) const { return (x * rhs.x) + (y * rhs.y); }
+   T length() const { return std::sqrt(dot(*this)); }
+
+private:
+   T x;
+   T y;
+};
+
+#ifdef VEC2_SSE2
+/*********************************************
+ * VEC2 <double>
+ * Both coordinates in one register: x in the low half, y in the high
+ *********************************************/
+template <>
+class Vec2 <double>
+{
+public:
+   Vec2() : v(_mm_setzero_pd()) {}
+   Vec2(double x, double y) : v(_mm_set_pd(y, x)) {}
+   explicit Vec2(__m128d v) : v(v) {}
+
+   double getX() const { return _mm_cvtsd_f64(v); }
+   double getY() const { return _mm_cvtsd_f64(_mm_unpackhi_pd(v, v)); }
+   void setX(double x) { v = _mm_move_sd(v, _mm_set_sd(x)); }
+   void setY(double y) { v = _mm_unpacklo_pd(v, _mm_set_sd(y)); }
+
+   Vec2 operator + (const Vec2& rhs) const { return Vec2(_mm_add_pd(v, rhs.v)); }
+   Vec2 operator - (const Vec2& rhs) const { return Vec2(_mm_sub_pd(v, rhs.v)); }
+   Vec2 operator * (const Vec2& rhs) const { return Vec2(_mm_mul_pd(v, rhs.v)); }
+   Vec2 operator * (double s)        const { return Vec2(_mm_mul_pd(v, _mm_set1_pd(s))); }
+   Vec2 operator / (double s)        const { return Vec2(_mm_div_pd(v, _mm_set1_pd(s))); }
+   Vec2 operator - ()                const { return Vec2(_mm_xor_pd(v, _mm_set1_pd(-0.0))); }
+
+   Vec2& operator += (const Vec2& rhs) { v = _mm_add_pd(v, rhs.v); return *this; }
+   Vec2& operator -= (const Vec2& rhs) { v = _mm_sub_pd(v, rhs.v); return *this; }
+   Vec2& operator *= (double s)        { v = _mm_mul_pd(v, _mm_set1_pd(s)); return *this; }
+
+   bool operator == (const Vec2& rhs) const
+   {
+      return _mm_movemask_pd(_mm_cmpeq_pd(v, rhs.v)) == 3;
+   }
+   bool operator != (const Vec2& rhs) const { return !(*this == rhs); }
+
+   double dot(const Vec2& rhs) const
+   {
+      __m128d product = _mm_mul_pd(v, rhs.v);
+      return _mm_cvtsd_f64(_mm_add_sd(product, _mm_unpackhi_pd(product, product)));
+   }
+   double length() const { return std::sqrt(dot(*this)); }
+
+private:
+   __m128d v;
+};
+#endif // VEC2_SSE2
+
+typedef Vec2<double> Vec2d;
@@ -20,8 +20,9 @@
   *********************************************/
 void Velocity::add(const Acceleration& acceleration, double time)
 {
-   dx += (acceleration.getDDX() * time);
-   dy += (acceleration.getDDY() * time);
+   Vec2d v = getVector() + acceleration.getVector() * time;
+   dx = v.getX();
+   dy = v.getY();
 }
 
 /*********************************************
@@ -40,7 +41,7 @@ void Velocity::add(const Acceleration& acceleration, double time)
  *********************************************/
 double Velocity::getSpeed() const
 {
-   return sqrt((dx * dx) + (dy * dy));
+   return getVector().length();
 }
 
 /*********************************************
@@ -58,8 +59,8 @@ double Velocity::getSpeed() const
  *********************************************/
 void Velocity::set(const Angle& angle, double magnitude)
 {
-   dx = magnitude * sin(angle.getRadians());
-   dy = magnitude * cos(angle.getRadians());
+   dx = magnitude * angle.getDx();
+   dy = magnitude * angle.getDy();
 }
 
 
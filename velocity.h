@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include "vec2.h"
+
  // for unit tests
 class TestPosition;
 class TestVelocity;
@@ -34,10 +36,12 @@ public:
    // constructors
    Velocity() : dx(0.0), dy(0.0) { }
    Velocity(double dx, double dy) : dx(dx), dy(dy) { }
+   explicit Velocity(const Vec2d& v) : dx(v.getX()), dy(v.getY()) { }
 
    // getters
    double getDX()       const { return dx; }
    double getDY()       const { return dy; }
+   Vec2d  getVector()   const { return Vec2d(dx, dy); }
    double getSpeed()    const;
    Angle  getAngle()    const;
 
@@ -0,0 +1,65 @@
+/***********************************************************************
+ * Header File:
+ *    VIEW
+ * Author:
+ *    Daniel Malasky & Matt Benson
+ * Summary:
+ *    How the field maps onto a screen: the zoom and the size of the
+ *    window. Positions stay in meters; only a View knows about pixels.
+ ************************************************************************/
+
+#pragma once
+
+#include "position.h"
+
+class TestView;
+
+#define DEFAULT_METERS_FROM_PIXELS   40.0   // m per pixel
+
+/*********************************************
+ * VIEW
+ * A window onto the field. (0,0) is the bottom-left corner in both
+ * meters and pixels. Each ogstream has its own, so two renderers can
+ * draw at different zooms at the same time.
+ *********************************************/
+class View
+{
+public:
+   friend ::TestView;
+
+   // constructors
+   View() : metersFromPixels(DEFAULT_METERS_FROM_PIXELS), width(0), height(0) {}
+   View(double metersFromPixels, int width, int height) :
+      metersFromPixels(metersFromPixels), width(width), height(height) {}
+
+   // getters
+   double getZoom()   const { return metersFromPixels; }
+   int    getWidth()  const { return width;  }   // pixels
+   int    getHeight() const { return height; }   // pixels
+   Position getUpperRight() const { return fromPixels(width, height); }
+
+   // meters to pixels
+   double getPixelsX(const Position& pos) const { return pos.getMetersX() / metersFromPixels; }
+   double getPixelsY(const Position& pos) const { return pos.getMetersY() / metersFromPixels; }
+
+   // pixels to meters
+   double getMeters(double pixels) const { return pixels * metersFromPixels; }
+   Position fromPixels(double xPixels, double yPixels) const
+   {
+      return Position(getMeters(xPixels), getMeters(yPixels));
+   }
+
+   // a position moved by a number of pixels, such as a label beside a marker
+   Position offset(const Position& pos, double xPixels, double yPixels) const
+   {
+      Position posReturn(pos);
+      posReturn.addMetersX(getMeters(xPixels));
+      posReturn.addMetersY(getMeters(yPixels));
+      return posReturn;
+   }
+
+private:
+   double metersFromPixels;   // zoom
+   int width;                 // pixels
+   int height;                // pixels
+};